@@ -155,8 +155,8 @@ static const unsigned char default_inst[15][8] = {
 /* Adjust envelope speed which depends on sampling rate. */
 #define RATE_ADJUST(x) (rate==49716?x:(uint32_t)((double)(x)*clk/72/rate + 0.5))	/* added 0.5 to round the value */
 
-#define MOD(o,x) (&(o)->slot[(x)<<1])
-#define CAR(o,x) (&(o)->slot[((x)<<1)|1])
+#define MOD(x) ((x)<<1)
+#define CAR(x) (((x)<<1)|1)
 
 #define BIT(s,b) (((s)>>(b))&1)
 
@@ -166,26 +166,19 @@ static uint32_t clk = 844451141;
 /* Sampling rate */
 static uint32_t rate = 3354932;
 
-/* WaveTable for each envelope amp */
-static uint16_t fullsintable[PG_WIDTH];
-static uint16_t halfsintable[PG_WIDTH];
+/* Rate the rate-dependent tables were last built for */
+static uint32_t refresh_rate;
 
-static uint16_t *waveform[2] = { fullsintable, halfsintable };
+/* Sin, LFO, dB-to-linear, attack curve, KSL + TL and key scale
+   tables; none of them depend on the clock or the sampling rate. */
+#include "emu2413_tables.h"
 
-/* LFO Table */
-static int32_t pmtable[PM_PG_WIDTH];
-static int32_t amtable[AM_PG_WIDTH];
+static const uint16_t *const waveform[2] = { fullsintable, halfsintable };
 
 /* Phase delta for LFO */
 static uint32_t pm_dphase;
 static uint32_t am_dphase;
 
-/* dB to Liner table */
-static int16_t DB2LIN_TABLE[(DB_MUTE + DB_MUTE) * 2];
-
-/* Liner to Log curve conversion table (for Attack rate). */
-static uint16_t AR_ADJUST_TABLE[1 << EG_BITS];
-
 /* Definition of envelope mode */
 enum { READY, ATTACK, DECAY, SUSHOLD, SUSTINE, RELEASE, SETTLE, FINISH };
 
@@ -194,10 +187,6 @@ static uint32_t dphaseARTable[16][16];
 /* Phase incr table for Decay and Release */
 static uint32_t dphaseDRTable[16][16];
 
-/* KSL + TL Table */
-static uint32_t tllTable[16][8][1 << TL_BITS][4];
-static int32_t rksTable[2][8][2];
-
 /* Phase incr table for PG */
 static uint32_t dphaseTable[512][8][16];
 
@@ -206,113 +195,6 @@ static uint32_t dphaseTable[512][8][16];
 	Create tables
  
 ****************************************************/
-INLINE static int32_t Min(int32_t i, int32_t j)
-{
-	if (i < j)
-		return i;
-	else
-		return j;
-}
-
-/* Table for AR to LogCurve. */
-static void makeAdjustTable(void)
-{
-	int32_t i;
-
-	AR_ADJUST_TABLE[0] = (1 << EG_BITS) - 1;
-	for (i = 1; i < (1 << EG_BITS); i++)
-		AR_ADJUST_TABLE[i] =
-		    (uint16_t) ((double)(1 << EG_BITS) - 1 -
-				((1 << EG_BITS) - 1) * log(i) / log(127));
-}
-
-/* Table for dB(0 -- (1<<DB_BITS)-1) to Liner(0 -- DB2LIN_AMP_WIDTH) */
-static void makeDB2LinTable(void)
-{
-	int32_t i;
-
-	for (i = 0; i < DB_MUTE + DB_MUTE; i++) {
-		DB2LIN_TABLE[i] =
-		    (int16_t) ((double)((1 << DB2LIN_AMP_BITS) - 1) *
-			       pow(10, -(double)i * DB_STEP / 20));
-		if (i >= DB_MUTE)
-			DB2LIN_TABLE[i] = 0;
-		DB2LIN_TABLE[i + DB_MUTE + DB_MUTE] =
-		    (int16_t) (-DB2LIN_TABLE[i]);
-	}
-}
-
-/* Liner(+0.0 - +1.0) to dB((1<<DB_BITS) - 1 -- 0) */
-static int32_t lin2db(double d)
-{
-	if (d == 0)
-		return (DB_MUTE - 1);
-	else
-		return Min(-(int32_t) (20.0 * log10(d) / DB_STEP), DB_MUTE - 1);	/* 0 -- 127 */
-}
-
-/* Sin Table */
-static void makeSinTable(void)
-{
-	int32_t i;
-
-	for (i = 0; i < PG_WIDTH / 4; i++) {
-		fullsintable[i] =
-		    (uint32_t) lin2db(sin(2.0 * PI * i / PG_WIDTH));
-	}
-
-	for (i = 0; i < PG_WIDTH / 4; i++) {
-		fullsintable[PG_WIDTH / 2 - 1 - i] = fullsintable[i];
-	}
-
-	for (i = 0; i < PG_WIDTH / 2; i++) {
-		fullsintable[PG_WIDTH / 2 + i] =
-		    (uint32_t) (DB_MUTE + DB_MUTE + fullsintable[i]);
-	}
-
-	for (i = 0; i < PG_WIDTH / 2; i++)
-		halfsintable[i] = fullsintable[i];
-	for (i = PG_WIDTH / 2; i < PG_WIDTH; i++)
-		halfsintable[i] = fullsintable[0];
-}
-
-static double saw(double phase)
-{
-	if (phase <= PI / 2)
-		return phase * 2 / PI;
-	else if (phase <= PI * 3 / 2)
-		return 2.0 - (phase * 2 / PI);
-	else
-		return -4.0 + phase * 2 / PI;
-}
-
-/* Table for Pitch Modulator */
-static void makePmTable(void)
-{
-	int32_t i;
-
-	for (i = 0; i < PM_PG_WIDTH; i++) {
-		/* pmtable[i] = (int32_t) ((double) PM_AMP * pow (2, (double) PM_DEPTH * sin (2.0 * PI * i / PM_PG_WIDTH) / 1200)); */
-		pmtable[i] =
-		    (int32_t) ((double)PM_AMP *
-			       pow(2,
-				   (double)PM_DEPTH * saw(2.0 * PI * i /
-							  PM_PG_WIDTH) / 1200));
-	}
-}
-
-/* Table for Amp Modulator */
-static void makeAmTable(void)
-{
-	int32_t i;
-
-	for (i = 0; i < AM_PG_WIDTH; i++) {
-		/* amtable[i] = (int32_t) ((double) AM_DEPTH / 2 / DB_STEP * (1.0 + sin (2.0 * PI * i / PM_PG_WIDTH))); */
-		amtable[i] =
-		    (int32_t) ((double)AM_DEPTH / 2 / DB_STEP *
-			       (1.0 + saw(2.0 * PI * i / PM_PG_WIDTH)));
-	}
-}
 
 /* Phase increment counter table */
 static void makeDphaseTable(void)
@@ -333,48 +215,6 @@ static void makeDphaseTable(void)
 									     DP_BITS));
 }
 
-static void makeTllTable(void)
-{
-#define dB2(x) ((x)*2)
-
-	static double kltable[16] = {
-		dB2(0.000), dB2(9.000), dB2(12.000), dB2(13.875), dB2(15.000),
-		dB2(16.125), dB2(16.875), dB2(17.625), dB2(18.000), dB2(18.750),
-		dB2(19.125), dB2(19.500), dB2(19.875), dB2(20.250), dB2(20.625),
-		dB2(21.000)
-	};
-
-	int32_t tmp;
-	int32_t fnum, block, TL, KL;
-
-	for (fnum = 0; fnum < 16; fnum++)
-		for (block = 0; block < 8; block++)
-			for (TL = 0; TL < 64; TL++)
-				for (KL = 0; KL < 4; KL++) {
-					if (KL == 0) {
-						tllTable[fnum][block][TL][KL] =
-						    TL2EG(TL);
-					} else {
-						tmp =
-						    (int32_t) (kltable[fnum] -
-							       dB2(3.000) * (7 -
-									     block));
-						if (tmp <= 0)
-							tllTable[fnum][block]
-							    [TL][KL] =
-							    TL2EG(TL);
-						else
-							tllTable[fnum][block]
-							    [TL][KL] =
-							    (uint32_t) ((tmp >>
-									 (3 -
-									  KL)) /
-									EG_STEP)
-							    + TL2EG(TL);
-					}
-				}
-}
-
 #ifdef USE_SPEC_ENV_SPEED
 static double attacktime[16][4] = {
 	{0, 0, 0, 0},
@@ -505,45 +345,30 @@ static void makeDphaseDRTable(void)
 		}
 }
 
-static void makeRksTable(void)
-{
-	int32_t fnum8, block, KR;
-
-	for (fnum8 = 0; fnum8 < 2; fnum8++)
-		for (block = 0; block < 8; block++)
-			for (KR = 0; KR < 2; KR++) {
-				if (KR != 0)
-					rksTable[fnum8][block][KR] =
-					    (block << 1) + fnum8;
-				else
-					rksTable[fnum8][block][KR] = block >> 1;
-			}
-}
-
 /************************************************************
 
 	Calc Parameters
 
 ************************************************************/
 
-INLINE static uint32_t calc_eg_dphase(OPLL_SLOT * slot)
+INLINE static uint32_t calc_eg_dphase(OPLL_SLOTS * s, int32_t i)
 {
-	switch (slot->eg_mode) {
+	switch (s->eg_mode[i]) {
 	case ATTACK:
-		return dphaseARTable[slot->patch.AR][slot->rks];
+		return dphaseARTable[s->AR[i]][s->rks[i]];
 	case DECAY:
-		return dphaseDRTable[slot->patch.DR][slot->rks];
+		return dphaseDRTable[s->DR[i]][s->rks[i]];
 	case SUSHOLD:
 		return 0;
 	case SUSTINE:
-		return dphaseDRTable[slot->patch.RR][slot->rks];
+		return dphaseDRTable[s->RR[i]][s->rks[i]];
 	case RELEASE:
-		if (slot->sustine)
-			return dphaseDRTable[5][slot->rks];
-		else if (slot->patch.EG)
-			return dphaseDRTable[slot->patch.RR][slot->rks];
+		if (s->sustine[i])
+			return dphaseDRTable[5][s->rks[i]];
+		else if (s->EG[i])
+			return dphaseDRTable[s->RR[i]][s->rks[i]];
 		else
-			return dphaseDRTable[7][slot->rks];
+			return dphaseDRTable[7][s->rks[i]];
 
 	case SETTLE:
 		return dphaseDRTable[15][0];
@@ -561,50 +386,50 @@ INLINE static uint32_t calc_eg_dphase(OPLL_SLOT * slot)
 
 *************************************************************/
 
-#define UPDATE_PG(S)  (S)->dphase = dphaseTable[(S)->fnum][(S)->block][(S)->patch.ML]
-#define UPDATE_TLL(S)\
-    (((S)->type == 0) ? \
-     ((S)->tll = tllTable[((S)->fnum) >> 6][(S)->block][(S)->patch.TL][(S)->patch.KL]):\
-     ((S)->tll = tllTable[((S)->fnum) >> 5][(S)->block][(S)->volume][(S)->patch.KL]))
-#define UPDATE_RKS(S) (S)->rks = rksTable[((S)->fnum)>>8][(S)->block][(S)->patch.KR]
-#define UPDATE_WF(S)  (S)->sintbl = waveform[(S)->patch.WF]
-#define UPDATE_EG(S)  (S)->eg_dphase = calc_eg_dphase(S)
-#define UPDATE_ALL(S)\
-  UPDATE_PG(S);\
-  UPDATE_TLL(S);\
-  UPDATE_RKS(S);\
-  UPDATE_WF(S);\
-  UPDATE_EG(S)			/* EG should be updated last. */
+#define UPDATE_PG(S,i)  (S)->dphase[i] = dphaseTable[(S)->fnum[i]][(S)->block[i]][(S)->ML[i]]
+#define UPDATE_TLL(S,i)\
+    (((S)->type[i] == 0) ? \
+     ((S)->tll[i] = tllTable[((S)->fnum[i]) >> 6][(S)->block[i]][(S)->TL[i]][(S)->KL[i]]):\
+     ((S)->tll[i] = tllTable[((S)->fnum[i]) >> 5][(S)->block[i]][(S)->volume[i]][(S)->KL[i]]))
+#define UPDATE_RKS(S,i) (S)->rks[i] = rksTable[((S)->fnum[i])>>8][(S)->block[i]][(S)->KR[i]]
+#define UPDATE_WF(S,i)  (S)->sintbl[i] = waveform[(S)->WF[i]]
+#define UPDATE_EG(S,i)  (S)->eg_dphase[i] = calc_eg_dphase(S,i)
+#define UPDATE_ALL(S,i)\
+  UPDATE_PG(S,i);\
+  UPDATE_TLL(S,i);\
+  UPDATE_RKS(S,i);\
+  UPDATE_WF(S,i);\
+  UPDATE_EG(S,i)		/* EG should be updated last. */
 
 /* Slot key on */
-INLINE static void slotOn(OPLL_SLOT * slot)
+INLINE static void slotOn(OPLL_SLOTS * s, int32_t i)
 {
-	slot->eg_mode = ATTACK;
-	slot->eg_phase = 0;
-	slot->phase = 0;
-	UPDATE_EG(slot);
+	s->eg_mode[i] = ATTACK;
+	s->eg_phase[i] = 0;
+	s->phase[i] = 0;
+	UPDATE_EG(s, i);
 }
 
 /* Slot key off */
-INLINE static void slotOff(OPLL_SLOT * slot)
+INLINE static void slotOff(OPLL_SLOTS * s, int32_t i)
 {
-	if (slot->eg_mode == ATTACK)
-		slot->eg_phase =
+	if (s->eg_mode[i] == ATTACK)
+		s->eg_phase[i] =
 		    EXPAND_BITS(AR_ADJUST_TABLE
 				[HIGHBITS
-				 (slot->eg_phase, EG_DP_BITS - EG_BITS)],
+				 (s->eg_phase[i], EG_DP_BITS - EG_BITS)],
 				EG_BITS, EG_DP_BITS);
-	slot->eg_mode = RELEASE;
-	UPDATE_EG(slot);
+	s->eg_mode[i] = RELEASE;
+	UPDATE_EG(s, i);
 }
 
 /* Channel key on */
 INLINE static void keyOn(OPLL * opll, int32_t i)
 {
 	if (!opll->slot_on_flag[i * 2])
-		slotOn(MOD(opll, i));
+		slotOn(&opll->slots, MOD(i));
 	if (!opll->slot_on_flag[i * 2 + 1])
-		slotOn(CAR(opll, i));
+		slotOn(&opll->slots, CAR(i));
 	opll->key_status[i] = 1;
 }
 
@@ -612,36 +437,36 @@ INLINE static void keyOn(OPLL * opll, int32_t i)
 INLINE static void keyOff(OPLL * opll, int32_t i)
 {
 	if (opll->slot_on_flag[i * 2 + 1])
-		slotOff(CAR(opll, i));
+		slotOff(&opll->slots, CAR(i));
 	opll->key_status[i] = 0;
 }
 
 /* Set sustine parameter */
 INLINE static void setSustine(OPLL * opll, int32_t c, int32_t sustine)
 {
-	CAR(opll, c)->sustine = sustine;
-	if (MOD(opll, c)->type)
-		MOD(opll, c)->sustine = sustine;
+	opll->slots.sustine[CAR(c)] = sustine;
+	if (opll->slots.type[MOD(c)])
+		opll->slots.sustine[MOD(c)] = sustine;
 }
 
 /* Volume : 6bit ( Volume register << 2 ) */
 INLINE static void setVolume(OPLL * opll, int32_t c, int32_t volume)
 {
-	CAR(opll, c)->volume = volume;
+	opll->slots.volume[CAR(c)] = volume;
 }
 
 /* Set F-Number ( fnum : 9bit ) */
 INLINE static void setFnumber(OPLL * opll, int32_t c, int32_t fnum)
 {
-	CAR(opll, c)->fnum = fnum;
-	MOD(opll, c)->fnum = fnum;
+	opll->slots.fnum[CAR(c)] = fnum;
+	opll->slots.fnum[MOD(c)] = fnum;
 }
 
 /* Set Block data (block : 3bit ) */
 INLINE static void setBlock(OPLL * opll, int32_t c, int32_t block)
 {
-	CAR(opll, c)->block = block;
-	MOD(opll, c)->block = block;
+	opll->slots.block[CAR(c)] = block;
+	opll->slots.block[MOD(c)] = block;
 }
 
 
@@ -660,30 +485,36 @@ INLINE static void update_key_status(OPLL * opll)
 
 ***********************************************************/
 
-static void OPLL_SLOT_reset(OPLL_SLOT * slot, int type)
+static void OPLL_SLOT_reset(OPLL_SLOTS * s, int32_t i, int type)
 {
-	slot->type = type;
-	slot->sintbl = waveform[0];
-	slot->phase = 0;
-	slot->dphase = 0;
-	slot->output[0] = 0;
-	slot->output[1] = 0;
-	slot->feedback = 0;
-	slot->eg_mode = FINISH;
-	slot->eg_phase = EG_DP_WIDTH;
-	slot->eg_dphase = 0;
-	slot->rks = 0;
-	slot->tll = 0;
-	slot->sustine = 0;
-	slot->fnum = 0;
-	slot->block = 0;
-	slot->volume = 0;
-	slot->pgout = 0;
-	slot->egout = 0;
+	s->type[i] = type;
+	s->sintbl[i] = waveform[0];
+	s->phase[i] = 0;
+	s->dphase[i] = 0;
+	s->output[0][i] = 0;
+	s->output[1][i] = 0;
+	s->feedback[i] = 0;
+	s->eg_mode[i] = FINISH;
+	s->eg_phase[i] = EG_DP_WIDTH;
+	s->eg_dphase[i] = 0;
+	s->rks[i] = 0;
+	s->tll[i] = 0;
+	s->sustine[i] = 0;
+	s->fnum[i] = 0;
+	s->block[i] = 0;
+	s->volume[i] = 0;
+	s->pgout[i] = 0;
+	s->egout[i] = 0;
 }
 
 static void internal_refresh(void)
 {
+	/* OPLL_new() and OPLL_set_rate() often ask for the rate that
+	   the tables already match; don't rebuild them each time. */
+	if (rate == refresh_rate)
+		return;
+
+	refresh_rate = rate;
 	makeDphaseTable();
 	makeDphaseARTable();
 	makeDphaseDRTable();
@@ -693,16 +524,7 @@ static void internal_refresh(void)
 
 static void maketables(uint32_t c, uint32_t r)
 {
-	if (c != clk) {
-		clk = c;
-		makePmTable();
-		makeAmTable();
-		makeDB2LinTable();
-		makeAdjustTable();
-		makeTllTable();
-		makeRksTable();
-		makeSinTable();
-	}
+	clk = c;
 
 	if (r != rate) {
 		rate = r;
@@ -749,8 +571,8 @@ void OPLL_reset(OPLL * opll)
 
 	opll->mask = 0;
 
-	for (i = 0; i < 12; i++)
-		OPLL_SLOT_reset(&opll->slot[i], i % 2);
+	for (i = 0; i < OPLL_SLOT_NUM; i++)
+		OPLL_SLOT_reset(&opll->slots, i, i % 2);
 
 	for (i = 0; i < 6; i++) {
 		opll->key_status[i] = 0;
@@ -774,15 +596,91 @@ void OPLL_forceRefresh(OPLL * opll)
 	if (opll == NULL)
 		return;
 
-	for (i = 0; i < 12; i++) {
-		UPDATE_PG(&opll->slot[i]);
-		UPDATE_RKS(&opll->slot[i]);
-		UPDATE_TLL(&opll->slot[i]);
-		UPDATE_WF(&opll->slot[i]);
-		UPDATE_EG(&opll->slot[i]);
+	for (i = 0; i < OPLL_SLOT_NUM; i++) {
+		UPDATE_PG(&opll->slots, i);
+		UPDATE_RKS(&opll->slots, i);
+		UPDATE_TLL(&opll->slots, i);
+		UPDATE_WF(&opll->slots, i);
+		UPDATE_EG(&opll->slots, i);
 	}
 }
 
+/* Copies slot i out of the per-field arrays, for the save state. */
+void OPLL_get_slot(OPLL * opll, int32_t i, OPLL_SLOT * slot)
+{
+	OPLL_SLOTS *s = &opll->slots;
+
+	slot->patch.TL = s->TL[i];
+	slot->patch.FB = s->FB[i];
+	slot->patch.EG = s->EG[i];
+	slot->patch.ML = s->ML[i];
+	slot->patch.AR = s->AR[i];
+	slot->patch.DR = s->DR[i];
+	slot->patch.SL = s->SL[i];
+	slot->patch.RR = s->RR[i];
+	slot->patch.KR = s->KR[i];
+	slot->patch.KL = s->KL[i];
+	slot->patch.AM = s->AM[i];
+	slot->patch.PM = s->PM[i];
+	slot->patch.WF = s->WF[i];
+	slot->type = s->type[i];
+	slot->feedback = s->feedback[i];
+	slot->output[0] = s->output[0][i];
+	slot->output[1] = s->output[1][i];
+	slot->sintbl = s->sintbl[i];
+	slot->phase = s->phase[i];
+	slot->dphase = s->dphase[i];
+	slot->pgout = s->pgout[i];
+	slot->fnum = s->fnum[i];
+	slot->block = s->block[i];
+	slot->volume = s->volume[i];
+	slot->sustine = s->sustine[i];
+	slot->tll = s->tll[i];
+	slot->rks = s->rks[i];
+	slot->eg_mode = s->eg_mode[i];
+	slot->eg_phase = s->eg_phase[i];
+	slot->eg_dphase = s->eg_dphase[i];
+	slot->egout = s->egout[i];
+}
+
+/* Opposite of OPLL_get_slot() */
+void OPLL_set_slot(OPLL * opll, int32_t i, const OPLL_SLOT * slot)
+{
+	OPLL_SLOTS *s = &opll->slots;
+
+	s->TL[i] = slot->patch.TL;
+	s->FB[i] = slot->patch.FB;
+	s->EG[i] = slot->patch.EG;
+	s->ML[i] = slot->patch.ML;
+	s->AR[i] = slot->patch.AR;
+	s->DR[i] = slot->patch.DR;
+	s->SL[i] = slot->patch.SL;
+	s->RR[i] = slot->patch.RR;
+	s->KR[i] = slot->patch.KR;
+	s->KL[i] = slot->patch.KL;
+	s->AM[i] = slot->patch.AM;
+	s->PM[i] = slot->patch.PM;
+	s->WF[i] = slot->patch.WF;
+	s->type[i] = slot->type;
+	s->feedback[i] = slot->feedback;
+	s->output[0][i] = slot->output[0];
+	s->output[1][i] = slot->output[1];
+	s->sintbl[i] = slot->sintbl;
+	s->phase[i] = slot->phase;
+	s->dphase[i] = slot->dphase;
+	s->pgout[i] = slot->pgout;
+	s->fnum[i] = slot->fnum;
+	s->block[i] = slot->block;
+	s->volume[i] = slot->volume;
+	s->sustine[i] = slot->sustine;
+	s->tll[i] = slot->tll;
+	s->rks[i] = slot->rks;
+	s->eg_mode[i] = slot->eg_mode;
+	s->eg_phase[i] = slot->eg_phase;
+	s->eg_dphase[i] = slot->eg_dphase;
+	s->egout[i] = slot->egout;
+}
+
 void OPLL_set_rate(OPLL * opll, uint32_t r)
 {
 	if (opll->quality)
@@ -840,84 +738,105 @@ static void update_ampm(OPLL * opll)
 	    pmtable[HIGHBITS(opll->pm_phase, PM_DP_BITS - PM_PG_BITS)];
 }
 
+/* Sustine level of SL as an envelope phase: 3dB steps, except that
+   15 means 48dB. */
+#define SL_PHASE(x) ((uint32_t)SL2EG((x) == 15 ? 16 : (x))<<(EG_DP_BITS-EG_BITS))
+
+/* Cleared by tests/emu2413_test.c, which checks the loops over all
+   slots in calc() against the per-slot code. */
+static int opll_slot_vectors = 1;
+
 /* PG */
-INLINE static void calc_phase(OPLL_SLOT * slot, int32_t lfo)
+INLINE static void calc_phase_slot(OPLL_SLOTS * s, int32_t i, int32_t lfo)
 {
-	if (slot->patch.PM)
-		slot->phase += (slot->dphase * lfo) >> PM_AMP_BITS;
+	if (s->PM[i])
+		s->phase[i] += (s->dphase[i] * lfo) >> PM_AMP_BITS;
 	else
-		slot->phase += slot->dphase;
+		s->phase[i] += s->dphase[i];
 
-	slot->phase &= (DP_WIDTH - 1);
+	s->phase[i] &= (DP_WIDTH - 1);
 
-	slot->pgout = HIGHBITS(slot->phase, DP_BASE_BITS);
+	s->pgout[i] = HIGHBITS(s->phase[i], DP_BASE_BITS);
 }
 
-/* EG */
-static void calc_envelope(OPLL_SLOT * slot, int32_t lfo)
+/* PG for every slot, leaving alone the ones whose active[] is 0.
+   Written without branches so that the compiler vectorizes it. */
+INLINE static void calc_phase(OPLL_SLOTS * s, const uint32_t * active,
+			      int32_t lfo)
 {
-#define S2E(x) (SL2EG((int32_t)(x/SL_STEP))<<(EG_DP_BITS-EG_BITS))
+	int32_t i;
 
-	static uint32_t SL[16] = {
-		S2E(0.0), S2E(3.0), S2E(6.0), S2E(9.0), S2E(12.0), S2E(15.0),
-		    S2E(18.0), S2E(21.0), S2E(24.0), S2E(27.0), S2E(30.0),
-		    S2E(33.0), S2E(36.0), S2E(39.0), S2E(42.0), S2E(48.0)
-	};
+	for (i = 0; i < OPLL_SLOT_NUM; i++) {
+		uint32_t dphase, phase;
+
+		dphase = s->PM[i] ? (s->dphase[i] * lfo) >> PM_AMP_BITS :
+		    s->dphase[i];
+		phase = (s->phase[i] + (dphase & active[i])) & (DP_WIDTH - 1);
+
+		s->phase[i] = phase;
+		s->pgout[i] = active[i] ? HIGHBITS(phase, DP_BASE_BITS) :
+		    s->pgout[i];
+	}
+}
 
+/* EG state machine; steps the envelope phase and returns the
+   envelope level, before TL and AM are applied. */
+static uint32_t calc_eg_level(OPLL_SLOTS * s, int32_t i)
+{
 	uint32_t egout;
 
-	switch (slot->eg_mode) {
+	switch (s->eg_mode[i]) {
 	case ATTACK:
 		egout =
 		    AR_ADJUST_TABLE[HIGHBITS
-				    (slot->eg_phase, EG_DP_BITS - EG_BITS)];
-		slot->eg_phase += slot->eg_dphase;
-		if ((EG_DP_WIDTH & slot->eg_phase) || (slot->patch.AR == 15)) {
+				    (s->eg_phase[i], EG_DP_BITS - EG_BITS)];
+		s->eg_phase[i] += s->eg_dphase[i];
+		if ((EG_DP_WIDTH & s->eg_phase[i]) || (s->AR[i] == 15)) {
 			egout = 0;
-			slot->eg_phase = 0;
-			slot->eg_mode = DECAY;
-			UPDATE_EG(slot);
+			s->eg_phase[i] = 0;
+			s->eg_mode[i] = DECAY;
+			UPDATE_EG(s, i);
 		}
 		break;
 
 	case DECAY:
-		egout = HIGHBITS(slot->eg_phase, EG_DP_BITS - EG_BITS);
-		slot->eg_phase += slot->eg_dphase;
-		if (slot->eg_phase >= SL[slot->patch.SL]) {
-			if (slot->patch.EG) {
-				slot->eg_phase = SL[slot->patch.SL];
-				slot->eg_mode = SUSHOLD;
-				UPDATE_EG(slot);
+		egout = HIGHBITS(s->eg_phase[i], EG_DP_BITS - EG_BITS);
+		s->eg_phase[i] += s->eg_dphase[i];
+		if (s->eg_phase[i] >= SL_PHASE(s->SL[i])) {
+			if (s->EG[i]) {
+				s->eg_phase[i] = SL_PHASE(s->SL[i]);
+				s->eg_mode[i] = SUSHOLD;
+				UPDATE_EG(s, i);
 			} else {
-				slot->eg_phase = SL[slot->patch.SL];
-				slot->eg_mode = SUSTINE;
-				UPDATE_EG(slot);
+				s->eg_phase[i] = SL_PHASE(s->SL[i]);
+				s->eg_mode[i] = SUSTINE;
+				UPDATE_EG(s, i);
 			}
 		}
 		break;
 	case SUSHOLD:
-		egout = HIGHBITS(slot->eg_phase, EG_DP_BITS - EG_BITS);
-		if (slot->patch.EG == 0) {
-			slot->eg_mode = SUSTINE;
-			UPDATE_EG(slot);
+		egout = HIGHBITS(s->eg_phase[i], EG_DP_BITS - EG_BITS);
+		if (s->EG[i] == 0) {
+			s->eg_mode[i] = SUSTINE;
+			UPDATE_EG(s, i);
 		}
 		break;
 	case SUSTINE:
 	case RELEASE:
-		egout = HIGHBITS(slot->eg_phase, EG_DP_BITS - EG_BITS);
-		slot->eg_phase += slot->eg_dphase;
+		egout = HIGHBITS(s->eg_phase[i], EG_DP_BITS - EG_BITS);
+		s->eg_phase[i] += s->eg_dphase[i];
 		if (egout >= (1 << EG_BITS)) {
-			slot->eg_mode = FINISH;
+			s->eg_mode[i] = FINISH;
 			egout = (1 << EG_BITS) - 1;
 		}
 		break;
 	case SETTLE:
-		egout = HIGHBITS(slot->eg_phase, EG_DP_BITS - EG_BITS);
-		slot->eg_phase += slot->eg_dphase;
+		egout = HIGHBITS(s->eg_phase[i], EG_DP_BITS - EG_BITS);
+		s->eg_phase[i] += s->eg_dphase[i];
 		if (egout >= (1 << EG_BITS)) {
-			slot->eg_mode = ATTACK;
+			s->eg_mode[i] = ATTACK;
 			egout = (1 << EG_BITS) - 1;
-			UPDATE_EG(slot);
+			UPDATE_EG(s, i);
 		}
 		break;
 	case FINISH:
@@ -928,77 +847,156 @@ static void calc_envelope(OPLL_SLOT * slot, int32_t lfo)
 		break;
 	}
 
-	if (slot->patch.AM)
-		egout = EG2DB(egout + slot->tll) + lfo;
+	return egout;
+}
+
+/* EG */
+static void calc_envelope_slot(OPLL_SLOTS * s, int32_t i, int32_t lfo)
+{
+	uint32_t egout;
+
+	egout = calc_eg_level(s, i);
+
+	if (s->AM[i])
+		egout = EG2DB(egout + s->tll[i]) + lfo;
 	else
-		egout = EG2DB(egout + slot->tll);
+		egout = EG2DB(egout + s->tll[i]);
 
 	if (egout >= DB_MUTE)
 		egout = DB_MUTE - 1;
 
-	slot->egout = egout | 3;
+	s->egout[i] = egout | 3;
+}
+
+/* EG for every slot, leaving alone the ones whose active[] is 0.
+   The first and last loops vectorize; they cover slots that stay in
+   the same state this sample.  Slots in attack (which looks up the
+   attack curve) or changing state go through calc_eg_level(). */
+INLINE static void calc_envelope(OPLL_SLOTS * s, const uint32_t * active,
+				 int32_t lfo)
+{
+	uint32_t level[OPLL_SLOT_NUM];
+	uint32_t slow[OPLL_SLOT_NUM];
+	int32_t i;
+
+	for (i = 0; i < OPLL_SLOT_NUM; i++) {
+		int32_t mode;
+		uint32_t phase, next, egout;
+		uint32_t level_mode, moving, change;
+
+		mode = s->eg_mode[i];
+		phase = s->eg_phase[i];
+		egout = HIGHBITS(phase, EG_DP_BITS - EG_BITS);
+
+		/* Every mode from DECAY to SETTLE takes its level from the
+		   phase, and all of them but SUSHOLD move */
+		level_mode = (mode >= DECAY) & (mode <= SETTLE);
+		moving = level_mode & (mode != SUSHOLD);
+		next = phase + (s->eg_dphase[i] & -moving);
+
+		change = (mode == ATTACK) |
+		    ((mode == DECAY) & (next >= SL_PHASE(s->SL[i]))) |
+		    ((mode == SUSHOLD) & (s->EG[i] == 0)) |
+		    ((mode >= SUSTINE) & (mode <= SETTLE) &
+		     (egout >= (1 << EG_BITS)));
+
+		slow[i] = active[i] & -change;
+		s->eg_phase[i] = (active[i] & ~slow[i]) ? next : phase;
+		level[i] = level_mode ? egout : (1 << EG_BITS) - 1;
+	}
+
+	for (i = 0; i < OPLL_SLOT_NUM; i++) {
+		if (slow[i])
+			level[i] = calc_eg_level(s, i);
+	}
+
+	for (i = 0; i < OPLL_SLOT_NUM; i++) {
+		uint32_t egout;
+
+		egout = EG2DB(level[i] + s->tll[i]) + (s->AM[i] ? lfo : 0);
+		if (egout >= DB_MUTE)
+			egout = DB_MUTE - 1;
+
+		s->egout[i] = active[i] ? egout | 3 : s->egout[i];
+	}
 }
 
 /* CARRIOR */
-INLINE static int32_t calc_slot_car(OPLL_SLOT * slot, int32_t fm)
+INLINE static int32_t calc_slot_car(OPLL_SLOTS * s, int32_t i, int32_t fm)
 {
-	if (slot->egout >= (DB_MUTE - 1)) {
-		slot->output[0] = 0;
+	if (s->egout[i] >= (DB_MUTE - 1)) {
+		s->output[0][i] = 0;
 	} else {
-		slot->output[0] =
-		    DB2LIN_TABLE[slot->sintbl[(slot->pgout +
-					 wave2_8pi(fm)) & (PG_WIDTH - 1)] +
-				 slot->egout];
+		s->output[0][i] =
+		    DB2LIN_TABLE[s->sintbl[i][(s->pgout[i] +
+					      wave2_8pi(fm)) & (PG_WIDTH - 1)] +
+				 s->egout[i]];
 	}
 
-	slot->output[1] = (slot->output[1] + slot->output[0]) >> 1;
-	return slot->output[1];
+	s->output[1][i] = (s->output[1][i] + s->output[0][i]) >> 1;
+	return s->output[1][i];
 }
 
 /* MODULATOR */
-INLINE static int32_t calc_slot_mod(OPLL_SLOT * slot)
+INLINE static int32_t calc_slot_mod(OPLL_SLOTS * s, int32_t i)
 {
 	int32_t fm;
 
-	slot->output[1] = slot->output[0];
+	s->output[1][i] = s->output[0][i];
 
-	if (slot->egout >= (DB_MUTE - 1)) {
-		slot->output[0] = 0;
-	} else if (slot->patch.FB != 0) {
-		fm = wave2_4pi(slot->feedback) >> (7 - slot->patch.FB);
-		slot->output[0] =
-		    DB2LIN_TABLE[slot->sintbl
-				 [(slot->pgout + fm) & (PG_WIDTH - 1)] +
-				 slot->egout];
+	if (s->egout[i] >= (DB_MUTE - 1)) {
+		s->output[0][i] = 0;
+	} else if (s->FB[i] != 0) {
+		fm = wave2_4pi(s->feedback[i]) >> (7 - s->FB[i]);
+		s->output[0][i] =
+		    DB2LIN_TABLE[s->sintbl[i]
+				 [(s->pgout[i] + fm) & (PG_WIDTH - 1)] +
+				 s->egout[i]];
 	} else {
-		slot->output[0] =
-		    DB2LIN_TABLE[slot->sintbl[slot->pgout] + slot->egout];
+		s->output[0][i] =
+		    DB2LIN_TABLE[s->sintbl[i][s->pgout[i]] + s->egout[i]];
 	}
 
-	slot->feedback = (slot->output[1] + slot->output[0]) >> 1;
+	s->feedback[i] = (s->output[1][i] + s->output[0][i]) >> 1;
 
-	return slot->feedback;
+	return s->feedback[i];
 }
 
 
 static INLINE int16_t calc(OPLL * opll)
 {
+	OPLL_SLOTS *s = &opll->slots;
+	uint32_t active[OPLL_SLOT_NUM];
 	int32_t inst = 0, out = 0;
 	int32_t i;
 
 	update_ampm(opll);
 
-	for (i = 0; i < 12; i++) {
-		calc_phase(&opll->slot[i], opll->lfo_pm);
-		calc_envelope(&opll->slot[i], opll->lfo_am);
+	/* A channel whose carrier has finished stays silent until it is
+	   keyed on again, which resets both of its slots; their phase
+	   and envelope don't need updating until then. */
+	for (i = 0; i < 6; i++) {
+		active[MOD(i)] = (s->eg_mode[CAR(i)] != FINISH) ? ~0u : 0;
+		active[CAR(i)] = active[MOD(i)];
+	}
+
+	if (opll_slot_vectors) {
+		calc_phase(s, active, opll->lfo_pm);
+		calc_envelope(s, active, opll->lfo_am);
+	} else {
+		for (i = 0; i < OPLL_SLOT_NUM; i++) {
+			if (!active[i])
+				continue;
+
+			calc_phase_slot(s, i, opll->lfo_pm);
+			calc_envelope_slot(s, i, opll->lfo_am);
+		}
 	}
 
 	for (i = 0; i < 6; i++)
 		if (!(opll->mask & OPLL_MASK_CH(i))
-		    && (CAR(opll, i)->eg_mode != FINISH))
-			inst +=
-			    calc_slot_car(CAR(opll, i),
-					  calc_slot_mod(MOD(opll, i)));
+		    && (s->eg_mode[CAR(i)] != FINISH))
+			inst += calc_slot_car(s, CAR(i), calc_slot_mod(s, MOD(i)));
 
 	out = inst;
 	return (int16_t) out << 3;
@@ -1022,6 +1020,63 @@ int16_t OPLL_calc(OPLL * opll)
 	return (int16_t) opll->out;
 }
 
+/* Returns non-zero if every channel has finished; nothing but the LFOs
+   changes until the next register write. */
+int OPLL_is_silent(OPLL * opll)
+{
+	int32_t i;
+
+	for (i = 0; i < 6; i++) {
+		if (opll->slots.eg_mode[CAR(i)] != FINISH)
+			return 0;
+	}
+
+	return 1;
+}
+
+/* Equivalent to calling OPLL_calc() count times while the OPLL is
+   silent, without touching the slots. */
+void OPLL_skip(OPLL * opll, uint32_t count)
+{
+	uint32_t steps;
+
+	if (!count)
+		return;
+
+	if (!opll->quality) {
+		steps = count;
+	} else {
+		steps = 0;
+		while (count--) {
+			while (opll->realstep > opll->oplltime) {
+				opll->oplltime += opll->opllstep;
+				opll->prev = opll->next;
+				opll->next = 0;
+				steps++;
+			}
+			opll->oplltime -= opll->realstep;
+		}
+
+		opll->out =
+		    (int16_t) (((double)opll->next *
+				(opll->opllstep - opll->oplltime) +
+				(double)opll->prev * opll->oplltime) /
+			       opll->opllstep);
+	}
+
+	if (!steps)
+		return;
+
+	opll->pm_phase = (opll->pm_phase + steps * pm_dphase) &
+	    (PM_DP_WIDTH - 1);
+	opll->am_phase = (uint32_t) (opll->am_phase + steps * am_dphase) &
+	    (AM_DP_WIDTH - 1);
+	opll->lfo_am =
+	    amtable[HIGHBITS(opll->am_phase, AM_DP_BITS - AM_PG_BITS)];
+	opll->lfo_pm =
+	    pmtable[HIGHBITS(opll->pm_phase, PM_DP_BITS - PM_PG_BITS)];
+}
+
 uint32_t OPLL_setMask(OPLL * opll, uint32_t mask)
 {
 	uint32_t ret;
@@ -1053,39 +1108,38 @@ uint32_t OPLL_toggleMask(OPLL * opll, uint32_t mask)
 *****************************************************/
 static void setInstrument(OPLL * opll, unsigned int i, unsigned int inst) {
 	const uint8_t *src;
-	OPLL_PATCH *modp, *carp;
+	OPLL_SLOTS *s = &opll->slots;
+	int32_t m = MOD(i), c = CAR(i);
 	opll->patch_number[i] = inst;
 	if (inst)
 		src = default_inst[inst - 1];
 
 	else
 		src = opll->CustInst;
-	modp = &MOD(opll, i)->patch;
-	carp = &CAR(opll, i)->patch;
-	modp->AM = (src[0] >> 7) & 1;
-	modp->PM = (src[0] >> 6) & 1;
-	modp->EG = (src[0] >> 5) & 1;
-	modp->KR = (src[0] >> 4) & 1;
-	modp->ML = (src[0] & 0xF);
-	carp->AM = (src[1] >> 7) & 1;
-	carp->PM = (src[1] >> 6) & 1;
-	carp->EG = (src[1] >> 5) & 1;
-	carp->KR = (src[1] >> 4) & 1;
-	carp->ML = (src[1] & 0xF);
-	modp->KL = (src[2] >> 6) & 3;
-	modp->TL = (src[2] & 0x3F);
-	carp->KL = (src[3] >> 6) & 3;
-	carp->WF = (src[3] >> 4) & 1;
-	modp->WF = (src[3] >> 3) & 1;
-	modp->FB = (src[3]) & 7;
-	modp->AR = (src[4] >> 4) & 0xF;
-	modp->DR = (src[4] & 0xF);
-	carp->AR = (src[5] >> 4) & 0xF;
-	carp->DR = (src[5] & 0xF);
-	modp->SL = (src[6] >> 4) & 0xF;
-	modp->RR = (src[6] & 0xF);
-	carp->SL = (src[7] >> 4) & 0xF;
-	carp->RR = (src[7] & 0xF);
+	s->AM[m] = (src[0] >> 7) & 1;
+	s->PM[m] = (src[0] >> 6) & 1;
+	s->EG[m] = (src[0] >> 5) & 1;
+	s->KR[m] = (src[0] >> 4) & 1;
+	s->ML[m] = (src[0] & 0xF);
+	s->AM[c] = (src[1] >> 7) & 1;
+	s->PM[c] = (src[1] >> 6) & 1;
+	s->EG[c] = (src[1] >> 5) & 1;
+	s->KR[c] = (src[1] >> 4) & 1;
+	s->ML[c] = (src[1] & 0xF);
+	s->KL[m] = (src[2] >> 6) & 3;
+	s->TL[m] = (src[2] & 0x3F);
+	s->KL[c] = (src[3] >> 6) & 3;
+	s->WF[c] = (src[3] >> 4) & 1;
+	s->WF[m] = (src[3] >> 3) & 1;
+	s->FB[m] = (src[3]) & 7;
+	s->AR[m] = (src[4] >> 4) & 0xF;
+	s->DR[m] = (src[4] & 0xF);
+	s->AR[c] = (src[5] >> 4) & 0xF;
+	s->DR[c] = (src[5] & 0xF);
+	s->SL[m] = (src[6] >> 4) & 0xF;
+	s->RR[m] = (src[6] & 0xF);
+	s->SL[c] = (src[7] >> 4) & 0xF;
+	s->RR[c] = (src[7] & 0xF);
 }
 
 void OPLL_writeReg(OPLL * opll, uint32_t reg, uint32_t data)
@@ -1101,9 +1155,9 @@ void OPLL_writeReg(OPLL * opll, uint32_t reg, uint32_t data)
 		for (i = 0; i < 6; i++) {
 			if (opll->patch_number[i] == 0) {
 				setInstrument(opll, i, 0);
-				UPDATE_PG(MOD(opll, i));
-				UPDATE_RKS(MOD(opll, i));
-				UPDATE_EG(MOD(opll, i));
+				UPDATE_PG(&opll->slots, MOD(i));
+				UPDATE_RKS(&opll->slots, MOD(i));
+				UPDATE_EG(&opll->slots, MOD(i));
 			}
 		}
 		break;
@@ -1112,9 +1166,9 @@ void OPLL_writeReg(OPLL * opll, uint32_t reg, uint32_t data)
 		for (i = 0; i < 6; i++) {
 			if (opll->patch_number[i] == 0) {
 				setInstrument(opll, i, 0);
-				UPDATE_PG(CAR(opll, i));
-				UPDATE_RKS(CAR(opll, i));
-				UPDATE_EG(CAR(opll, i));
+				UPDATE_PG(&opll->slots, CAR(i));
+				UPDATE_RKS(&opll->slots, CAR(i));
+				UPDATE_EG(&opll->slots, CAR(i));
 			}
 		}
 		break;
@@ -1123,7 +1177,7 @@ void OPLL_writeReg(OPLL * opll, uint32_t reg, uint32_t data)
 		for (i = 0; i < 6; i++) {
 			if (opll->patch_number[i] == 0) {
 				setInstrument(opll, i, 0);
-				UPDATE_TLL(MOD(opll, i));
+				UPDATE_TLL(&opll->slots, MOD(i));
 			}
 		}
 		break;
@@ -1132,8 +1186,8 @@ void OPLL_writeReg(OPLL * opll, uint32_t reg, uint32_t data)
 		for (i = 0; i < 6; i++) {
 			if (opll->patch_number[i] == 0) {
 				setInstrument(opll, i, 0);
-				UPDATE_WF(MOD(opll, i));
-				UPDATE_WF(CAR(opll, i));
+				UPDATE_WF(&opll->slots, MOD(i));
+				UPDATE_WF(&opll->slots, CAR(i));
 			}
 		}
 		break;
@@ -1142,7 +1196,7 @@ void OPLL_writeReg(OPLL * opll, uint32_t reg, uint32_t data)
 		for (i = 0; i < 6; i++) {
 			if (opll->patch_number[i] == 0) {
 				setInstrument(opll, i, 0);
-				UPDATE_EG(MOD(opll, i));
+				UPDATE_EG(&opll->slots, MOD(i));
 			}
 		}
 		break;
@@ -1151,7 +1205,7 @@ void OPLL_writeReg(OPLL * opll, uint32_t reg, uint32_t data)
 		for (i = 0; i < 6; i++) {
 			if (opll->patch_number[i] == 0) {
 				setInstrument(opll, i, 0);
-				UPDATE_EG(CAR(opll, i));
+				UPDATE_EG(&opll->slots, CAR(i));
 			}
 		}
 		break;
@@ -1160,7 +1214,7 @@ void OPLL_writeReg(OPLL * opll, uint32_t reg, uint32_t data)
 		for (i = 0; i < 6; i++) {
 			if (opll->patch_number[i] == 0) {
 				setInstrument(opll, i, 0);
-				UPDATE_EG(MOD(opll, i));
+				UPDATE_EG(&opll->slots, MOD(i));
 			}
 		}
 		break;
@@ -1169,7 +1223,7 @@ void OPLL_writeReg(OPLL * opll, uint32_t reg, uint32_t data)
 		for (i = 0; i < 6; i++) {
 			if (opll->patch_number[i] == 0) {
 				setInstrument(opll, i, 0);
-				UPDATE_EG(CAR(opll, i));
+				UPDATE_EG(&opll->slots, CAR(i));
 			}
 		}
 		break;
@@ -1182,8 +1236,8 @@ void OPLL_writeReg(OPLL * opll, uint32_t reg, uint32_t data)
 		ch = reg - 0x10;
 		opll->LowFreq[ch] = (uint8_t) data;
 		setFnumber(opll, ch, data + ((opll->HiFreq[ch] & 1) << 8));
-		UPDATE_ALL(MOD(opll, ch));
-		UPDATE_ALL(CAR(opll, ch));
+		UPDATE_ALL(&opll->slots, MOD(ch));
+		UPDATE_ALL(&opll->slots, CAR(ch));
 		break;
 	case 0x20:
 	case 0x21:
@@ -1200,8 +1254,8 @@ void OPLL_writeReg(OPLL * opll, uint32_t reg, uint32_t data)
 			keyOn(opll, ch);
 		else
 			keyOff(opll, ch);
-		UPDATE_ALL(MOD(opll, ch));
-		UPDATE_ALL(CAR(opll, ch));
+		UPDATE_ALL(&opll->slots, MOD(ch));
+		UPDATE_ALL(&opll->slots, CAR(ch));
 		update_key_status(opll);
 		break;
 	case 0x30:
@@ -1215,8 +1269,8 @@ void OPLL_writeReg(OPLL * opll, uint32_t reg, uint32_t data)
 		v = data & 15;
 		setInstrument(opll, reg - 0x30, i);
 		setVolume(opll, reg - 0x30, v << 2);
-		UPDATE_ALL(MOD(opll, reg - 0x30));
-		UPDATE_ALL(CAR(opll, reg - 0x30));
+		UPDATE_ALL(&opll->slots, MOD(reg - 0x30));
+		UPDATE_ALL(&opll->slots, CAR(reg - 0x30));
 		break;
 	default:
 		break;
@@ -0,0 +1,2711 @@
+/* emu2413 lookup tables, generated by "tests/emu2413_test --tables"
+   from the code that used to build them at run time; don't edit. */
+
+/* WaveTable for each envelope amp */
+static const uint16_t fullsintable[PG_WIDTH] = {
+	255, 203, 171, 152, 139, 129, 120, 113,
+	107, 102, 97, 92, 88, 85, 81, 78,
+	75, 72, 70, 67, 65, 63, 61, 59,
+	57, 55, 53, 52, 50, 48, 47, 45,
+	44, 43, 41, 40, 39, 38, 37, 35,
+	34, 33, 32, 31, 30, 29, 28, 28,
+	27, 26, 25, 24, 23, 23, 22, 21,
+	21, 20, 19, 19, 18, 17, 17, 16,
+	16, 15, 14, 14, 13, 13, 12, 12,
+	11, 11, 11, 10, 10, 9, 9, 8,
+	8, 8, 7, 7, 7, 6, 6, 6,
+	5, 5, 5, 4, 4, 4, 4, 3,
+	3, 3, 3, 2, 2, 2, 2, 2,
+	2, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 2,
+	2, 2, 2, 2, 2, 3, 3, 3,
+	3, 4, 4, 4, 4, 5, 5, 5,
+	6, 6, 6, 7, 7, 7, 8, 8,
+	8, 9, 9, 10, 10, 11, 11, 11,
+	12, 12, 13, 13, 14, 14, 15, 16,
+	16, 17, 17, 18, 19, 19, 20, 21,
+	21, 22, 23, 23, 24, 25, 26, 27,
+	28, 28, 29, 30, 31, 32, 33, 34,
+	35, 37, 38, 39, 40, 41, 43, 44,
+	45, 47, 48, 50, 52, 53, 55, 57,
+	59, 61, 63, 65, 67, 70, 72, 75,
+	78, 81, 85, 88, 92, 97, 102, 107,
+	113, 120, 129, 139, 152, 171, 203, 255,
+	767, 715, 683, 664, 651, 641, 632, 625,
+	619, 614, 609, 604, 600, 597, 593, 590,
+	587, 584, 582, 579, 577, 575, 573, 571,
+	569, 567, 565, 564, 562, 560, 559, 557,
+	556, 555, 553, 552, 551, 550, 549, 547,
+	546, 545, 544, 543, 542, 541, 540, 540,
+	539, 538, 537, 536, 535, 535, 534, 533,
+	533, 532, 531, 531, 530, 529, 529, 528,
+	528, 527, 526, 526, 525, 525, 524, 524,
+	523, 523, 523, 522, 522, 521, 521, 520,
+	520, 520, 519, 519, 519, 518, 518, 518,
+	517, 517, 517, 516, 516, 516, 516, 515,
+	515, 515, 515, 514, 514, 514, 514, 514,
+	514, 513, 513, 513, 513, 513, 513, 513,
+	512, 512, 512, 512, 512, 512, 512, 512,
+	512, 512, 512, 512, 512, 512, 512, 512,
+	512, 512, 512, 512, 512, 512, 512, 512,
+	512, 512, 512, 512, 512, 512, 512, 512,
+	513, 513, 513, 513, 513, 513, 513, 514,
+	514, 514, 514, 514, 514, 515, 515, 515,
+	515, 516, 516, 516, 516, 517, 517, 517,
+	518, 518, 518, 519, 519, 519, 520, 520,
+	520, 521, 521, 522, 522, 523, 523, 523,
+	524, 524, 525, 525, 526, 526, 527, 528,
+	528, 529, 529, 530, 531, 531, 532, 533,
+	533, 534, 535, 535, 536, 537, 538, 539,
+	540, 540, 541, 542, 543, 544, 545, 546,
+	547, 549, 550, 551, 552, 553, 555, 556,
+	557, 559, 560, 562, 564, 565, 567, 569,
+	571, 573, 575, 577, 579, 582, 584, 587,
+	590, 593, 597, 600, 604, 609, 614, 619,
+	625, 632, 641, 651, 664, 683, 715, 767,
+};
+
+static const uint16_t halfsintable[PG_WIDTH] = {
+	255, 203, 171, 152, 139, 129, 120, 113,
+	107, 102, 97, 92, 88, 85, 81, 78,
+	75, 72, 70, 67, 65, 63, 61, 59,
+	57, 55, 53, 52, 50, 48, 47, 45,
+	44, 43, 41, 40, 39, 38, 37, 35,
+	34, 33, 32, 31, 30, 29, 28, 28,
+	27, 26, 25, 24, 23, 23, 22, 21,
+	21, 20, 19, 19, 18, 17, 17, 16,
+	16, 15, 14, 14, 13, 13, 12, 12,
+	11, 11, 11, 10, 10, 9, 9, 8,
+	8, 8, 7, 7, 7, 6, 6, 6,
+	5, 5, 5, 4, 4, 4, 4, 3,
+	3, 3, 3, 2, 2, 2, 2, 2,
+	2, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 2,
+	2, 2, 2, 2, 2, 3, 3, 3,
+	3, 4, 4, 4, 4, 5, 5, 5,
+	6, 6, 6, 7, 7, 7, 8, 8,
+	8, 9, 9, 10, 10, 11, 11, 11,
+	12, 12, 13, 13, 14, 14, 15, 16,
+	16, 17, 17, 18, 19, 19, 20, 21,
+	21, 22, 23, 23, 24, 25, 26, 27,
+	28, 28, 29, 30, 31, 32, 33, 34,
+	35, 37, 38, 39, 40, 41, 43, 44,
+	45, 47, 48, 50, 52, 53, 55, 57,
+	59, 61, 63, 65, 67, 70, 72, 75,
+	78, 81, 85, 88, 92, 97, 102, 107,
+	113, 120, 129, 139, 152, 171, 203, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+};
+
+/* LFO Table */
+static const int32_t pmtable[PM_PG_WIDTH] = {
+	256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256,
+	257, 257, 257, 257, 257, 257, 257, 257,
+	257, 257, 257, 257, 257, 257, 257, 257,
+	257, 257, 257, 257, 257, 257, 257, 257,
+	257, 257, 257, 257, 257, 257, 257, 258,
+	258, 258, 257, 257, 257, 257, 257, 257,
+	257, 257, 257, 257, 257, 257, 257, 257,
+	257, 257, 257, 257, 257, 257, 257, 257,
+	257, 257, 257, 257, 257, 257, 257, 257,
+	257, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256,
+	256, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	254, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254,
+	253, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254,
+	254, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,
+};
+
+static const int32_t amtable[AM_PG_WIDTH] = {
+	13, 13, 13, 13, 13, 14, 14, 14,
+	14, 14, 15, 15, 15, 15, 15, 16,
+	16, 16, 16, 16, 17, 17, 17, 17,
+	17, 18, 18, 18, 18, 18, 19, 19,
+	19, 19, 19, 20, 20, 20, 20, 20,
+	21, 21, 21, 21, 21, 22, 22, 22,
+	22, 22, 23, 23, 23, 23, 23, 24,
+	24, 24, 24, 24, 25, 25, 25, 25,
+	26, 25, 25, 25, 25, 24, 24, 24,
+	24, 24, 23, 23, 23, 23, 23, 22,
+	22, 22, 22, 22, 21, 21, 21, 21,
+	21, 20, 20, 20, 20, 20, 19, 19,
+	19, 19, 19, 18, 18, 18, 18, 18,
+	17, 17, 17, 17, 17, 16, 16, 16,
+	16, 16, 15, 15, 15, 15, 15, 14,
+	14, 14, 14, 14, 13, 13, 13, 13,
+	13, 12, 12, 12, 12, 11, 11, 11,
+	11, 11, 10, 10, 10, 10, 10, 9,
+	9, 9, 9, 9, 8, 8, 8, 8,
+	8, 7, 7, 7, 7, 7, 6, 6,
+	6, 6, 6, 5, 5, 5, 5, 5,
+	4, 4, 4, 4, 4, 3, 3, 3,
+	3, 3, 2, 2, 2, 2, 2, 1,
+	1, 1, 1, 1, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1, 1, 1,
+	1, 1, 2, 2, 2, 2, 2, 3,
+	3, 3, 3, 3, 4, 4, 4, 4,
+	4, 5, 5, 5, 5, 5, 6, 6,
+	6, 6, 6, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 9, 9, 9,
+	9, 9, 10, 10, 10, 10, 10, 11,
+	11, 11, 11, 11, 12, 12, 12, 12,
+};
+
+/* dB to Liner table */
+static const int16_t DB2LIN_TABLE[(DB_MUTE + DB_MUTE) * 2] = {
+	255, 249, 244, 239, 233, 228, 224, 219,
+	214, 209, 205, 201, 196, 192, 188, 184,
+	180, 176, 172, 169, 165, 162, 158, 155,
+	151, 148, 145, 142, 139, 136, 133, 130,
+	127, 125, 122, 119, 117, 114, 112, 109,
+	107, 105, 102, 100, 98, 96, 94, 92,
+	90, 88, 86, 84, 82, 81, 79, 77,
+	76, 74, 72, 71, 69, 68, 66, 65,
+	64, 62, 61, 60, 58, 57, 56, 55,
+	53, 52, 51, 50, 49, 48, 47, 46,
+	45, 44, 43, 42, 41, 40, 39, 38,
+	38, 37, 36, 35, 34, 34, 33, 32,
+	32, 31, 30, 30, 29, 28, 28, 27,
+	27, 26, 25, 25, 24, 24, 23, 23,
+	22, 22, 21, 21, 20, 20, 19, 19,
+	19, 18, 18, 17, 17, 17, 16, 16,
+	16, 15, 15, 15, 14, 14, 14, 13,
+	13, 13, 12, 12, 12, 12, 11, 11,
+	11, 11, 10, 10, 10, 10, 10, 9,
+	9, 9, 9, 8, 8, 8, 8, 8,
+	8, 7, 7, 7, 7, 7, 7, 6,
+	6, 6, 6, 6, 6, 6, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 4,
+	4, 4, 4, 4, 4, 4, 4, 4,
+	4, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	-255, -249, -244, -239, -233, -228, -224, -219,
+	-214, -209, -205, -201, -196, -192, -188, -184,
+	-180, -176, -172, -169, -165, -162, -158, -155,
+	-151, -148, -145, -142, -139, -136, -133, -130,
+	-127, -125, -122, -119, -117, -114, -112, -109,
+	-107, -105, -102, -100, -98, -96, -94, -92,
+	-90, -88, -86, -84, -82, -81, -79, -77,
+	-76, -74, -72, -71, -69, -68, -66, -65,
+	-64, -62, -61, -60, -58, -57, -56, -55,
+	-53, -52, -51, -50, -49, -48, -47, -46,
+	-45, -44, -43, -42, -41, -40, -39, -38,
+	-38, -37, -36, -35, -34, -34, -33, -32,
+	-32, -31, -30, -30, -29, -28, -28, -27,
+	-27, -26, -25, -25, -24, -24, -23, -23,
+	-22, -22, -21, -21, -20, -20, -19, -19,
+	-19, -18, -18, -17, -17, -17, -16, -16,
+	-16, -15, -15, -15, -14, -14, -14, -13,
+	-13, -13, -12, -12, -12, -12, -11, -11,
+	-11, -11, -10, -10, -10, -10, -10, -9,
+	-9, -9, -9, -8, -8, -8, -8, -8,
+	-8, -7, -7, -7, -7, -7, -7, -6,
+	-6, -6, -6, -6, -6, -6, -5, -5,
+	-5, -5, -5, -5, -5, -5, -5, -4,
+	-4, -4, -4, -4, -4, -4, -4, -4,
+	-4, -3, -3, -3, -3, -3, -3, -3,
+	-3, -3, -3, -3, -3, -3, -2, -2,
+	-2, -2, -2, -2, -2, -2, -2, -2,
+	-2, -2, -2, -2, -2, -2, -2, -2,
+	-2, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/* Liner to Log curve conversion table (for Attack rate). */
+static const uint16_t AR_ADJUST_TABLE[1 << EG_BITS] = {
+	127, 127, 108, 98, 90, 84, 80, 75,
+	72, 69, 66, 64, 61, 59, 57, 56,
+	54, 52, 51, 49, 48, 47, 45, 44,
+	43, 42, 41, 40, 39, 38, 37, 36,
+	36, 35, 34, 33, 33, 32, 31, 30,
+	30, 29, 29, 28, 27, 27, 26, 26,
+	25, 24, 24, 23, 23, 22, 22, 21,
+	21, 21, 20, 20, 19, 19, 18, 18,
+	17, 17, 17, 16, 16, 15, 15, 15,
+	14, 14, 14, 13, 13, 13, 12, 12,
+	12, 11, 11, 11, 10, 10, 10, 9,
+	9, 9, 9, 8, 8, 8, 7, 7,
+	7, 7, 6, 6, 6, 6, 5, 5,
+	5, 4, 4, 4, 4, 4, 3, 3,
+	3, 3, 2, 2, 2, 2, 1, 1,
+	1, 1, 1, 0, 0, 0, 0, 0,
+};
+
+/* KSL + TL Table */
+static const uint32_t tllTable[16][8][1 << TL_BITS][4] = {
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+},
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 2, 8, 16}, {2, 4, 10, 18}, {4, 6, 12, 20}, {6, 8, 14, 22},
+	{8, 10, 16, 24}, {10, 12, 18, 26}, {12, 14, 20, 28}, {14, 16, 22, 30},
+	{16, 18, 24, 32}, {18, 20, 26, 34}, {20, 22, 28, 36}, {22, 24, 30, 38},
+	{24, 26, 32, 40}, {26, 28, 34, 42}, {28, 30, 36, 44}, {30, 32, 38, 46},
+	{32, 34, 40, 48}, {34, 36, 42, 50}, {36, 38, 44, 52}, {38, 40, 46, 54},
+	{40, 42, 48, 56}, {42, 44, 50, 58}, {44, 46, 52, 60}, {46, 48, 54, 62},
+	{48, 50, 56, 64}, {50, 52, 58, 66}, {52, 54, 60, 68}, {54, 56, 62, 70},
+	{56, 58, 64, 72}, {58, 60, 66, 74}, {60, 62, 68, 76}, {62, 64, 70, 78},
+	{64, 66, 72, 80}, {66, 68, 74, 82}, {68, 70, 76, 84}, {70, 72, 78, 86},
+	{72, 74, 80, 88}, {74, 76, 82, 90}, {76, 78, 84, 92}, {78, 80, 86, 94},
+	{80, 82, 88, 96}, {82, 84, 90, 98}, {84, 86, 92, 100}, {86, 88, 94, 102},
+	{88, 90, 96, 104}, {90, 92, 98, 106}, {92, 94, 100, 108}, {94, 96, 102, 110},
+	{96, 98, 104, 112}, {98, 100, 106, 114}, {100, 102, 108, 116}, {102, 104, 110, 118},
+	{104, 106, 112, 120}, {106, 108, 114, 122}, {108, 110, 116, 124}, {110, 112, 118, 126},
+	{112, 114, 120, 128}, {114, 116, 122, 130}, {116, 118, 124, 132}, {118, 120, 126, 134},
+	{120, 122, 128, 136}, {122, 124, 130, 138}, {124, 126, 132, 140}, {126, 128, 134, 142},
+},
+{
+	{0, 8, 16, 32}, {2, 10, 18, 34}, {4, 12, 20, 36}, {6, 14, 22, 38},
+	{8, 16, 24, 40}, {10, 18, 26, 42}, {12, 20, 28, 44}, {14, 22, 30, 46},
+	{16, 24, 32, 48}, {18, 26, 34, 50}, {20, 28, 36, 52}, {22, 30, 38, 54},
+	{24, 32, 40, 56}, {26, 34, 42, 58}, {28, 36, 44, 60}, {30, 38, 46, 62},
+	{32, 40, 48, 64}, {34, 42, 50, 66}, {36, 44, 52, 68}, {38, 46, 54, 70},
+	{40, 48, 56, 72}, {42, 50, 58, 74}, {44, 52, 60, 76}, {46, 54, 62, 78},
+	{48, 56, 64, 80}, {50, 58, 66, 82}, {52, 60, 68, 84}, {54, 62, 70, 86},
+	{56, 64, 72, 88}, {58, 66, 74, 90}, {60, 68, 76, 92}, {62, 70, 78, 94},
+	{64, 72, 80, 96}, {66, 74, 82, 98}, {68, 76, 84, 100}, {70, 78, 86, 102},
+	{72, 80, 88, 104}, {74, 82, 90, 106}, {76, 84, 92, 108}, {78, 86, 94, 110},
+	{80, 88, 96, 112}, {82, 90, 98, 114}, {84, 92, 100, 116}, {86, 94, 102, 118},
+	{88, 96, 104, 120}, {90, 98, 106, 122}, {92, 100, 108, 124}, {94, 102, 110, 126},
+	{96, 104, 112, 128}, {98, 106, 114, 130}, {100, 108, 116, 132}, {102, 110, 118, 134},
+	{104, 112, 120, 136}, {106, 114, 122, 138}, {108, 116, 124, 140}, {110, 118, 126, 142},
+	{112, 120, 128, 144}, {114, 122, 130, 146}, {116, 124, 132, 148}, {118, 126, 134, 150},
+	{120, 128, 136, 152}, {122, 130, 138, 154}, {124, 132, 140, 156}, {126, 134, 142, 158},
+},
+{
+	{0, 10, 24, 48}, {2, 12, 26, 50}, {4, 14, 28, 52}, {6, 16, 30, 54},
+	{8, 18, 32, 56}, {10, 20, 34, 58}, {12, 22, 36, 60}, {14, 24, 38, 62},
+	{16, 26, 40, 64}, {18, 28, 42, 66}, {20, 30, 44, 68}, {22, 32, 46, 70},
+	{24, 34, 48, 72}, {26, 36, 50, 74}, {28, 38, 52, 76}, {30, 40, 54, 78},
+	{32, 42, 56, 80}, {34, 44, 58, 82}, {36, 46, 60, 84}, {38, 48, 62, 86},
+	{40, 50, 64, 88}, {42, 52, 66, 90}, {44, 54, 68, 92}, {46, 56, 70, 94},
+	{48, 58, 72, 96}, {50, 60, 74, 98}, {52, 62, 76, 100}, {54, 64, 78, 102},
+	{56, 66, 80, 104}, {58, 68, 82, 106}, {60, 70, 84, 108}, {62, 72, 86, 110},
+	{64, 74, 88, 112}, {66, 76, 90, 114}, {68, 78, 92, 116}, {70, 80, 94, 118},
+	{72, 82, 96, 120}, {74, 84, 98, 122}, {76, 86, 100, 124}, {78, 88, 102, 126},
+	{80, 90, 104, 128}, {82, 92, 106, 130}, {84, 94, 108, 132}, {86, 96, 110, 134},
+	{88, 98, 112, 136}, {90, 100, 114, 138}, {92, 102, 116, 140}, {94, 104, 118, 142},
+	{96, 106, 120, 144}, {98, 108, 122, 146}, {100, 110, 124, 148}, {102, 112, 126, 150},
+	{104, 114, 128, 152}, {106, 116, 130, 154}, {108, 118, 132, 156}, {110, 120, 134, 158},
+	{112, 122, 136, 160}, {114, 124, 138, 162}, {116, 126, 140, 164}, {118, 128, 142, 166},
+	{120, 130, 144, 168}, {122, 132, 146, 170}, {124, 134, 148, 172}, {126, 136, 150, 174},
+},
+},
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 2, 8, 16}, {2, 4, 10, 18}, {4, 6, 12, 20}, {6, 8, 14, 22},
+	{8, 10, 16, 24}, {10, 12, 18, 26}, {12, 14, 20, 28}, {14, 16, 22, 30},
+	{16, 18, 24, 32}, {18, 20, 26, 34}, {20, 22, 28, 36}, {22, 24, 30, 38},
+	{24, 26, 32, 40}, {26, 28, 34, 42}, {28, 30, 36, 44}, {30, 32, 38, 46},
+	{32, 34, 40, 48}, {34, 36, 42, 50}, {36, 38, 44, 52}, {38, 40, 46, 54},
+	{40, 42, 48, 56}, {42, 44, 50, 58}, {44, 46, 52, 60}, {46, 48, 54, 62},
+	{48, 50, 56, 64}, {50, 52, 58, 66}, {52, 54, 60, 68}, {54, 56, 62, 70},
+	{56, 58, 64, 72}, {58, 60, 66, 74}, {60, 62, 68, 76}, {62, 64, 70, 78},
+	{64, 66, 72, 80}, {66, 68, 74, 82}, {68, 70, 76, 84}, {70, 72, 78, 86},
+	{72, 74, 80, 88}, {74, 76, 82, 90}, {76, 78, 84, 92}, {78, 80, 86, 94},
+	{80, 82, 88, 96}, {82, 84, 90, 98}, {84, 86, 92, 100}, {86, 88, 94, 102},
+	{88, 90, 96, 104}, {90, 92, 98, 106}, {92, 94, 100, 108}, {94, 96, 102, 110},
+	{96, 98, 104, 112}, {98, 100, 106, 114}, {100, 102, 108, 116}, {102, 104, 110, 118},
+	{104, 106, 112, 120}, {106, 108, 114, 122}, {108, 110, 116, 124}, {110, 112, 118, 126},
+	{112, 114, 120, 128}, {114, 116, 122, 130}, {116, 118, 124, 132}, {118, 120, 126, 134},
+	{120, 122, 128, 136}, {122, 124, 130, 138}, {124, 126, 132, 140}, {126, 128, 134, 142},
+},
+{
+	{0, 8, 16, 32}, {2, 10, 18, 34}, {4, 12, 20, 36}, {6, 14, 22, 38},
+	{8, 16, 24, 40}, {10, 18, 26, 42}, {12, 20, 28, 44}, {14, 22, 30, 46},
+	{16, 24, 32, 48}, {18, 26, 34, 50}, {20, 28, 36, 52}, {22, 30, 38, 54},
+	{24, 32, 40, 56}, {26, 34, 42, 58}, {28, 36, 44, 60}, {30, 38, 46, 62},
+	{32, 40, 48, 64}, {34, 42, 50, 66}, {36, 44, 52, 68}, {38, 46, 54, 70},
+	{40, 48, 56, 72}, {42, 50, 58, 74}, {44, 52, 60, 76}, {46, 54, 62, 78},
+	{48, 56, 64, 80}, {50, 58, 66, 82}, {52, 60, 68, 84}, {54, 62, 70, 86},
+	{56, 64, 72, 88}, {58, 66, 74, 90}, {60, 68, 76, 92}, {62, 70, 78, 94},
+	{64, 72, 80, 96}, {66, 74, 82, 98}, {68, 76, 84, 100}, {70, 78, 86, 102},
+	{72, 80, 88, 104}, {74, 82, 90, 106}, {76, 84, 92, 108}, {78, 86, 94, 110},
+	{80, 88, 96, 112}, {82, 90, 98, 114}, {84, 92, 100, 116}, {86, 94, 102, 118},
+	{88, 96, 104, 120}, {90, 98, 106, 122}, {92, 100, 108, 124}, {94, 102, 110, 126},
+	{96, 104, 112, 128}, {98, 106, 114, 130}, {100, 108, 116, 132}, {102, 110, 118, 134},
+	{104, 112, 120, 136}, {106, 114, 122, 138}, {108, 116, 124, 140}, {110, 118, 126, 142},
+	{112, 120, 128, 144}, {114, 122, 130, 146}, {116, 124, 132, 148}, {118, 126, 134, 150},
+	{120, 128, 136, 152}, {122, 130, 138, 154}, {124, 132, 140, 156}, {126, 134, 142, 158},
+},
+{
+	{0, 10, 24, 48}, {2, 12, 26, 50}, {4, 14, 28, 52}, {6, 16, 30, 54},
+	{8, 18, 32, 56}, {10, 20, 34, 58}, {12, 22, 36, 60}, {14, 24, 38, 62},
+	{16, 26, 40, 64}, {18, 28, 42, 66}, {20, 30, 44, 68}, {22, 32, 46, 70},
+	{24, 34, 48, 72}, {26, 36, 50, 74}, {28, 38, 52, 76}, {30, 40, 54, 78},
+	{32, 42, 56, 80}, {34, 44, 58, 82}, {36, 46, 60, 84}, {38, 48, 62, 86},
+	{40, 50, 64, 88}, {42, 52, 66, 90}, {44, 54, 68, 92}, {46, 56, 70, 94},
+	{48, 58, 72, 96}, {50, 60, 74, 98}, {52, 62, 76, 100}, {54, 64, 78, 102},
+	{56, 66, 80, 104}, {58, 68, 82, 106}, {60, 70, 84, 108}, {62, 72, 86, 110},
+	{64, 74, 88, 112}, {66, 76, 90, 114}, {68, 78, 92, 116}, {70, 80, 94, 118},
+	{72, 82, 96, 120}, {74, 84, 98, 122}, {76, 86, 100, 124}, {78, 88, 102, 126},
+	{80, 90, 104, 128}, {82, 92, 106, 130}, {84, 94, 108, 132}, {86, 96, 110, 134},
+	{88, 98, 112, 136}, {90, 100, 114, 138}, {92, 102, 116, 140}, {94, 104, 118, 142},
+	{96, 106, 120, 144}, {98, 108, 122, 146}, {100, 110, 124, 148}, {102, 112, 126, 150},
+	{104, 114, 128, 152}, {106, 116, 130, 154}, {108, 118, 132, 156}, {110, 120, 134, 158},
+	{112, 122, 136, 160}, {114, 124, 138, 162}, {116, 126, 140, 164}, {118, 128, 142, 166},
+	{120, 130, 144, 168}, {122, 132, 146, 170}, {124, 134, 148, 172}, {126, 136, 150, 174},
+},
+{
+	{0, 16, 32, 64}, {2, 18, 34, 66}, {4, 20, 36, 68}, {6, 22, 38, 70},
+	{8, 24, 40, 72}, {10, 26, 42, 74}, {12, 28, 44, 76}, {14, 30, 46, 78},
+	{16, 32, 48, 80}, {18, 34, 50, 82}, {20, 36, 52, 84}, {22, 38, 54, 86},
+	{24, 40, 56, 88}, {26, 42, 58, 90}, {28, 44, 60, 92}, {30, 46, 62, 94},
+	{32, 48, 64, 96}, {34, 50, 66, 98}, {36, 52, 68, 100}, {38, 54, 70, 102},
+	{40, 56, 72, 104}, {42, 58, 74, 106}, {44, 60, 76, 108}, {46, 62, 78, 110},
+	{48, 64, 80, 112}, {50, 66, 82, 114}, {52, 68, 84, 116}, {54, 70, 86, 118},
+	{56, 72, 88, 120}, {58, 74, 90, 122}, {60, 76, 92, 124}, {62, 78, 94, 126},
+	{64, 80, 96, 128}, {66, 82, 98, 130}, {68, 84, 100, 132}, {70, 86, 102, 134},
+	{72, 88, 104, 136}, {74, 90, 106, 138}, {76, 92, 108, 140}, {78, 94, 110, 142},
+	{80, 96, 112, 144}, {82, 98, 114, 146}, {84, 100, 116, 148}, {86, 102, 118, 150},
+	{88, 104, 120, 152}, {90, 106, 122, 154}, {92, 108, 124, 156}, {94, 110, 126, 158},
+	{96, 112, 128, 160}, {98, 114, 130, 162}, {100, 116, 132, 164}, {102, 118, 134, 166},
+	{104, 120, 136, 168}, {106, 122, 138, 170}, {108, 124, 140, 172}, {110, 126, 142, 174},
+	{112, 128, 144, 176}, {114, 130, 146, 178}, {116, 132, 148, 180}, {118, 134, 150, 182},
+	{120, 136, 152, 184}, {122, 138, 154, 186}, {124, 140, 156, 188}, {126, 142, 158, 190},
+},
+},
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 2, 8}, {2, 2, 4, 10}, {4, 4, 6, 12}, {6, 6, 8, 14},
+	{8, 8, 10, 16}, {10, 10, 12, 18}, {12, 12, 14, 20}, {14, 14, 16, 22},
+	{16, 16, 18, 24}, {18, 18, 20, 26}, {20, 20, 22, 28}, {22, 22, 24, 30},
+	{24, 24, 26, 32}, {26, 26, 28, 34}, {28, 28, 30, 36}, {30, 30, 32, 38},
+	{32, 32, 34, 40}, {34, 34, 36, 42}, {36, 36, 38, 44}, {38, 38, 40, 46},
+	{40, 40, 42, 48}, {42, 42, 44, 50}, {44, 44, 46, 52}, {46, 46, 48, 54},
+	{48, 48, 50, 56}, {50, 50, 52, 58}, {52, 52, 54, 60}, {54, 54, 56, 62},
+	{56, 56, 58, 64}, {58, 58, 60, 66}, {60, 60, 62, 68}, {62, 62, 64, 70},
+	{64, 64, 66, 72}, {66, 66, 68, 74}, {68, 68, 70, 76}, {70, 70, 72, 78},
+	{72, 72, 74, 80}, {74, 74, 76, 82}, {76, 76, 78, 84}, {78, 78, 80, 86},
+	{80, 80, 82, 88}, {82, 82, 84, 90}, {84, 84, 86, 92}, {86, 86, 88, 94},
+	{88, 88, 90, 96}, {90, 90, 92, 98}, {92, 92, 94, 100}, {94, 94, 96, 102},
+	{96, 96, 98, 104}, {98, 98, 100, 106}, {100, 100, 102, 108}, {102, 102, 104, 110},
+	{104, 104, 106, 112}, {106, 106, 108, 114}, {108, 108, 110, 116}, {110, 110, 112, 118},
+	{112, 112, 114, 120}, {114, 114, 116, 122}, {116, 116, 118, 124}, {118, 118, 120, 126},
+	{120, 120, 122, 128}, {122, 122, 124, 130}, {124, 124, 126, 132}, {126, 126, 128, 134},
+},
+{
+	{0, 5, 10, 24}, {2, 7, 12, 26}, {4, 9, 14, 28}, {6, 11, 16, 30},
+	{8, 13, 18, 32}, {10, 15, 20, 34}, {12, 17, 22, 36}, {14, 19, 24, 38},
+	{16, 21, 26, 40}, {18, 23, 28, 42}, {20, 25, 30, 44}, {22, 27, 32, 46},
+	{24, 29, 34, 48}, {26, 31, 36, 50}, {28, 33, 38, 52}, {30, 35, 40, 54},
+	{32, 37, 42, 56}, {34, 39, 44, 58}, {36, 41, 46, 60}, {38, 43, 48, 62},
+	{40, 45, 50, 64}, {42, 47, 52, 66}, {44, 49, 54, 68}, {46, 51, 56, 70},
+	{48, 53, 58, 72}, {50, 55, 60, 74}, {52, 57, 62, 76}, {54, 59, 64, 78},
+	{56, 61, 66, 80}, {58, 63, 68, 82}, {60, 65, 70, 84}, {62, 67, 72, 86},
+	{64, 69, 74, 88}, {66, 71, 76, 90}, {68, 73, 78, 92}, {70, 75, 80, 94},
+	{72, 77, 82, 96}, {74, 79, 84, 98}, {76, 81, 86, 100}, {78, 83, 88, 102},
+	{80, 85, 90, 104}, {82, 87, 92, 106}, {84, 89, 94, 108}, {86, 91, 96, 110},
+	{88, 93, 98, 112}, {90, 95, 100, 114}, {92, 97, 102, 116}, {94, 99, 104, 118},
+	{96, 101, 106, 120}, {98, 103, 108, 122}, {100, 105, 110, 124}, {102, 107, 112, 126},
+	{104, 109, 114, 128}, {106, 111, 116, 130}, {108, 113, 118, 132}, {110, 115, 120, 134},
+	{112, 117, 122, 136}, {114, 119, 124, 138}, {116, 121, 126, 140}, {118, 123, 128, 142},
+	{120, 125, 130, 144}, {122, 127, 132, 146}, {124, 129, 134, 148}, {126, 131, 136, 150},
+},
+{
+	{0, 8, 18, 40}, {2, 10, 20, 42}, {4, 12, 22, 44}, {6, 14, 24, 46},
+	{8, 16, 26, 48}, {10, 18, 28, 50}, {12, 20, 30, 52}, {14, 22, 32, 54},
+	{16, 24, 34, 56}, {18, 26, 36, 58}, {20, 28, 38, 60}, {22, 30, 40, 62},
+	{24, 32, 42, 64}, {26, 34, 44, 66}, {28, 36, 46, 68}, {30, 38, 48, 70},
+	{32, 40, 50, 72}, {34, 42, 52, 74}, {36, 44, 54, 76}, {38, 46, 56, 78},
+	{40, 48, 58, 80}, {42, 50, 60, 82}, {44, 52, 62, 84}, {46, 54, 64, 86},
+	{48, 56, 66, 88}, {50, 58, 68, 90}, {52, 60, 70, 92}, {54, 62, 72, 94},
+	{56, 64, 74, 96}, {58, 66, 76, 98}, {60, 68, 78, 100}, {62, 70, 80, 102},
+	{64, 72, 82, 104}, {66, 74, 84, 106}, {68, 76, 86, 108}, {70, 78, 88, 110},
+	{72, 80, 90, 112}, {74, 82, 92, 114}, {76, 84, 94, 116}, {78, 86, 96, 118},
+	{80, 88, 98, 120}, {82, 90, 100, 122}, {84, 92, 102, 124}, {86, 94, 104, 126},
+	{88, 96, 106, 128}, {90, 98, 108, 130}, {92, 100, 110, 132}, {94, 102, 112, 134},
+	{96, 104, 114, 136}, {98, 106, 116, 138}, {100, 108, 118, 140}, {102, 110, 120, 142},
+	{104, 112, 122, 144}, {106, 114, 124, 146}, {108, 116, 126, 148}, {110, 118, 128, 150},
+	{112, 120, 130, 152}, {114, 122, 132, 154}, {116, 124, 134, 156}, {118, 126, 136, 158},
+	{120, 128, 138, 160}, {122, 130, 140, 162}, {124, 132, 142, 164}, {126, 134, 144, 166},
+},
+{
+	{0, 13, 26, 56}, {2, 15, 28, 58}, {4, 17, 30, 60}, {6, 19, 32, 62},
+	{8, 21, 34, 64}, {10, 23, 36, 66}, {12, 25, 38, 68}, {14, 27, 40, 70},
+	{16, 29, 42, 72}, {18, 31, 44, 74}, {20, 33, 46, 76}, {22, 35, 48, 78},
+	{24, 37, 50, 80}, {26, 39, 52, 82}, {28, 41, 54, 84}, {30, 43, 56, 86},
+	{32, 45, 58, 88}, {34, 47, 60, 90}, {36, 49, 62, 92}, {38, 51, 64, 94},
+	{40, 53, 66, 96}, {42, 55, 68, 98}, {44, 57, 70, 100}, {46, 59, 72, 102},
+	{48, 61, 74, 104}, {50, 63, 76, 106}, {52, 65, 78, 108}, {54, 67, 80, 110},
+	{56, 69, 82, 112}, {58, 71, 84, 114}, {60, 73, 86, 116}, {62, 75, 88, 118},
+	{64, 77, 90, 120}, {66, 79, 92, 122}, {68, 81, 94, 124}, {70, 83, 96, 126},
+	{72, 85, 98, 128}, {74, 87, 100, 130}, {76, 89, 102, 132}, {78, 91, 104, 134},
+	{80, 93, 106, 136}, {82, 95, 108, 138}, {84, 97, 110, 140}, {86, 99, 112, 142},
+	{88, 101, 114, 144}, {90, 103, 116, 146}, {92, 105, 118, 148}, {94, 107, 120, 150},
+	{96, 109, 122, 152}, {98, 111, 124, 154}, {100, 113, 126, 156}, {102, 115, 128, 158},
+	{104, 117, 130, 160}, {106, 119, 132, 162}, {108, 121, 134, 164}, {110, 123, 136, 166},
+	{112, 125, 138, 168}, {114, 127, 140, 170}, {116, 129, 142, 172}, {118, 131, 144, 174},
+	{120, 133, 146, 176}, {122, 135, 148, 178}, {124, 137, 150, 180}, {126, 139, 152, 182},
+},
+{
+	{0, 16, 34, 72}, {2, 18, 36, 74}, {4, 20, 38, 76}, {6, 22, 40, 78},
+	{8, 24, 42, 80}, {10, 26, 44, 82}, {12, 28, 46, 84}, {14, 30, 48, 86},
+	{16, 32, 50, 88}, {18, 34, 52, 90}, {20, 36, 54, 92}, {22, 38, 56, 94},
+	{24, 40, 58, 96}, {26, 42, 60, 98}, {28, 44, 62, 100}, {30, 46, 64, 102},
+	{32, 48, 66, 104}, {34, 50, 68, 106}, {36, 52, 70, 108}, {38, 54, 72, 110},
+	{40, 56, 74, 112}, {42, 58, 76, 114}, {44, 60, 78, 116}, {46, 62, 80, 118},
+	{48, 64, 82, 120}, {50, 66, 84, 122}, {52, 68, 86, 124}, {54, 70, 88, 126},
+	{56, 72, 90, 128}, {58, 74, 92, 130}, {60, 76, 94, 132}, {62, 78, 96, 134},
+	{64, 80, 98, 136}, {66, 82, 100, 138}, {68, 84, 102, 140}, {70, 86, 104, 142},
+	{72, 88, 106, 144}, {74, 90, 108, 146}, {76, 92, 110, 148}, {78, 94, 112, 150},
+	{80, 96, 114, 152}, {82, 98, 116, 154}, {84, 100, 118, 156}, {86, 102, 120, 158},
+	{88, 104, 122, 160}, {90, 106, 124, 162}, {92, 108, 126, 164}, {94, 110, 128, 166},
+	{96, 112, 130, 168}, {98, 114, 132, 170}, {100, 116, 134, 172}, {102, 118, 136, 174},
+	{104, 120, 138, 176}, {106, 122, 140, 178}, {108, 124, 142, 180}, {110, 126, 144, 182},
+	{112, 128, 146, 184}, {114, 130, 148, 186}, {116, 132, 150, 188}, {118, 134, 152, 190},
+	{120, 136, 154, 192}, {122, 138, 156, 194}, {124, 140, 158, 196}, {126, 142, 160, 198},
+},
+},
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 2, 8, 16}, {2, 4, 10, 18}, {4, 6, 12, 20}, {6, 8, 14, 22},
+	{8, 10, 16, 24}, {10, 12, 18, 26}, {12, 14, 20, 28}, {14, 16, 22, 30},
+	{16, 18, 24, 32}, {18, 20, 26, 34}, {20, 22, 28, 36}, {22, 24, 30, 38},
+	{24, 26, 32, 40}, {26, 28, 34, 42}, {28, 30, 36, 44}, {30, 32, 38, 46},
+	{32, 34, 40, 48}, {34, 36, 42, 50}, {36, 38, 44, 52}, {38, 40, 46, 54},
+	{40, 42, 48, 56}, {42, 44, 50, 58}, {44, 46, 52, 60}, {46, 48, 54, 62},
+	{48, 50, 56, 64}, {50, 52, 58, 66}, {52, 54, 60, 68}, {54, 56, 62, 70},
+	{56, 58, 64, 72}, {58, 60, 66, 74}, {60, 62, 68, 76}, {62, 64, 70, 78},
+	{64, 66, 72, 80}, {66, 68, 74, 82}, {68, 70, 76, 84}, {70, 72, 78, 86},
+	{72, 74, 80, 88}, {74, 76, 82, 90}, {76, 78, 84, 92}, {78, 80, 86, 94},
+	{80, 82, 88, 96}, {82, 84, 90, 98}, {84, 86, 92, 100}, {86, 88, 94, 102},
+	{88, 90, 96, 104}, {90, 92, 98, 106}, {92, 94, 100, 108}, {94, 96, 102, 110},
+	{96, 98, 104, 112}, {98, 100, 106, 114}, {100, 102, 108, 116}, {102, 104, 110, 118},
+	{104, 106, 112, 120}, {106, 108, 114, 122}, {108, 110, 116, 124}, {110, 112, 118, 126},
+	{112, 114, 120, 128}, {114, 116, 122, 130}, {116, 118, 124, 132}, {118, 120, 126, 134},
+	{120, 122, 128, 136}, {122, 124, 130, 138}, {124, 126, 132, 140}, {126, 128, 134, 142},
+},
+{
+	{0, 8, 16, 32}, {2, 10, 18, 34}, {4, 12, 20, 36}, {6, 14, 22, 38},
+	{8, 16, 24, 40}, {10, 18, 26, 42}, {12, 20, 28, 44}, {14, 22, 30, 46},
+	{16, 24, 32, 48}, {18, 26, 34, 50}, {20, 28, 36, 52}, {22, 30, 38, 54},
+	{24, 32, 40, 56}, {26, 34, 42, 58}, {28, 36, 44, 60}, {30, 38, 46, 62},
+	{32, 40, 48, 64}, {34, 42, 50, 66}, {36, 44, 52, 68}, {38, 46, 54, 70},
+	{40, 48, 56, 72}, {42, 50, 58, 74}, {44, 52, 60, 76}, {46, 54, 62, 78},
+	{48, 56, 64, 80}, {50, 58, 66, 82}, {52, 60, 68, 84}, {54, 62, 70, 86},
+	{56, 64, 72, 88}, {58, 66, 74, 90}, {60, 68, 76, 92}, {62, 70, 78, 94},
+	{64, 72, 80, 96}, {66, 74, 82, 98}, {68, 76, 84, 100}, {70, 78, 86, 102},
+	{72, 80, 88, 104}, {74, 82, 90, 106}, {76, 84, 92, 108}, {78, 86, 94, 110},
+	{80, 88, 96, 112}, {82, 90, 98, 114}, {84, 92, 100, 116}, {86, 94, 102, 118},
+	{88, 96, 104, 120}, {90, 98, 106, 122}, {92, 100, 108, 124}, {94, 102, 110, 126},
+	{96, 104, 112, 128}, {98, 106, 114, 130}, {100, 108, 116, 132}, {102, 110, 118, 134},
+	{104, 112, 120, 136}, {106, 114, 122, 138}, {108, 116, 124, 140}, {110, 118, 126, 142},
+	{112, 120, 128, 144}, {114, 122, 130, 146}, {116, 124, 132, 148}, {118, 126, 134, 150},
+	{120, 128, 136, 152}, {122, 130, 138, 154}, {124, 132, 140, 156}, {126, 134, 142, 158},
+},
+{
+	{0, 10, 24, 48}, {2, 12, 26, 50}, {4, 14, 28, 52}, {6, 16, 30, 54},
+	{8, 18, 32, 56}, {10, 20, 34, 58}, {12, 22, 36, 60}, {14, 24, 38, 62},
+	{16, 26, 40, 64}, {18, 28, 42, 66}, {20, 30, 44, 68}, {22, 32, 46, 70},
+	{24, 34, 48, 72}, {26, 36, 50, 74}, {28, 38, 52, 76}, {30, 40, 54, 78},
+	{32, 42, 56, 80}, {34, 44, 58, 82}, {36, 46, 60, 84}, {38, 48, 62, 86},
+	{40, 50, 64, 88}, {42, 52, 66, 90}, {44, 54, 68, 92}, {46, 56, 70, 94},
+	{48, 58, 72, 96}, {50, 60, 74, 98}, {52, 62, 76, 100}, {54, 64, 78, 102},
+	{56, 66, 80, 104}, {58, 68, 82, 106}, {60, 70, 84, 108}, {62, 72, 86, 110},
+	{64, 74, 88, 112}, {66, 76, 90, 114}, {68, 78, 92, 116}, {70, 80, 94, 118},
+	{72, 82, 96, 120}, {74, 84, 98, 122}, {76, 86, 100, 124}, {78, 88, 102, 126},
+	{80, 90, 104, 128}, {82, 92, 106, 130}, {84, 94, 108, 132}, {86, 96, 110, 134},
+	{88, 98, 112, 136}, {90, 100, 114, 138}, {92, 102, 116, 140}, {94, 104, 118, 142},
+	{96, 106, 120, 144}, {98, 108, 122, 146}, {100, 110, 124, 148}, {102, 112, 126, 150},
+	{104, 114, 128, 152}, {106, 116, 130, 154}, {108, 118, 132, 156}, {110, 120, 134, 158},
+	{112, 122, 136, 160}, {114, 124, 138, 162}, {116, 126, 140, 164}, {118, 128, 142, 166},
+	{120, 130, 144, 168}, {122, 132, 146, 170}, {124, 134, 148, 172}, {126, 136, 150, 174},
+},
+{
+	{0, 16, 32, 64}, {2, 18, 34, 66}, {4, 20, 36, 68}, {6, 22, 38, 70},
+	{8, 24, 40, 72}, {10, 26, 42, 74}, {12, 28, 44, 76}, {14, 30, 46, 78},
+	{16, 32, 48, 80}, {18, 34, 50, 82}, {20, 36, 52, 84}, {22, 38, 54, 86},
+	{24, 40, 56, 88}, {26, 42, 58, 90}, {28, 44, 60, 92}, {30, 46, 62, 94},
+	{32, 48, 64, 96}, {34, 50, 66, 98}, {36, 52, 68, 100}, {38, 54, 70, 102},
+	{40, 56, 72, 104}, {42, 58, 74, 106}, {44, 60, 76, 108}, {46, 62, 78, 110},
+	{48, 64, 80, 112}, {50, 66, 82, 114}, {52, 68, 84, 116}, {54, 70, 86, 118},
+	{56, 72, 88, 120}, {58, 74, 90, 122}, {60, 76, 92, 124}, {62, 78, 94, 126},
+	{64, 80, 96, 128}, {66, 82, 98, 130}, {68, 84, 100, 132}, {70, 86, 102, 134},
+	{72, 88, 104, 136}, {74, 90, 106, 138}, {76, 92, 108, 140}, {78, 94, 110, 142},
+	{80, 96, 112, 144}, {82, 98, 114, 146}, {84, 100, 116, 148}, {86, 102, 118, 150},
+	{88, 104, 120, 152}, {90, 106, 122, 154}, {92, 108, 124, 156}, {94, 110, 126, 158},
+	{96, 112, 128, 160}, {98, 114, 130, 162}, {100, 116, 132, 164}, {102, 118, 134, 166},
+	{104, 120, 136, 168}, {106, 122, 138, 170}, {108, 124, 140, 172}, {110, 126, 142, 174},
+	{112, 128, 144, 176}, {114, 130, 146, 178}, {116, 132, 148, 180}, {118, 134, 150, 182},
+	{120, 136, 152, 184}, {122, 138, 154, 186}, {124, 140, 156, 188}, {126, 142, 158, 190},
+},
+{
+	{0, 18, 40, 80}, {2, 20, 42, 82}, {4, 22, 44, 84}, {6, 24, 46, 86},
+	{8, 26, 48, 88}, {10, 28, 50, 90}, {12, 30, 52, 92}, {14, 32, 54, 94},
+	{16, 34, 56, 96}, {18, 36, 58, 98}, {20, 38, 60, 100}, {22, 40, 62, 102},
+	{24, 42, 64, 104}, {26, 44, 66, 106}, {28, 46, 68, 108}, {30, 48, 70, 110},
+	{32, 50, 72, 112}, {34, 52, 74, 114}, {36, 54, 76, 116}, {38, 56, 78, 118},
+	{40, 58, 80, 120}, {42, 60, 82, 122}, {44, 62, 84, 124}, {46, 64, 86, 126},
+	{48, 66, 88, 128}, {50, 68, 90, 130}, {52, 70, 92, 132}, {54, 72, 94, 134},
+	{56, 74, 96, 136}, {58, 76, 98, 138}, {60, 78, 100, 140}, {62, 80, 102, 142},
+	{64, 82, 104, 144}, {66, 84, 106, 146}, {68, 86, 108, 148}, {70, 88, 110, 150},
+	{72, 90, 112, 152}, {74, 92, 114, 154}, {76, 94, 116, 156}, {78, 96, 118, 158},
+	{80, 98, 120, 160}, {82, 100, 122, 162}, {84, 102, 124, 164}, {86, 104, 126, 166},
+	{88, 106, 128, 168}, {90, 108, 130, 170}, {92, 110, 132, 172}, {94, 112, 134, 174},
+	{96, 114, 136, 176}, {98, 116, 138, 178}, {100, 118, 140, 180}, {102, 120, 142, 182},
+	{104, 122, 144, 184}, {106, 124, 146, 186}, {108, 126, 148, 188}, {110, 128, 150, 190},
+	{112, 130, 152, 192}, {114, 132, 154, 194}, {116, 134, 156, 196}, {118, 136, 158, 198},
+	{120, 138, 160, 200}, {122, 140, 162, 202}, {124, 142, 164, 204}, {126, 144, 166, 206},
+},
+},
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 2, 5}, {2, 2, 4, 7}, {4, 4, 6, 9}, {6, 6, 8, 11},
+	{8, 8, 10, 13}, {10, 10, 12, 15}, {12, 12, 14, 17}, {14, 14, 16, 19},
+	{16, 16, 18, 21}, {18, 18, 20, 23}, {20, 20, 22, 25}, {22, 22, 24, 27},
+	{24, 24, 26, 29}, {26, 26, 28, 31}, {28, 28, 30, 33}, {30, 30, 32, 35},
+	{32, 32, 34, 37}, {34, 34, 36, 39}, {36, 36, 38, 41}, {38, 38, 40, 43},
+	{40, 40, 42, 45}, {42, 42, 44, 47}, {44, 44, 46, 49}, {46, 46, 48, 51},
+	{48, 48, 50, 53}, {50, 50, 52, 55}, {52, 52, 54, 57}, {54, 54, 56, 59},
+	{56, 56, 58, 61}, {58, 58, 60, 63}, {60, 60, 62, 65}, {62, 62, 64, 67},
+	{64, 64, 66, 69}, {66, 66, 68, 71}, {68, 68, 70, 73}, {70, 70, 72, 75},
+	{72, 72, 74, 77}, {74, 74, 76, 79}, {76, 76, 78, 81}, {78, 78, 80, 83},
+	{80, 80, 82, 85}, {82, 82, 84, 87}, {84, 84, 86, 89}, {86, 86, 88, 91},
+	{88, 88, 90, 93}, {90, 90, 92, 95}, {92, 92, 94, 97}, {94, 94, 96, 99},
+	{96, 96, 98, 101}, {98, 98, 100, 103}, {100, 100, 102, 105}, {102, 102, 104, 107},
+	{104, 104, 106, 109}, {106, 106, 108, 111}, {108, 108, 110, 113}, {110, 110, 112, 115},
+	{112, 112, 114, 117}, {114, 114, 116, 119}, {116, 116, 118, 121}, {118, 118, 120, 123},
+	{120, 120, 122, 125}, {122, 122, 124, 127}, {124, 124, 126, 129}, {126, 126, 128, 131},
+},
+{
+	{0, 5, 10, 21}, {2, 7, 12, 23}, {4, 9, 14, 25}, {6, 11, 16, 27},
+	{8, 13, 18, 29}, {10, 15, 20, 31}, {12, 17, 22, 33}, {14, 19, 24, 35},
+	{16, 21, 26, 37}, {18, 23, 28, 39}, {20, 25, 30, 41}, {22, 27, 32, 43},
+	{24, 29, 34, 45}, {26, 31, 36, 47}, {28, 33, 38, 49}, {30, 35, 40, 51},
+	{32, 37, 42, 53}, {34, 39, 44, 55}, {36, 41, 46, 57}, {38, 43, 48, 59},
+	{40, 45, 50, 61}, {42, 47, 52, 63}, {44, 49, 54, 65}, {46, 51, 56, 67},
+	{48, 53, 58, 69}, {50, 55, 60, 71}, {52, 57, 62, 73}, {54, 59, 64, 75},
+	{56, 61, 66, 77}, {58, 63, 68, 79}, {60, 65, 70, 81}, {62, 67, 72, 83},
+	{64, 69, 74, 85}, {66, 71, 76, 87}, {68, 73, 78, 89}, {70, 75, 80, 91},
+	{72, 77, 82, 93}, {74, 79, 84, 95}, {76, 81, 86, 97}, {78, 83, 88, 99},
+	{80, 85, 90, 101}, {82, 87, 92, 103}, {84, 89, 94, 105}, {86, 91, 96, 107},
+	{88, 93, 98, 109}, {90, 95, 100, 111}, {92, 97, 102, 113}, {94, 99, 104, 115},
+	{96, 101, 106, 117}, {98, 103, 108, 119}, {100, 105, 110, 121}, {102, 107, 112, 123},
+	{104, 109, 114, 125}, {106, 111, 116, 127}, {108, 113, 118, 129}, {110, 115, 120, 131},
+	{112, 117, 122, 133}, {114, 119, 124, 135}, {116, 121, 126, 137}, {118, 123, 128, 139},
+	{120, 125, 130, 141}, {122, 127, 132, 143}, {124, 129, 134, 145}, {126, 131, 136, 147},
+},
+{
+	{0, 8, 18, 37}, {2, 10, 20, 39}, {4, 12, 22, 41}, {6, 14, 24, 43},
+	{8, 16, 26, 45}, {10, 18, 28, 47}, {12, 20, 30, 49}, {14, 22, 32, 51},
+	{16, 24, 34, 53}, {18, 26, 36, 55}, {20, 28, 38, 57}, {22, 30, 40, 59},
+	{24, 32, 42, 61}, {26, 34, 44, 63}, {28, 36, 46, 65}, {30, 38, 48, 67},
+	{32, 40, 50, 69}, {34, 42, 52, 71}, {36, 44, 54, 73}, {38, 46, 56, 75},
+	{40, 48, 58, 77}, {42, 50, 60, 79}, {44, 52, 62, 81}, {46, 54, 64, 83},
+	{48, 56, 66, 85}, {50, 58, 68, 87}, {52, 60, 70, 89}, {54, 62, 72, 91},
+	{56, 64, 74, 93}, {58, 66, 76, 95}, {60, 68, 78, 97}, {62, 70, 80, 99},
+	{64, 72, 82, 101}, {66, 74, 84, 103}, {68, 76, 86, 105}, {70, 78, 88, 107},
+	{72, 80, 90, 109}, {74, 82, 92, 111}, {76, 84, 94, 113}, {78, 86, 96, 115},
+	{80, 88, 98, 117}, {82, 90, 100, 119}, {84, 92, 102, 121}, {86, 94, 104, 123},
+	{88, 96, 106, 125}, {90, 98, 108, 127}, {92, 100, 110, 129}, {94, 102, 112, 131},
+	{96, 104, 114, 133}, {98, 106, 116, 135}, {100, 108, 118, 137}, {102, 110, 120, 139},
+	{104, 112, 122, 141}, {106, 114, 124, 143}, {108, 116, 126, 145}, {110, 118, 128, 147},
+	{112, 120, 130, 149}, {114, 122, 132, 151}, {116, 124, 134, 153}, {118, 126, 136, 155},
+	{120, 128, 138, 157}, {122, 130, 140, 159}, {124, 132, 142, 161}, {126, 134, 144, 163},
+},
+{
+	{0, 13, 26, 53}, {2, 15, 28, 55}, {4, 17, 30, 57}, {6, 19, 32, 59},
+	{8, 21, 34, 61}, {10, 23, 36, 63}, {12, 25, 38, 65}, {14, 27, 40, 67},
+	{16, 29, 42, 69}, {18, 31, 44, 71}, {20, 33, 46, 73}, {22, 35, 48, 75},
+	{24, 37, 50, 77}, {26, 39, 52, 79}, {28, 41, 54, 81}, {30, 43, 56, 83},
+	{32, 45, 58, 85}, {34, 47, 60, 87}, {36, 49, 62, 89}, {38, 51, 64, 91},
+	{40, 53, 66, 93}, {42, 55, 68, 95}, {44, 57, 70, 97}, {46, 59, 72, 99},
+	{48, 61, 74, 101}, {50, 63, 76, 103}, {52, 65, 78, 105}, {54, 67, 80, 107},
+	{56, 69, 82, 109}, {58, 71, 84, 111}, {60, 73, 86, 113}, {62, 75, 88, 115},
+	{64, 77, 90, 117}, {66, 79, 92, 119}, {68, 81, 94, 121}, {70, 83, 96, 123},
+	{72, 85, 98, 125}, {74, 87, 100, 127}, {76, 89, 102, 129}, {78, 91, 104, 131},
+	{80, 93, 106, 133}, {82, 95, 108, 135}, {84, 97, 110, 137}, {86, 99, 112, 139},
+	{88, 101, 114, 141}, {90, 103, 116, 143}, {92, 105, 118, 145}, {94, 107, 120, 147},
+	{96, 109, 122, 149}, {98, 111, 124, 151}, {100, 113, 126, 153}, {102, 115, 128, 155},
+	{104, 117, 130, 157}, {106, 119, 132, 159}, {108, 121, 134, 161}, {110, 123, 136, 163},
+	{112, 125, 138, 165}, {114, 127, 140, 167}, {116, 129, 142, 169}, {118, 131, 144, 171},
+	{120, 133, 146, 173}, {122, 135, 148, 175}, {124, 137, 150, 177}, {126, 139, 152, 179},
+},
+{
+	{0, 16, 34, 69}, {2, 18, 36, 71}, {4, 20, 38, 73}, {6, 22, 40, 75},
+	{8, 24, 42, 77}, {10, 26, 44, 79}, {12, 28, 46, 81}, {14, 30, 48, 83},
+	{16, 32, 50, 85}, {18, 34, 52, 87}, {20, 36, 54, 89}, {22, 38, 56, 91},
+	{24, 40, 58, 93}, {26, 42, 60, 95}, {28, 44, 62, 97}, {30, 46, 64, 99},
+	{32, 48, 66, 101}, {34, 50, 68, 103}, {36, 52, 70, 105}, {38, 54, 72, 107},
+	{40, 56, 74, 109}, {42, 58, 76, 111}, {44, 60, 78, 113}, {46, 62, 80, 115},
+	{48, 64, 82, 117}, {50, 66, 84, 119}, {52, 68, 86, 121}, {54, 70, 88, 123},
+	{56, 72, 90, 125}, {58, 74, 92, 127}, {60, 76, 94, 129}, {62, 78, 96, 131},
+	{64, 80, 98, 133}, {66, 82, 100, 135}, {68, 84, 102, 137}, {70, 86, 104, 139},
+	{72, 88, 106, 141}, {74, 90, 108, 143}, {76, 92, 110, 145}, {78, 94, 112, 147},
+	{80, 96, 114, 149}, {82, 98, 116, 151}, {84, 100, 118, 153}, {86, 102, 120, 155},
+	{88, 104, 122, 157}, {90, 106, 124, 159}, {92, 108, 126, 161}, {94, 110, 128, 163},
+	{96, 112, 130, 165}, {98, 114, 132, 167}, {100, 116, 134, 169}, {102, 118, 136, 171},
+	{104, 120, 138, 173}, {106, 122, 140, 175}, {108, 124, 142, 177}, {110, 126, 144, 179},
+	{112, 128, 146, 181}, {114, 130, 148, 183}, {116, 132, 150, 185}, {118, 134, 152, 187},
+	{120, 136, 154, 189}, {122, 138, 156, 191}, {124, 140, 158, 193}, {126, 142, 160, 195},
+},
+{
+	{0, 21, 42, 85}, {2, 23, 44, 87}, {4, 25, 46, 89}, {6, 27, 48, 91},
+	{8, 29, 50, 93}, {10, 31, 52, 95}, {12, 33, 54, 97}, {14, 35, 56, 99},
+	{16, 37, 58, 101}, {18, 39, 60, 103}, {20, 41, 62, 105}, {22, 43, 64, 107},
+	{24, 45, 66, 109}, {26, 47, 68, 111}, {28, 49, 70, 113}, {30, 51, 72, 115},
+	{32, 53, 74, 117}, {34, 55, 76, 119}, {36, 57, 78, 121}, {38, 59, 80, 123},
+	{40, 61, 82, 125}, {42, 63, 84, 127}, {44, 65, 86, 129}, {46, 67, 88, 131},
+	{48, 69, 90, 133}, {50, 71, 92, 135}, {52, 73, 94, 137}, {54, 75, 96, 139},
+	{56, 77, 98, 141}, {58, 79, 100, 143}, {60, 81, 102, 145}, {62, 83, 104, 147},
+	{64, 85, 106, 149}, {66, 87, 108, 151}, {68, 89, 110, 153}, {70, 91, 112, 155},
+	{72, 93, 114, 157}, {74, 95, 116, 159}, {76, 97, 118, 161}, {78, 99, 120, 163},
+	{80, 101, 122, 165}, {82, 103, 124, 167}, {84, 105, 126, 169}, {86, 107, 128, 171},
+	{88, 109, 130, 173}, {90, 111, 132, 175}, {92, 113, 134, 177}, {94, 115, 136, 179},
+	{96, 117, 138, 181}, {98, 119, 140, 183}, {100, 121, 142, 185}, {102, 123, 144, 187},
+	{104, 125, 146, 189}, {106, 127, 148, 191}, {108, 129, 150, 193}, {110, 131, 152, 195},
+	{112, 133, 154, 197}, {114, 135, 156, 199}, {116, 137, 158, 201}, {118, 139, 160, 203},
+	{120, 141, 162, 205}, {122, 143, 164, 207}, {124, 145, 166, 209}, {126, 147, 168, 211},
+},
+},
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 2, 8}, {2, 2, 4, 10}, {4, 4, 6, 12}, {6, 6, 8, 14},
+	{8, 8, 10, 16}, {10, 10, 12, 18}, {12, 12, 14, 20}, {14, 14, 16, 22},
+	{16, 16, 18, 24}, {18, 18, 20, 26}, {20, 20, 22, 28}, {22, 22, 24, 30},
+	{24, 24, 26, 32}, {26, 26, 28, 34}, {28, 28, 30, 36}, {30, 30, 32, 38},
+	{32, 32, 34, 40}, {34, 34, 36, 42}, {36, 36, 38, 44}, {38, 38, 40, 46},
+	{40, 40, 42, 48}, {42, 42, 44, 50}, {44, 44, 46, 52}, {46, 46, 48, 54},
+	{48, 48, 50, 56}, {50, 50, 52, 58}, {52, 52, 54, 60}, {54, 54, 56, 62},
+	{56, 56, 58, 64}, {58, 58, 60, 66}, {60, 60, 62, 68}, {62, 62, 64, 70},
+	{64, 64, 66, 72}, {66, 66, 68, 74}, {68, 68, 70, 76}, {70, 70, 72, 78},
+	{72, 72, 74, 80}, {74, 74, 76, 82}, {76, 76, 78, 84}, {78, 78, 80, 86},
+	{80, 80, 82, 88}, {82, 82, 84, 90}, {84, 84, 86, 92}, {86, 86, 88, 94},
+	{88, 88, 90, 96}, {90, 90, 92, 98}, {92, 92, 94, 100}, {94, 94, 96, 102},
+	{96, 96, 98, 104}, {98, 98, 100, 106}, {100, 100, 102, 108}, {102, 102, 104, 110},
+	{104, 104, 106, 112}, {106, 106, 108, 114}, {108, 108, 110, 116}, {110, 110, 112, 118},
+	{112, 112, 114, 120}, {114, 114, 116, 122}, {116, 116, 118, 124}, {118, 118, 120, 126},
+	{120, 120, 122, 128}, {122, 122, 124, 130}, {124, 124, 126, 132}, {126, 126, 128, 134},
+},
+{
+	{0, 5, 10, 24}, {2, 7, 12, 26}, {4, 9, 14, 28}, {6, 11, 16, 30},
+	{8, 13, 18, 32}, {10, 15, 20, 34}, {12, 17, 22, 36}, {14, 19, 24, 38},
+	{16, 21, 26, 40}, {18, 23, 28, 42}, {20, 25, 30, 44}, {22, 27, 32, 46},
+	{24, 29, 34, 48}, {26, 31, 36, 50}, {28, 33, 38, 52}, {30, 35, 40, 54},
+	{32, 37, 42, 56}, {34, 39, 44, 58}, {36, 41, 46, 60}, {38, 43, 48, 62},
+	{40, 45, 50, 64}, {42, 47, 52, 66}, {44, 49, 54, 68}, {46, 51, 56, 70},
+	{48, 53, 58, 72}, {50, 55, 60, 74}, {52, 57, 62, 76}, {54, 59, 64, 78},
+	{56, 61, 66, 80}, {58, 63, 68, 82}, {60, 65, 70, 84}, {62, 67, 72, 86},
+	{64, 69, 74, 88}, {66, 71, 76, 90}, {68, 73, 78, 92}, {70, 75, 80, 94},
+	{72, 77, 82, 96}, {74, 79, 84, 98}, {76, 81, 86, 100}, {78, 83, 88, 102},
+	{80, 85, 90, 104}, {82, 87, 92, 106}, {84, 89, 94, 108}, {86, 91, 96, 110},
+	{88, 93, 98, 112}, {90, 95, 100, 114}, {92, 97, 102, 116}, {94, 99, 104, 118},
+	{96, 101, 106, 120}, {98, 103, 108, 122}, {100, 105, 110, 124}, {102, 107, 112, 126},
+	{104, 109, 114, 128}, {106, 111, 116, 130}, {108, 113, 118, 132}, {110, 115, 120, 134},
+	{112, 117, 122, 136}, {114, 119, 124, 138}, {116, 121, 126, 140}, {118, 123, 128, 142},
+	{120, 125, 130, 144}, {122, 127, 132, 146}, {124, 129, 134, 148}, {126, 131, 136, 150},
+},
+{
+	{0, 8, 18, 40}, {2, 10, 20, 42}, {4, 12, 22, 44}, {6, 14, 24, 46},
+	{8, 16, 26, 48}, {10, 18, 28, 50}, {12, 20, 30, 52}, {14, 22, 32, 54},
+	{16, 24, 34, 56}, {18, 26, 36, 58}, {20, 28, 38, 60}, {22, 30, 40, 62},
+	{24, 32, 42, 64}, {26, 34, 44, 66}, {28, 36, 46, 68}, {30, 38, 48, 70},
+	{32, 40, 50, 72}, {34, 42, 52, 74}, {36, 44, 54, 76}, {38, 46, 56, 78},
+	{40, 48, 58, 80}, {42, 50, 60, 82}, {44, 52, 62, 84}, {46, 54, 64, 86},
+	{48, 56, 66, 88}, {50, 58, 68, 90}, {52, 60, 70, 92}, {54, 62, 72, 94},
+	{56, 64, 74, 96}, {58, 66, 76, 98}, {60, 68, 78, 100}, {62, 70, 80, 102},
+	{64, 72, 82, 104}, {66, 74, 84, 106}, {68, 76, 86, 108}, {70, 78, 88, 110},
+	{72, 80, 90, 112}, {74, 82, 92, 114}, {76, 84, 94, 116}, {78, 86, 96, 118},
+	{80, 88, 98, 120}, {82, 90, 100, 122}, {84, 92, 102, 124}, {86, 94, 104, 126},
+	{88, 96, 106, 128}, {90, 98, 108, 130}, {92, 100, 110, 132}, {94, 102, 112, 134},
+	{96, 104, 114, 136}, {98, 106, 116, 138}, {100, 108, 118, 140}, {102, 110, 120, 142},
+	{104, 112, 122, 144}, {106, 114, 124, 146}, {108, 116, 126, 148}, {110, 118, 128, 150},
+	{112, 120, 130, 152}, {114, 122, 132, 154}, {116, 124, 134, 156}, {118, 126, 136, 158},
+	{120, 128, 138, 160}, {122, 130, 140, 162}, {124, 132, 142, 164}, {126, 134, 144, 166},
+},
+{
+	{0, 13, 26, 56}, {2, 15, 28, 58}, {4, 17, 30, 60}, {6, 19, 32, 62},
+	{8, 21, 34, 64}, {10, 23, 36, 66}, {12, 25, 38, 68}, {14, 27, 40, 70},
+	{16, 29, 42, 72}, {18, 31, 44, 74}, {20, 33, 46, 76}, {22, 35, 48, 78},
+	{24, 37, 50, 80}, {26, 39, 52, 82}, {28, 41, 54, 84}, {30, 43, 56, 86},
+	{32, 45, 58, 88}, {34, 47, 60, 90}, {36, 49, 62, 92}, {38, 51, 64, 94},
+	{40, 53, 66, 96}, {42, 55, 68, 98}, {44, 57, 70, 100}, {46, 59, 72, 102},
+	{48, 61, 74, 104}, {50, 63, 76, 106}, {52, 65, 78, 108}, {54, 67, 80, 110},
+	{56, 69, 82, 112}, {58, 71, 84, 114}, {60, 73, 86, 116}, {62, 75, 88, 118},
+	{64, 77, 90, 120}, {66, 79, 92, 122}, {68, 81, 94, 124}, {70, 83, 96, 126},
+	{72, 85, 98, 128}, {74, 87, 100, 130}, {76, 89, 102, 132}, {78, 91, 104, 134},
+	{80, 93, 106, 136}, {82, 95, 108, 138}, {84, 97, 110, 140}, {86, 99, 112, 142},
+	{88, 101, 114, 144}, {90, 103, 116, 146}, {92, 105, 118, 148}, {94, 107, 120, 150},
+	{96, 109, 122, 152}, {98, 111, 124, 154}, {100, 113, 126, 156}, {102, 115, 128, 158},
+	{104, 117, 130, 160}, {106, 119, 132, 162}, {108, 121, 134, 164}, {110, 123, 136, 166},
+	{112, 125, 138, 168}, {114, 127, 140, 170}, {116, 129, 142, 172}, {118, 131, 144, 174},
+	{120, 133, 146, 176}, {122, 135, 148, 178}, {124, 137, 150, 180}, {126, 139, 152, 182},
+},
+{
+	{0, 16, 34, 72}, {2, 18, 36, 74}, {4, 20, 38, 76}, {6, 22, 40, 78},
+	{8, 24, 42, 80}, {10, 26, 44, 82}, {12, 28, 46, 84}, {14, 30, 48, 86},
+	{16, 32, 50, 88}, {18, 34, 52, 90}, {20, 36, 54, 92}, {22, 38, 56, 94},
+	{24, 40, 58, 96}, {26, 42, 60, 98}, {28, 44, 62, 100}, {30, 46, 64, 102},
+	{32, 48, 66, 104}, {34, 50, 68, 106}, {36, 52, 70, 108}, {38, 54, 72, 110},
+	{40, 56, 74, 112}, {42, 58, 76, 114}, {44, 60, 78, 116}, {46, 62, 80, 118},
+	{48, 64, 82, 120}, {50, 66, 84, 122}, {52, 68, 86, 124}, {54, 70, 88, 126},
+	{56, 72, 90, 128}, {58, 74, 92, 130}, {60, 76, 94, 132}, {62, 78, 96, 134},
+	{64, 80, 98, 136}, {66, 82, 100, 138}, {68, 84, 102, 140}, {70, 86, 104, 142},
+	{72, 88, 106, 144}, {74, 90, 108, 146}, {76, 92, 110, 148}, {78, 94, 112, 150},
+	{80, 96, 114, 152}, {82, 98, 116, 154}, {84, 100, 118, 156}, {86, 102, 120, 158},
+	{88, 104, 122, 160}, {90, 106, 124, 162}, {92, 108, 126, 164}, {94, 110, 128, 166},
+	{96, 112, 130, 168}, {98, 114, 132, 170}, {100, 116, 134, 172}, {102, 118, 136, 174},
+	{104, 120, 138, 176}, {106, 122, 140, 178}, {108, 124, 142, 180}, {110, 126, 144, 182},
+	{112, 128, 146, 184}, {114, 130, 148, 186}, {116, 132, 150, 188}, {118, 134, 152, 190},
+	{120, 136, 154, 192}, {122, 138, 156, 194}, {124, 140, 158, 196}, {126, 142, 160, 198},
+},
+{
+	{0, 21, 42, 88}, {2, 23, 44, 90}, {4, 25, 46, 92}, {6, 27, 48, 94},
+	{8, 29, 50, 96}, {10, 31, 52, 98}, {12, 33, 54, 100}, {14, 35, 56, 102},
+	{16, 37, 58, 104}, {18, 39, 60, 106}, {20, 41, 62, 108}, {22, 43, 64, 110},
+	{24, 45, 66, 112}, {26, 47, 68, 114}, {28, 49, 70, 116}, {30, 51, 72, 118},
+	{32, 53, 74, 120}, {34, 55, 76, 122}, {36, 57, 78, 124}, {38, 59, 80, 126},
+	{40, 61, 82, 128}, {42, 63, 84, 130}, {44, 65, 86, 132}, {46, 67, 88, 134},
+	{48, 69, 90, 136}, {50, 71, 92, 138}, {52, 73, 94, 140}, {54, 75, 96, 142},
+	{56, 77, 98, 144}, {58, 79, 100, 146}, {60, 81, 102, 148}, {62, 83, 104, 150},
+	{64, 85, 106, 152}, {66, 87, 108, 154}, {68, 89, 110, 156}, {70, 91, 112, 158},
+	{72, 93, 114, 160}, {74, 95, 116, 162}, {76, 97, 118, 164}, {78, 99, 120, 166},
+	{80, 101, 122, 168}, {82, 103, 124, 170}, {84, 105, 126, 172}, {86, 107, 128, 174},
+	{88, 109, 130, 176}, {90, 111, 132, 178}, {92, 113, 134, 180}, {94, 115, 136, 182},
+	{96, 117, 138, 184}, {98, 119, 140, 186}, {100, 121, 142, 188}, {102, 123, 144, 190},
+	{104, 125, 146, 192}, {106, 127, 148, 194}, {108, 129, 150, 196}, {110, 131, 152, 198},
+	{112, 133, 154, 200}, {114, 135, 156, 202}, {116, 137, 158, 204}, {118, 139, 160, 206},
+	{120, 141, 162, 208}, {122, 143, 164, 210}, {124, 145, 166, 212}, {126, 147, 168, 214},
+},
+},
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 2, 5, 13}, {2, 4, 7, 15}, {4, 6, 9, 17}, {6, 8, 11, 19},
+	{8, 10, 13, 21}, {10, 12, 15, 23}, {12, 14, 17, 25}, {14, 16, 19, 27},
+	{16, 18, 21, 29}, {18, 20, 23, 31}, {20, 22, 25, 33}, {22, 24, 27, 35},
+	{24, 26, 29, 37}, {26, 28, 31, 39}, {28, 30, 33, 41}, {30, 32, 35, 43},
+	{32, 34, 37, 45}, {34, 36, 39, 47}, {36, 38, 41, 49}, {38, 40, 43, 51},
+	{40, 42, 45, 53}, {42, 44, 47, 55}, {44, 46, 49, 57}, {46, 48, 51, 59},
+	{48, 50, 53, 61}, {50, 52, 55, 63}, {52, 54, 57, 65}, {54, 56, 59, 67},
+	{56, 58, 61, 69}, {58, 60, 63, 71}, {60, 62, 65, 73}, {62, 64, 67, 75},
+	{64, 66, 69, 77}, {66, 68, 71, 79}, {68, 70, 73, 81}, {70, 72, 75, 83},
+	{72, 74, 77, 85}, {74, 76, 79, 87}, {76, 78, 81, 89}, {78, 80, 83, 91},
+	{80, 82, 85, 93}, {82, 84, 87, 95}, {84, 86, 89, 97}, {86, 88, 91, 99},
+	{88, 90, 93, 101}, {90, 92, 95, 103}, {92, 94, 97, 105}, {94, 96, 99, 107},
+	{96, 98, 101, 109}, {98, 100, 103, 111}, {100, 102, 105, 113}, {102, 104, 107, 115},
+	{104, 106, 109, 117}, {106, 108, 111, 119}, {108, 110, 113, 121}, {110, 112, 115, 123},
+	{112, 114, 117, 125}, {114, 116, 119, 127}, {116, 118, 121, 129}, {118, 120, 123, 131},
+	{120, 122, 125, 133}, {122, 124, 127, 135}, {124, 126, 129, 137}, {126, 128, 131, 139},
+},
+{
+	{0, 5, 13, 29}, {2, 7, 15, 31}, {4, 9, 17, 33}, {6, 11, 19, 35},
+	{8, 13, 21, 37}, {10, 15, 23, 39}, {12, 17, 25, 41}, {14, 19, 27, 43},
+	{16, 21, 29, 45}, {18, 23, 31, 47}, {20, 25, 33, 49}, {22, 27, 35, 51},
+	{24, 29, 37, 53}, {26, 31, 39, 55}, {28, 33, 41, 57}, {30, 35, 43, 59},
+	{32, 37, 45, 61}, {34, 39, 47, 63}, {36, 41, 49, 65}, {38, 43, 51, 67},
+	{40, 45, 53, 69}, {42, 47, 55, 71}, {44, 49, 57, 73}, {46, 51, 59, 75},
+	{48, 53, 61, 77}, {50, 55, 63, 79}, {52, 57, 65, 81}, {54, 59, 67, 83},
+	{56, 61, 69, 85}, {58, 63, 71, 87}, {60, 65, 73, 89}, {62, 67, 75, 91},
+	{64, 69, 77, 93}, {66, 71, 79, 95}, {68, 73, 81, 97}, {70, 75, 83, 99},
+	{72, 77, 85, 101}, {74, 79, 87, 103}, {76, 81, 89, 105}, {78, 83, 91, 107},
+	{80, 85, 93, 109}, {82, 87, 95, 111}, {84, 89, 97, 113}, {86, 91, 99, 115},
+	{88, 93, 101, 117}, {90, 95, 103, 119}, {92, 97, 105, 121}, {94, 99, 107, 123},
+	{96, 101, 109, 125}, {98, 103, 111, 127}, {100, 105, 113, 129}, {102, 107, 115, 131},
+	{104, 109, 117, 133}, {106, 111, 119, 135}, {108, 113, 121, 137}, {110, 115, 123, 139},
+	{112, 117, 125, 141}, {114, 119, 127, 143}, {116, 121, 129, 145}, {118, 123, 131, 147},
+	{120, 125, 133, 149}, {122, 127, 135, 151}, {124, 129, 137, 153}, {126, 131, 139, 155},
+},
+{
+	{0, 10, 21, 45}, {2, 12, 23, 47}, {4, 14, 25, 49}, {6, 16, 27, 51},
+	{8, 18, 29, 53}, {10, 20, 31, 55}, {12, 22, 33, 57}, {14, 24, 35, 59},
+	{16, 26, 37, 61}, {18, 28, 39, 63}, {20, 30, 41, 65}, {22, 32, 43, 67},
+	{24, 34, 45, 69}, {26, 36, 47, 71}, {28, 38, 49, 73}, {30, 40, 51, 75},
+	{32, 42, 53, 77}, {34, 44, 55, 79}, {36, 46, 57, 81}, {38, 48, 59, 83},
+	{40, 50, 61, 85}, {42, 52, 63, 87}, {44, 54, 65, 89}, {46, 56, 67, 91},
+	{48, 58, 69, 93}, {50, 60, 71, 95}, {52, 62, 73, 97}, {54, 64, 75, 99},
+	{56, 66, 77, 101}, {58, 68, 79, 103}, {60, 70, 81, 105}, {62, 72, 83, 107},
+	{64, 74, 85, 109}, {66, 76, 87, 111}, {68, 78, 89, 113}, {70, 80, 91, 115},
+	{72, 82, 93, 117}, {74, 84, 95, 119}, {76, 86, 97, 121}, {78, 88, 99, 123},
+	{80, 90, 101, 125}, {82, 92, 103, 127}, {84, 94, 105, 129}, {86, 96, 107, 131},
+	{88, 98, 109, 133}, {90, 100, 111, 135}, {92, 102, 113, 137}, {94, 104, 115, 139},
+	{96, 106, 117, 141}, {98, 108, 119, 143}, {100, 110, 121, 145}, {102, 112, 123, 147},
+	{104, 114, 125, 149}, {106, 116, 127, 151}, {108, 118, 129, 153}, {110, 120, 131, 155},
+	{112, 122, 133, 157}, {114, 124, 135, 159}, {116, 126, 137, 161}, {118, 128, 139, 163},
+	{120, 130, 141, 165}, {122, 132, 143, 167}, {124, 134, 145, 169}, {126, 136, 147, 171},
+},
+{
+	{0, 13, 29, 61}, {2, 15, 31, 63}, {4, 17, 33, 65}, {6, 19, 35, 67},
+	{8, 21, 37, 69}, {10, 23, 39, 71}, {12, 25, 41, 73}, {14, 27, 43, 75},
+	{16, 29, 45, 77}, {18, 31, 47, 79}, {20, 33, 49, 81}, {22, 35, 51, 83},
+	{24, 37, 53, 85}, {26, 39, 55, 87}, {28, 41, 57, 89}, {30, 43, 59, 91},
+	{32, 45, 61, 93}, {34, 47, 63, 95}, {36, 49, 65, 97}, {38, 51, 67, 99},
+	{40, 53, 69, 101}, {42, 55, 71, 103}, {44, 57, 73, 105}, {46, 59, 75, 107},
+	{48, 61, 77, 109}, {50, 63, 79, 111}, {52, 65, 81, 113}, {54, 67, 83, 115},
+	{56, 69, 85, 117}, {58, 71, 87, 119}, {60, 73, 89, 121}, {62, 75, 91, 123},
+	{64, 77, 93, 125}, {66, 79, 95, 127}, {68, 81, 97, 129}, {70, 83, 99, 131},
+	{72, 85, 101, 133}, {74, 87, 103, 135}, {76, 89, 105, 137}, {78, 91, 107, 139},
+	{80, 93, 109, 141}, {82, 95, 111, 143}, {84, 97, 113, 145}, {86, 99, 115, 147},
+	{88, 101, 117, 149}, {90, 103, 119, 151}, {92, 105, 121, 153}, {94, 107, 123, 155},
+	{96, 109, 125, 157}, {98, 111, 127, 159}, {100, 113, 129, 161}, {102, 115, 131, 163},
+	{104, 117, 133, 165}, {106, 119, 135, 167}, {108, 121, 137, 169}, {110, 123, 139, 171},
+	{112, 125, 141, 173}, {114, 127, 143, 175}, {116, 129, 145, 177}, {118, 131, 147, 179},
+	{120, 133, 149, 181}, {122, 135, 151, 183}, {124, 137, 153, 185}, {126, 139, 155, 187},
+},
+{
+	{0, 18, 37, 77}, {2, 20, 39, 79}, {4, 22, 41, 81}, {6, 24, 43, 83},
+	{8, 26, 45, 85}, {10, 28, 47, 87}, {12, 30, 49, 89}, {14, 32, 51, 91},
+	{16, 34, 53, 93}, {18, 36, 55, 95}, {20, 38, 57, 97}, {22, 40, 59, 99},
+	{24, 42, 61, 101}, {26, 44, 63, 103}, {28, 46, 65, 105}, {30, 48, 67, 107},
+	{32, 50, 69, 109}, {34, 52, 71, 111}, {36, 54, 73, 113}, {38, 56, 75, 115},
+	{40, 58, 77, 117}, {42, 60, 79, 119}, {44, 62, 81, 121}, {46, 64, 83, 123},
+	{48, 66, 85, 125}, {50, 68, 87, 127}, {52, 70, 89, 129}, {54, 72, 91, 131},
+	{56, 74, 93, 133}, {58, 76, 95, 135}, {60, 78, 97, 137}, {62, 80, 99, 139},
+	{64, 82, 101, 141}, {66, 84, 103, 143}, {68, 86, 105, 145}, {70, 88, 107, 147},
+	{72, 90, 109, 149}, {74, 92, 111, 151}, {76, 94, 113, 153}, {78, 96, 115, 155},
+	{80, 98, 117, 157}, {82, 100, 119, 159}, {84, 102, 121, 161}, {86, 104, 123, 163},
+	{88, 106, 125, 165}, {90, 108, 127, 167}, {92, 110, 129, 169}, {94, 112, 131, 171},
+	{96, 114, 133, 173}, {98, 116, 135, 175}, {100, 118, 137, 177}, {102, 120, 139, 179},
+	{104, 122, 141, 181}, {106, 124, 143, 183}, {108, 126, 145, 185}, {110, 128, 147, 187},
+	{112, 130, 149, 189}, {114, 132, 151, 191}, {116, 134, 153, 193}, {118, 136, 155, 195},
+	{120, 138, 157, 197}, {122, 140, 159, 199}, {124, 142, 161, 201}, {126, 144, 163, 203},
+},
+{
+	{0, 21, 45, 93}, {2, 23, 47, 95}, {4, 25, 49, 97}, {6, 27, 51, 99},
+	{8, 29, 53, 101}, {10, 31, 55, 103}, {12, 33, 57, 105}, {14, 35, 59, 107},
+	{16, 37, 61, 109}, {18, 39, 63, 111}, {20, 41, 65, 113}, {22, 43, 67, 115},
+	{24, 45, 69, 117}, {26, 47, 71, 119}, {28, 49, 73, 121}, {30, 51, 75, 123},
+	{32, 53, 77, 125}, {34, 55, 79, 127}, {36, 57, 81, 129}, {38, 59, 83, 131},
+	{40, 61, 85, 133}, {42, 63, 87, 135}, {44, 65, 89, 137}, {46, 67, 91, 139},
+	{48, 69, 93, 141}, {50, 71, 95, 143}, {52, 73, 97, 145}, {54, 75, 99, 147},
+	{56, 77, 101, 149}, {58, 79, 103, 151}, {60, 81, 105, 153}, {62, 83, 107, 155},
+	{64, 85, 109, 157}, {66, 87, 111, 159}, {68, 89, 113, 161}, {70, 91, 115, 163},
+	{72, 93, 117, 165}, {74, 95, 119, 167}, {76, 97, 121, 169}, {78, 99, 123, 171},
+	{80, 101, 125, 173}, {82, 103, 127, 175}, {84, 105, 129, 177}, {86, 107, 131, 179},
+	{88, 109, 133, 181}, {90, 111, 135, 183}, {92, 113, 137, 185}, {94, 115, 139, 187},
+	{96, 117, 141, 189}, {98, 119, 143, 191}, {100, 121, 145, 193}, {102, 123, 147, 195},
+	{104, 125, 149, 197}, {106, 127, 151, 199}, {108, 129, 153, 201}, {110, 131, 155, 203},
+	{112, 133, 157, 205}, {114, 135, 159, 207}, {116, 137, 161, 209}, {118, 139, 163, 211},
+	{120, 141, 165, 213}, {122, 143, 167, 215}, {124, 145, 169, 217}, {126, 147, 171, 219},
+},
+},
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 2, 8, 16}, {2, 4, 10, 18}, {4, 6, 12, 20}, {6, 8, 14, 22},
+	{8, 10, 16, 24}, {10, 12, 18, 26}, {12, 14, 20, 28}, {14, 16, 22, 30},
+	{16, 18, 24, 32}, {18, 20, 26, 34}, {20, 22, 28, 36}, {22, 24, 30, 38},
+	{24, 26, 32, 40}, {26, 28, 34, 42}, {28, 30, 36, 44}, {30, 32, 38, 46},
+	{32, 34, 40, 48}, {34, 36, 42, 50}, {36, 38, 44, 52}, {38, 40, 46, 54},
+	{40, 42, 48, 56}, {42, 44, 50, 58}, {44, 46, 52, 60}, {46, 48, 54, 62},
+	{48, 50, 56, 64}, {50, 52, 58, 66}, {52, 54, 60, 68}, {54, 56, 62, 70},
+	{56, 58, 64, 72}, {58, 60, 66, 74}, {60, 62, 68, 76}, {62, 64, 70, 78},
+	{64, 66, 72, 80}, {66, 68, 74, 82}, {68, 70, 76, 84}, {70, 72, 78, 86},
+	{72, 74, 80, 88}, {74, 76, 82, 90}, {76, 78, 84, 92}, {78, 80, 86, 94},
+	{80, 82, 88, 96}, {82, 84, 90, 98}, {84, 86, 92, 100}, {86, 88, 94, 102},
+	{88, 90, 96, 104}, {90, 92, 98, 106}, {92, 94, 100, 108}, {94, 96, 102, 110},
+	{96, 98, 104, 112}, {98, 100, 106, 114}, {100, 102, 108, 116}, {102, 104, 110, 118},
+	{104, 106, 112, 120}, {106, 108, 114, 122}, {108, 110, 116, 124}, {110, 112, 118, 126},
+	{112, 114, 120, 128}, {114, 116, 122, 130}, {116, 118, 124, 132}, {118, 120, 126, 134},
+	{120, 122, 128, 136}, {122, 124, 130, 138}, {124, 126, 132, 140}, {126, 128, 134, 142},
+},
+{
+	{0, 8, 16, 32}, {2, 10, 18, 34}, {4, 12, 20, 36}, {6, 14, 22, 38},
+	{8, 16, 24, 40}, {10, 18, 26, 42}, {12, 20, 28, 44}, {14, 22, 30, 46},
+	{16, 24, 32, 48}, {18, 26, 34, 50}, {20, 28, 36, 52}, {22, 30, 38, 54},
+	{24, 32, 40, 56}, {26, 34, 42, 58}, {28, 36, 44, 60}, {30, 38, 46, 62},
+	{32, 40, 48, 64}, {34, 42, 50, 66}, {36, 44, 52, 68}, {38, 46, 54, 70},
+	{40, 48, 56, 72}, {42, 50, 58, 74}, {44, 52, 60, 76}, {46, 54, 62, 78},
+	{48, 56, 64, 80}, {50, 58, 66, 82}, {52, 60, 68, 84}, {54, 62, 70, 86},
+	{56, 64, 72, 88}, {58, 66, 74, 90}, {60, 68, 76, 92}, {62, 70, 78, 94},
+	{64, 72, 80, 96}, {66, 74, 82, 98}, {68, 76, 84, 100}, {70, 78, 86, 102},
+	{72, 80, 88, 104}, {74, 82, 90, 106}, {76, 84, 92, 108}, {78, 86, 94, 110},
+	{80, 88, 96, 112}, {82, 90, 98, 114}, {84, 92, 100, 116}, {86, 94, 102, 118},
+	{88, 96, 104, 120}, {90, 98, 106, 122}, {92, 100, 108, 124}, {94, 102, 110, 126},
+	{96, 104, 112, 128}, {98, 106, 114, 130}, {100, 108, 116, 132}, {102, 110, 118, 134},
+	{104, 112, 120, 136}, {106, 114, 122, 138}, {108, 116, 124, 140}, {110, 118, 126, 142},
+	{112, 120, 128, 144}, {114, 122, 130, 146}, {116, 124, 132, 148}, {118, 126, 134, 150},
+	{120, 128, 136, 152}, {122, 130, 138, 154}, {124, 132, 140, 156}, {126, 134, 142, 158},
+},
+{
+	{0, 10, 24, 48}, {2, 12, 26, 50}, {4, 14, 28, 52}, {6, 16, 30, 54},
+	{8, 18, 32, 56}, {10, 20, 34, 58}, {12, 22, 36, 60}, {14, 24, 38, 62},
+	{16, 26, 40, 64}, {18, 28, 42, 66}, {20, 30, 44, 68}, {22, 32, 46, 70},
+	{24, 34, 48, 72}, {26, 36, 50, 74}, {28, 38, 52, 76}, {30, 40, 54, 78},
+	{32, 42, 56, 80}, {34, 44, 58, 82}, {36, 46, 60, 84}, {38, 48, 62, 86},
+	{40, 50, 64, 88}, {42, 52, 66, 90}, {44, 54, 68, 92}, {46, 56, 70, 94},
+	{48, 58, 72, 96}, {50, 60, 74, 98}, {52, 62, 76, 100}, {54, 64, 78, 102},
+	{56, 66, 80, 104}, {58, 68, 82, 106}, {60, 70, 84, 108}, {62, 72, 86, 110},
+	{64, 74, 88, 112}, {66, 76, 90, 114}, {68, 78, 92, 116}, {70, 80, 94, 118},
+	{72, 82, 96, 120}, {74, 84, 98, 122}, {76, 86, 100, 124}, {78, 88, 102, 126},
+	{80, 90, 104, 128}, {82, 92, 106, 130}, {84, 94, 108, 132}, {86, 96, 110, 134},
+	{88, 98, 112, 136}, {90, 100, 114, 138}, {92, 102, 116, 140}, {94, 104, 118, 142},
+	{96, 106, 120, 144}, {98, 108, 122, 146}, {100, 110, 124, 148}, {102, 112, 126, 150},
+	{104, 114, 128, 152}, {106, 116, 130, 154}, {108, 118, 132, 156}, {110, 120, 134, 158},
+	{112, 122, 136, 160}, {114, 124, 138, 162}, {116, 126, 140, 164}, {118, 128, 142, 166},
+	{120, 130, 144, 168}, {122, 132, 146, 170}, {124, 134, 148, 172}, {126, 136, 150, 174},
+},
+{
+	{0, 16, 32, 64}, {2, 18, 34, 66}, {4, 20, 36, 68}, {6, 22, 38, 70},
+	{8, 24, 40, 72}, {10, 26, 42, 74}, {12, 28, 44, 76}, {14, 30, 46, 78},
+	{16, 32, 48, 80}, {18, 34, 50, 82}, {20, 36, 52, 84}, {22, 38, 54, 86},
+	{24, 40, 56, 88}, {26, 42, 58, 90}, {28, 44, 60, 92}, {30, 46, 62, 94},
+	{32, 48, 64, 96}, {34, 50, 66, 98}, {36, 52, 68, 100}, {38, 54, 70, 102},
+	{40, 56, 72, 104}, {42, 58, 74, 106}, {44, 60, 76, 108}, {46, 62, 78, 110},
+	{48, 64, 80, 112}, {50, 66, 82, 114}, {52, 68, 84, 116}, {54, 70, 86, 118},
+	{56, 72, 88, 120}, {58, 74, 90, 122}, {60, 76, 92, 124}, {62, 78, 94, 126},
+	{64, 80, 96, 128}, {66, 82, 98, 130}, {68, 84, 100, 132}, {70, 86, 102, 134},
+	{72, 88, 104, 136}, {74, 90, 106, 138}, {76, 92, 108, 140}, {78, 94, 110, 142},
+	{80, 96, 112, 144}, {82, 98, 114, 146}, {84, 100, 116, 148}, {86, 102, 118, 150},
+	{88, 104, 120, 152}, {90, 106, 122, 154}, {92, 108, 124, 156}, {94, 110, 126, 158},
+	{96, 112, 128, 160}, {98, 114, 130, 162}, {100, 116, 132, 164}, {102, 118, 134, 166},
+	{104, 120, 136, 168}, {106, 122, 138, 170}, {108, 124, 140, 172}, {110, 126, 142, 174},
+	{112, 128, 144, 176}, {114, 130, 146, 178}, {116, 132, 148, 180}, {118, 134, 150, 182},
+	{120, 136, 152, 184}, {122, 138, 154, 186}, {124, 140, 156, 188}, {126, 142, 158, 190},
+},
+{
+	{0, 18, 40, 80}, {2, 20, 42, 82}, {4, 22, 44, 84}, {6, 24, 46, 86},
+	{8, 26, 48, 88}, {10, 28, 50, 90}, {12, 30, 52, 92}, {14, 32, 54, 94},
+	{16, 34, 56, 96}, {18, 36, 58, 98}, {20, 38, 60, 100}, {22, 40, 62, 102},
+	{24, 42, 64, 104}, {26, 44, 66, 106}, {28, 46, 68, 108}, {30, 48, 70, 110},
+	{32, 50, 72, 112}, {34, 52, 74, 114}, {36, 54, 76, 116}, {38, 56, 78, 118},
+	{40, 58, 80, 120}, {42, 60, 82, 122}, {44, 62, 84, 124}, {46, 64, 86, 126},
+	{48, 66, 88, 128}, {50, 68, 90, 130}, {52, 70, 92, 132}, {54, 72, 94, 134},
+	{56, 74, 96, 136}, {58, 76, 98, 138}, {60, 78, 100, 140}, {62, 80, 102, 142},
+	{64, 82, 104, 144}, {66, 84, 106, 146}, {68, 86, 108, 148}, {70, 88, 110, 150},
+	{72, 90, 112, 152}, {74, 92, 114, 154}, {76, 94, 116, 156}, {78, 96, 118, 158},
+	{80, 98, 120, 160}, {82, 100, 122, 162}, {84, 102, 124, 164}, {86, 104, 126, 166},
+	{88, 106, 128, 168}, {90, 108, 130, 170}, {92, 110, 132, 172}, {94, 112, 134, 174},
+	{96, 114, 136, 176}, {98, 116, 138, 178}, {100, 118, 140, 180}, {102, 120, 142, 182},
+	{104, 122, 144, 184}, {106, 124, 146, 186}, {108, 126, 148, 188}, {110, 128, 150, 190},
+	{112, 130, 152, 192}, {114, 132, 154, 194}, {116, 134, 156, 196}, {118, 136, 158, 198},
+	{120, 138, 160, 200}, {122, 140, 162, 202}, {124, 142, 164, 204}, {126, 144, 166, 206},
+},
+{
+	{0, 24, 48, 96}, {2, 26, 50, 98}, {4, 28, 52, 100}, {6, 30, 54, 102},
+	{8, 32, 56, 104}, {10, 34, 58, 106}, {12, 36, 60, 108}, {14, 38, 62, 110},
+	{16, 40, 64, 112}, {18, 42, 66, 114}, {20, 44, 68, 116}, {22, 46, 70, 118},
+	{24, 48, 72, 120}, {26, 50, 74, 122}, {28, 52, 76, 124}, {30, 54, 78, 126},
+	{32, 56, 80, 128}, {34, 58, 82, 130}, {36, 60, 84, 132}, {38, 62, 86, 134},
+	{40, 64, 88, 136}, {42, 66, 90, 138}, {44, 68, 92, 140}, {46, 70, 94, 142},
+	{48, 72, 96, 144}, {50, 74, 98, 146}, {52, 76, 100, 148}, {54, 78, 102, 150},
+	{56, 80, 104, 152}, {58, 82, 106, 154}, {60, 84, 108, 156}, {62, 86, 110, 158},
+	{64, 88, 112, 160}, {66, 90, 114, 162}, {68, 92, 116, 164}, {70, 94, 118, 166},
+	{72, 96, 120, 168}, {74, 98, 122, 170}, {76, 100, 124, 172}, {78, 102, 126, 174},
+	{80, 104, 128, 176}, {82, 106, 130, 178}, {84, 108, 132, 180}, {86, 110, 134, 182},
+	{88, 112, 136, 184}, {90, 114, 138, 186}, {92, 116, 140, 188}, {94, 118, 142, 190},
+	{96, 120, 144, 192}, {98, 122, 146, 194}, {100, 124, 148, 196}, {102, 126, 150, 198},
+	{104, 128, 152, 200}, {106, 130, 154, 202}, {108, 132, 156, 204}, {110, 134, 158, 206},
+	{112, 136, 160, 208}, {114, 138, 162, 210}, {116, 140, 164, 212}, {118, 142, 166, 214},
+	{120, 144, 168, 216}, {122, 146, 170, 218}, {124, 148, 172, 220}, {126, 150, 174, 222},
+},
+},
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 0, 2}, {2, 2, 2, 4}, {4, 4, 4, 6}, {6, 6, 6, 8},
+	{8, 8, 8, 10}, {10, 10, 10, 12}, {12, 12, 12, 14}, {14, 14, 14, 16},
+	{16, 16, 16, 18}, {18, 18, 18, 20}, {20, 20, 20, 22}, {22, 22, 22, 24},
+	{24, 24, 24, 26}, {26, 26, 26, 28}, {28, 28, 28, 30}, {30, 30, 30, 32},
+	{32, 32, 32, 34}, {34, 34, 34, 36}, {36, 36, 36, 38}, {38, 38, 38, 40},
+	{40, 40, 40, 42}, {42, 42, 42, 44}, {44, 44, 44, 46}, {46, 46, 46, 48},
+	{48, 48, 48, 50}, {50, 50, 50, 52}, {52, 52, 52, 54}, {54, 54, 54, 56},
+	{56, 56, 56, 58}, {58, 58, 58, 60}, {60, 60, 60, 62}, {62, 62, 62, 64},
+	{64, 64, 64, 66}, {66, 66, 66, 68}, {68, 68, 68, 70}, {70, 70, 70, 72},
+	{72, 72, 72, 74}, {74, 74, 74, 76}, {76, 76, 76, 78}, {78, 78, 78, 80},
+	{80, 80, 80, 82}, {82, 82, 82, 84}, {84, 84, 84, 86}, {86, 86, 86, 88},
+	{88, 88, 88, 90}, {90, 90, 90, 92}, {92, 92, 92, 94}, {94, 94, 94, 96},
+	{96, 96, 96, 98}, {98, 98, 98, 100}, {100, 100, 100, 102}, {102, 102, 102, 104},
+	{104, 104, 104, 106}, {106, 106, 106, 108}, {108, 108, 108, 110}, {110, 110, 110, 112},
+	{112, 112, 112, 114}, {114, 114, 114, 116}, {116, 116, 116, 118}, {118, 118, 118, 120},
+	{120, 120, 120, 122}, {122, 122, 122, 124}, {124, 124, 124, 126}, {126, 126, 126, 128},
+},
+{
+	{0, 2, 8, 18}, {2, 4, 10, 20}, {4, 6, 12, 22}, {6, 8, 14, 24},
+	{8, 10, 16, 26}, {10, 12, 18, 28}, {12, 14, 20, 30}, {14, 16, 22, 32},
+	{16, 18, 24, 34}, {18, 20, 26, 36}, {20, 22, 28, 38}, {22, 24, 30, 40},
+	{24, 26, 32, 42}, {26, 28, 34, 44}, {28, 30, 36, 46}, {30, 32, 38, 48},
+	{32, 34, 40, 50}, {34, 36, 42, 52}, {36, 38, 44, 54}, {38, 40, 46, 56},
+	{40, 42, 48, 58}, {42, 44, 50, 60}, {44, 46, 52, 62}, {46, 48, 54, 64},
+	{48, 50, 56, 66}, {50, 52, 58, 68}, {52, 54, 60, 70}, {54, 56, 62, 72},
+	{56, 58, 64, 74}, {58, 60, 66, 76}, {60, 62, 68, 78}, {62, 64, 70, 80},
+	{64, 66, 72, 82}, {66, 68, 74, 84}, {68, 70, 76, 86}, {70, 72, 78, 88},
+	{72, 74, 80, 90}, {74, 76, 82, 92}, {76, 78, 84, 94}, {78, 80, 86, 96},
+	{80, 82, 88, 98}, {82, 84, 90, 100}, {84, 86, 92, 102}, {86, 88, 94, 104},
+	{88, 90, 96, 106}, {90, 92, 98, 108}, {92, 94, 100, 110}, {94, 96, 102, 112},
+	{96, 98, 104, 114}, {98, 100, 106, 116}, {100, 102, 108, 118}, {102, 104, 110, 120},
+	{104, 106, 112, 122}, {106, 108, 114, 124}, {108, 110, 116, 126}, {110, 112, 118, 128},
+	{112, 114, 120, 130}, {114, 116, 122, 132}, {116, 118, 124, 134}, {118, 120, 126, 136},
+	{120, 122, 128, 138}, {122, 124, 130, 140}, {124, 126, 132, 142}, {126, 128, 134, 144},
+},
+{
+	{0, 8, 16, 34}, {2, 10, 18, 36}, {4, 12, 20, 38}, {6, 14, 22, 40},
+	{8, 16, 24, 42}, {10, 18, 26, 44}, {12, 20, 28, 46}, {14, 22, 30, 48},
+	{16, 24, 32, 50}, {18, 26, 34, 52}, {20, 28, 36, 54}, {22, 30, 38, 56},
+	{24, 32, 40, 58}, {26, 34, 42, 60}, {28, 36, 44, 62}, {30, 38, 46, 64},
+	{32, 40, 48, 66}, {34, 42, 50, 68}, {36, 44, 52, 70}, {38, 46, 54, 72},
+	{40, 48, 56, 74}, {42, 50, 58, 76}, {44, 52, 60, 78}, {46, 54, 62, 80},
+	{48, 56, 64, 82}, {50, 58, 66, 84}, {52, 60, 68, 86}, {54, 62, 70, 88},
+	{56, 64, 72, 90}, {58, 66, 74, 92}, {60, 68, 76, 94}, {62, 70, 78, 96},
+	{64, 72, 80, 98}, {66, 74, 82, 100}, {68, 76, 84, 102}, {70, 78, 86, 104},
+	{72, 80, 88, 106}, {74, 82, 90, 108}, {76, 84, 92, 110}, {78, 86, 94, 112},
+	{80, 88, 96, 114}, {82, 90, 98, 116}, {84, 92, 100, 118}, {86, 94, 102, 120},
+	{88, 96, 104, 122}, {90, 98, 106, 124}, {92, 100, 108, 126}, {94, 102, 110, 128},
+	{96, 104, 112, 130}, {98, 106, 114, 132}, {100, 108, 116, 134}, {102, 110, 118, 136},
+	{104, 112, 120, 138}, {106, 114, 122, 140}, {108, 116, 124, 142}, {110, 118, 126, 144},
+	{112, 120, 128, 146}, {114, 122, 130, 148}, {116, 124, 132, 150}, {118, 126, 134, 152},
+	{120, 128, 136, 154}, {122, 130, 138, 156}, {124, 132, 140, 158}, {126, 134, 142, 160},
+},
+{
+	{0, 10, 24, 50}, {2, 12, 26, 52}, {4, 14, 28, 54}, {6, 16, 30, 56},
+	{8, 18, 32, 58}, {10, 20, 34, 60}, {12, 22, 36, 62}, {14, 24, 38, 64},
+	{16, 26, 40, 66}, {18, 28, 42, 68}, {20, 30, 44, 70}, {22, 32, 46, 72},
+	{24, 34, 48, 74}, {26, 36, 50, 76}, {28, 38, 52, 78}, {30, 40, 54, 80},
+	{32, 42, 56, 82}, {34, 44, 58, 84}, {36, 46, 60, 86}, {38, 48, 62, 88},
+	{40, 50, 64, 90}, {42, 52, 66, 92}, {44, 54, 68, 94}, {46, 56, 70, 96},
+	{48, 58, 72, 98}, {50, 60, 74, 100}, {52, 62, 76, 102}, {54, 64, 78, 104},
+	{56, 66, 80, 106}, {58, 68, 82, 108}, {60, 70, 84, 110}, {62, 72, 86, 112},
+	{64, 74, 88, 114}, {66, 76, 90, 116}, {68, 78, 92, 118}, {70, 80, 94, 120},
+	{72, 82, 96, 122}, {74, 84, 98, 124}, {76, 86, 100, 126}, {78, 88, 102, 128},
+	{80, 90, 104, 130}, {82, 92, 106, 132}, {84, 94, 108, 134}, {86, 96, 110, 136},
+	{88, 98, 112, 138}, {90, 100, 114, 140}, {92, 102, 116, 142}, {94, 104, 118, 144},
+	{96, 106, 120, 146}, {98, 108, 122, 148}, {100, 110, 124, 150}, {102, 112, 126, 152},
+	{104, 114, 128, 154}, {106, 116, 130, 156}, {108, 118, 132, 158}, {110, 120, 134, 160},
+	{112, 122, 136, 162}, {114, 124, 138, 164}, {116, 126, 140, 166}, {118, 128, 142, 168},
+	{120, 130, 144, 170}, {122, 132, 146, 172}, {124, 134, 148, 174}, {126, 136, 150, 176},
+},
+{
+	{0, 16, 32, 66}, {2, 18, 34, 68}, {4, 20, 36, 70}, {6, 22, 38, 72},
+	{8, 24, 40, 74}, {10, 26, 42, 76}, {12, 28, 44, 78}, {14, 30, 46, 80},
+	{16, 32, 48, 82}, {18, 34, 50, 84}, {20, 36, 52, 86}, {22, 38, 54, 88},
+	{24, 40, 56, 90}, {26, 42, 58, 92}, {28, 44, 60, 94}, {30, 46, 62, 96},
+	{32, 48, 64, 98}, {34, 50, 66, 100}, {36, 52, 68, 102}, {38, 54, 70, 104},
+	{40, 56, 72, 106}, {42, 58, 74, 108}, {44, 60, 76, 110}, {46, 62, 78, 112},
+	{48, 64, 80, 114}, {50, 66, 82, 116}, {52, 68, 84, 118}, {54, 70, 86, 120},
+	{56, 72, 88, 122}, {58, 74, 90, 124}, {60, 76, 92, 126}, {62, 78, 94, 128},
+	{64, 80, 96, 130}, {66, 82, 98, 132}, {68, 84, 100, 134}, {70, 86, 102, 136},
+	{72, 88, 104, 138}, {74, 90, 106, 140}, {76, 92, 108, 142}, {78, 94, 110, 144},
+	{80, 96, 112, 146}, {82, 98, 114, 148}, {84, 100, 116, 150}, {86, 102, 118, 152},
+	{88, 104, 120, 154}, {90, 106, 122, 156}, {92, 108, 124, 158}, {94, 110, 126, 160},
+	{96, 112, 128, 162}, {98, 114, 130, 164}, {100, 116, 132, 166}, {102, 118, 134, 168},
+	{104, 120, 136, 170}, {106, 122, 138, 172}, {108, 124, 140, 174}, {110, 126, 142, 176},
+	{112, 128, 144, 178}, {114, 130, 146, 180}, {116, 132, 148, 182}, {118, 134, 150, 184},
+	{120, 136, 152, 186}, {122, 138, 154, 188}, {124, 140, 156, 190}, {126, 142, 158, 192},
+},
+{
+	{0, 18, 40, 82}, {2, 20, 42, 84}, {4, 22, 44, 86}, {6, 24, 46, 88},
+	{8, 26, 48, 90}, {10, 28, 50, 92}, {12, 30, 52, 94}, {14, 32, 54, 96},
+	{16, 34, 56, 98}, {18, 36, 58, 100}, {20, 38, 60, 102}, {22, 40, 62, 104},
+	{24, 42, 64, 106}, {26, 44, 66, 108}, {28, 46, 68, 110}, {30, 48, 70, 112},
+	{32, 50, 72, 114}, {34, 52, 74, 116}, {36, 54, 76, 118}, {38, 56, 78, 120},
+	{40, 58, 80, 122}, {42, 60, 82, 124}, {44, 62, 84, 126}, {46, 64, 86, 128},
+	{48, 66, 88, 130}, {50, 68, 90, 132}, {52, 70, 92, 134}, {54, 72, 94, 136},
+	{56, 74, 96, 138}, {58, 76, 98, 140}, {60, 78, 100, 142}, {62, 80, 102, 144},
+	{64, 82, 104, 146}, {66, 84, 106, 148}, {68, 86, 108, 150}, {70, 88, 110, 152},
+	{72, 90, 112, 154}, {74, 92, 114, 156}, {76, 94, 116, 158}, {78, 96, 118, 160},
+	{80, 98, 120, 162}, {82, 100, 122, 164}, {84, 102, 124, 166}, {86, 104, 126, 168},
+	{88, 106, 128, 170}, {90, 108, 130, 172}, {92, 110, 132, 174}, {94, 112, 134, 176},
+	{96, 114, 136, 178}, {98, 116, 138, 180}, {100, 118, 140, 182}, {102, 120, 142, 184},
+	{104, 122, 144, 186}, {106, 124, 146, 188}, {108, 126, 148, 190}, {110, 128, 150, 192},
+	{112, 130, 152, 194}, {114, 132, 154, 196}, {116, 134, 156, 198}, {118, 136, 158, 200},
+	{120, 138, 160, 202}, {122, 140, 162, 204}, {124, 142, 164, 206}, {126, 144, 166, 208},
+},
+{
+	{0, 24, 48, 98}, {2, 26, 50, 100}, {4, 28, 52, 102}, {6, 30, 54, 104},
+	{8, 32, 56, 106}, {10, 34, 58, 108}, {12, 36, 60, 110}, {14, 38, 62, 112},
+	{16, 40, 64, 114}, {18, 42, 66, 116}, {20, 44, 68, 118}, {22, 46, 70, 120},
+	{24, 48, 72, 122}, {26, 50, 74, 124}, {28, 52, 76, 126}, {30, 54, 78, 128},
+	{32, 56, 80, 130}, {34, 58, 82, 132}, {36, 60, 84, 134}, {38, 62, 86, 136},
+	{40, 64, 88, 138}, {42, 66, 90, 140}, {44, 68, 92, 142}, {46, 70, 94, 144},
+	{48, 72, 96, 146}, {50, 74, 98, 148}, {52, 76, 100, 150}, {54, 78, 102, 152},
+	{56, 80, 104, 154}, {58, 82, 106, 156}, {60, 84, 108, 158}, {62, 86, 110, 160},
+	{64, 88, 112, 162}, {66, 90, 114, 164}, {68, 92, 116, 166}, {70, 94, 118, 168},
+	{72, 96, 120, 170}, {74, 98, 122, 172}, {76, 100, 124, 174}, {78, 102, 126, 176},
+	{80, 104, 128, 178}, {82, 106, 130, 180}, {84, 108, 132, 182}, {86, 110, 134, 184},
+	{88, 112, 136, 186}, {90, 114, 138, 188}, {92, 116, 140, 190}, {94, 118, 142, 192},
+	{96, 120, 144, 194}, {98, 122, 146, 196}, {100, 124, 148, 198}, {102, 126, 150, 200},
+	{104, 128, 152, 202}, {106, 130, 154, 204}, {108, 132, 156, 206}, {110, 134, 158, 208},
+	{112, 136, 160, 210}, {114, 138, 162, 212}, {116, 140, 164, 214}, {118, 142, 166, 216},
+	{120, 144, 168, 218}, {122, 146, 170, 220}, {124, 148, 172, 222}, {126, 150, 174, 224},
+},
+},
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 2, 5}, {2, 2, 4, 7}, {4, 4, 6, 9}, {6, 6, 8, 11},
+	{8, 8, 10, 13}, {10, 10, 12, 15}, {12, 12, 14, 17}, {14, 14, 16, 19},
+	{16, 16, 18, 21}, {18, 18, 20, 23}, {20, 20, 22, 25}, {22, 22, 24, 27},
+	{24, 24, 26, 29}, {26, 26, 28, 31}, {28, 28, 30, 33}, {30, 30, 32, 35},
+	{32, 32, 34, 37}, {34, 34, 36, 39}, {36, 36, 38, 41}, {38, 38, 40, 43},
+	{40, 40, 42, 45}, {42, 42, 44, 47}, {44, 44, 46, 49}, {46, 46, 48, 51},
+	{48, 48, 50, 53}, {50, 50, 52, 55}, {52, 52, 54, 57}, {54, 54, 56, 59},
+	{56, 56, 58, 61}, {58, 58, 60, 63}, {60, 60, 62, 65}, {62, 62, 64, 67},
+	{64, 64, 66, 69}, {66, 66, 68, 71}, {68, 68, 70, 73}, {70, 70, 72, 75},
+	{72, 72, 74, 77}, {74, 74, 76, 79}, {76, 76, 78, 81}, {78, 78, 80, 83},
+	{80, 80, 82, 85}, {82, 82, 84, 87}, {84, 84, 86, 89}, {86, 86, 88, 91},
+	{88, 88, 90, 93}, {90, 90, 92, 95}, {92, 92, 94, 97}, {94, 94, 96, 99},
+	{96, 96, 98, 101}, {98, 98, 100, 103}, {100, 100, 102, 105}, {102, 102, 104, 107},
+	{104, 104, 106, 109}, {106, 106, 108, 111}, {108, 108, 110, 113}, {110, 110, 112, 115},
+	{112, 112, 114, 117}, {114, 114, 116, 119}, {116, 116, 118, 121}, {118, 118, 120, 123},
+	{120, 120, 122, 125}, {122, 122, 124, 127}, {124, 124, 126, 129}, {126, 126, 128, 131},
+},
+{
+	{0, 5, 10, 21}, {2, 7, 12, 23}, {4, 9, 14, 25}, {6, 11, 16, 27},
+	{8, 13, 18, 29}, {10, 15, 20, 31}, {12, 17, 22, 33}, {14, 19, 24, 35},
+	{16, 21, 26, 37}, {18, 23, 28, 39}, {20, 25, 30, 41}, {22, 27, 32, 43},
+	{24, 29, 34, 45}, {26, 31, 36, 47}, {28, 33, 38, 49}, {30, 35, 40, 51},
+	{32, 37, 42, 53}, {34, 39, 44, 55}, {36, 41, 46, 57}, {38, 43, 48, 59},
+	{40, 45, 50, 61}, {42, 47, 52, 63}, {44, 49, 54, 65}, {46, 51, 56, 67},
+	{48, 53, 58, 69}, {50, 55, 60, 71}, {52, 57, 62, 73}, {54, 59, 64, 75},
+	{56, 61, 66, 77}, {58, 63, 68, 79}, {60, 65, 70, 81}, {62, 67, 72, 83},
+	{64, 69, 74, 85}, {66, 71, 76, 87}, {68, 73, 78, 89}, {70, 75, 80, 91},
+	{72, 77, 82, 93}, {74, 79, 84, 95}, {76, 81, 86, 97}, {78, 83, 88, 99},
+	{80, 85, 90, 101}, {82, 87, 92, 103}, {84, 89, 94, 105}, {86, 91, 96, 107},
+	{88, 93, 98, 109}, {90, 95, 100, 111}, {92, 97, 102, 113}, {94, 99, 104, 115},
+	{96, 101, 106, 117}, {98, 103, 108, 119}, {100, 105, 110, 121}, {102, 107, 112, 123},
+	{104, 109, 114, 125}, {106, 111, 116, 127}, {108, 113, 118, 129}, {110, 115, 120, 131},
+	{112, 117, 122, 133}, {114, 119, 124, 135}, {116, 121, 126, 137}, {118, 123, 128, 139},
+	{120, 125, 130, 141}, {122, 127, 132, 143}, {124, 129, 134, 145}, {126, 131, 136, 147},
+},
+{
+	{0, 8, 18, 37}, {2, 10, 20, 39}, {4, 12, 22, 41}, {6, 14, 24, 43},
+	{8, 16, 26, 45}, {10, 18, 28, 47}, {12, 20, 30, 49}, {14, 22, 32, 51},
+	{16, 24, 34, 53}, {18, 26, 36, 55}, {20, 28, 38, 57}, {22, 30, 40, 59},
+	{24, 32, 42, 61}, {26, 34, 44, 63}, {28, 36, 46, 65}, {30, 38, 48, 67},
+	{32, 40, 50, 69}, {34, 42, 52, 71}, {36, 44, 54, 73}, {38, 46, 56, 75},
+	{40, 48, 58, 77}, {42, 50, 60, 79}, {44, 52, 62, 81}, {46, 54, 64, 83},
+	{48, 56, 66, 85}, {50, 58, 68, 87}, {52, 60, 70, 89}, {54, 62, 72, 91},
+	{56, 64, 74, 93}, {58, 66, 76, 95}, {60, 68, 78, 97}, {62, 70, 80, 99},
+	{64, 72, 82, 101}, {66, 74, 84, 103}, {68, 76, 86, 105}, {70, 78, 88, 107},
+	{72, 80, 90, 109}, {74, 82, 92, 111}, {76, 84, 94, 113}, {78, 86, 96, 115},
+	{80, 88, 98, 117}, {82, 90, 100, 119}, {84, 92, 102, 121}, {86, 94, 104, 123},
+	{88, 96, 106, 125}, {90, 98, 108, 127}, {92, 100, 110, 129}, {94, 102, 112, 131},
+	{96, 104, 114, 133}, {98, 106, 116, 135}, {100, 108, 118, 137}, {102, 110, 120, 139},
+	{104, 112, 122, 141}, {106, 114, 124, 143}, {108, 116, 126, 145}, {110, 118, 128, 147},
+	{112, 120, 130, 149}, {114, 122, 132, 151}, {116, 124, 134, 153}, {118, 126, 136, 155},
+	{120, 128, 138, 157}, {122, 130, 140, 159}, {124, 132, 142, 161}, {126, 134, 144, 163},
+},
+{
+	{0, 13, 26, 53}, {2, 15, 28, 55}, {4, 17, 30, 57}, {6, 19, 32, 59},
+	{8, 21, 34, 61}, {10, 23, 36, 63}, {12, 25, 38, 65}, {14, 27, 40, 67},
+	{16, 29, 42, 69}, {18, 31, 44, 71}, {20, 33, 46, 73}, {22, 35, 48, 75},
+	{24, 37, 50, 77}, {26, 39, 52, 79}, {28, 41, 54, 81}, {30, 43, 56, 83},
+	{32, 45, 58, 85}, {34, 47, 60, 87}, {36, 49, 62, 89}, {38, 51, 64, 91},
+	{40, 53, 66, 93}, {42, 55, 68, 95}, {44, 57, 70, 97}, {46, 59, 72, 99},
+	{48, 61, 74, 101}, {50, 63, 76, 103}, {52, 65, 78, 105}, {54, 67, 80, 107},
+	{56, 69, 82, 109}, {58, 71, 84, 111}, {60, 73, 86, 113}, {62, 75, 88, 115},
+	{64, 77, 90, 117}, {66, 79, 92, 119}, {68, 81, 94, 121}, {70, 83, 96, 123},
+	{72, 85, 98, 125}, {74, 87, 100, 127}, {76, 89, 102, 129}, {78, 91, 104, 131},
+	{80, 93, 106, 133}, {82, 95, 108, 135}, {84, 97, 110, 137}, {86, 99, 112, 139},
+	{88, 101, 114, 141}, {90, 103, 116, 143}, {92, 105, 118, 145}, {94, 107, 120, 147},
+	{96, 109, 122, 149}, {98, 111, 124, 151}, {100, 113, 126, 153}, {102, 115, 128, 155},
+	{104, 117, 130, 157}, {106, 119, 132, 159}, {108, 121, 134, 161}, {110, 123, 136, 163},
+	{112, 125, 138, 165}, {114, 127, 140, 167}, {116, 129, 142, 169}, {118, 131, 144, 171},
+	{120, 133, 146, 173}, {122, 135, 148, 175}, {124, 137, 150, 177}, {126, 139, 152, 179},
+},
+{
+	{0, 16, 34, 69}, {2, 18, 36, 71}, {4, 20, 38, 73}, {6, 22, 40, 75},
+	{8, 24, 42, 77}, {10, 26, 44, 79}, {12, 28, 46, 81}, {14, 30, 48, 83},
+	{16, 32, 50, 85}, {18, 34, 52, 87}, {20, 36, 54, 89}, {22, 38, 56, 91},
+	{24, 40, 58, 93}, {26, 42, 60, 95}, {28, 44, 62, 97}, {30, 46, 64, 99},
+	{32, 48, 66, 101}, {34, 50, 68, 103}, {36, 52, 70, 105}, {38, 54, 72, 107},
+	{40, 56, 74, 109}, {42, 58, 76, 111}, {44, 60, 78, 113}, {46, 62, 80, 115},
+	{48, 64, 82, 117}, {50, 66, 84, 119}, {52, 68, 86, 121}, {54, 70, 88, 123},
+	{56, 72, 90, 125}, {58, 74, 92, 127}, {60, 76, 94, 129}, {62, 78, 96, 131},
+	{64, 80, 98, 133}, {66, 82, 100, 135}, {68, 84, 102, 137}, {70, 86, 104, 139},
+	{72, 88, 106, 141}, {74, 90, 108, 143}, {76, 92, 110, 145}, {78, 94, 112, 147},
+	{80, 96, 114, 149}, {82, 98, 116, 151}, {84, 100, 118, 153}, {86, 102, 120, 155},
+	{88, 104, 122, 157}, {90, 106, 124, 159}, {92, 108, 126, 161}, {94, 110, 128, 163},
+	{96, 112, 130, 165}, {98, 114, 132, 167}, {100, 116, 134, 169}, {102, 118, 136, 171},
+	{104, 120, 138, 173}, {106, 122, 140, 175}, {108, 124, 142, 177}, {110, 126, 144, 179},
+	{112, 128, 146, 181}, {114, 130, 148, 183}, {116, 132, 150, 185}, {118, 134, 152, 187},
+	{120, 136, 154, 189}, {122, 138, 156, 191}, {124, 140, 158, 193}, {126, 142, 160, 195},
+},
+{
+	{0, 21, 42, 85}, {2, 23, 44, 87}, {4, 25, 46, 89}, {6, 27, 48, 91},
+	{8, 29, 50, 93}, {10, 31, 52, 95}, {12, 33, 54, 97}, {14, 35, 56, 99},
+	{16, 37, 58, 101}, {18, 39, 60, 103}, {20, 41, 62, 105}, {22, 43, 64, 107},
+	{24, 45, 66, 109}, {26, 47, 68, 111}, {28, 49, 70, 113}, {30, 51, 72, 115},
+	{32, 53, 74, 117}, {34, 55, 76, 119}, {36, 57, 78, 121}, {38, 59, 80, 123},
+	{40, 61, 82, 125}, {42, 63, 84, 127}, {44, 65, 86, 129}, {46, 67, 88, 131},
+	{48, 69, 90, 133}, {50, 71, 92, 135}, {52, 73, 94, 137}, {54, 75, 96, 139},
+	{56, 77, 98, 141}, {58, 79, 100, 143}, {60, 81, 102, 145}, {62, 83, 104, 147},
+	{64, 85, 106, 149}, {66, 87, 108, 151}, {68, 89, 110, 153}, {70, 91, 112, 155},
+	{72, 93, 114, 157}, {74, 95, 116, 159}, {76, 97, 118, 161}, {78, 99, 120, 163},
+	{80, 101, 122, 165}, {82, 103, 124, 167}, {84, 105, 126, 169}, {86, 107, 128, 171},
+	{88, 109, 130, 173}, {90, 111, 132, 175}, {92, 113, 134, 177}, {94, 115, 136, 179},
+	{96, 117, 138, 181}, {98, 119, 140, 183}, {100, 121, 142, 185}, {102, 123, 144, 187},
+	{104, 125, 146, 189}, {106, 127, 148, 191}, {108, 129, 150, 193}, {110, 131, 152, 195},
+	{112, 133, 154, 197}, {114, 135, 156, 199}, {116, 137, 158, 201}, {118, 139, 160, 203},
+	{120, 141, 162, 205}, {122, 143, 164, 207}, {124, 145, 166, 209}, {126, 147, 168, 211},
+},
+{
+	{0, 24, 50, 101}, {2, 26, 52, 103}, {4, 28, 54, 105}, {6, 30, 56, 107},
+	{8, 32, 58, 109}, {10, 34, 60, 111}, {12, 36, 62, 113}, {14, 38, 64, 115},
+	{16, 40, 66, 117}, {18, 42, 68, 119}, {20, 44, 70, 121}, {22, 46, 72, 123},
+	{24, 48, 74, 125}, {26, 50, 76, 127}, {28, 52, 78, 129}, {30, 54, 80, 131},
+	{32, 56, 82, 133}, {34, 58, 84, 135}, {36, 60, 86, 137}, {38, 62, 88, 139},
+	{40, 64, 90, 141}, {42, 66, 92, 143}, {44, 68, 94, 145}, {46, 70, 96, 147},
+	{48, 72, 98, 149}, {50, 74, 100, 151}, {52, 76, 102, 153}, {54, 78, 104, 155},
+	{56, 80, 106, 157}, {58, 82, 108, 159}, {60, 84, 110, 161}, {62, 86, 112, 163},
+	{64, 88, 114, 165}, {66, 90, 116, 167}, {68, 92, 118, 169}, {70, 94, 120, 171},
+	{72, 96, 122, 173}, {74, 98, 124, 175}, {76, 100, 126, 177}, {78, 102, 128, 179},
+	{80, 104, 130, 181}, {82, 106, 132, 183}, {84, 108, 134, 185}, {86, 110, 136, 187},
+	{88, 112, 138, 189}, {90, 114, 140, 191}, {92, 116, 142, 193}, {94, 118, 144, 195},
+	{96, 120, 146, 197}, {98, 122, 148, 199}, {100, 124, 150, 201}, {102, 126, 152, 203},
+	{104, 128, 154, 205}, {106, 130, 156, 207}, {108, 132, 158, 209}, {110, 134, 160, 211},
+	{112, 136, 162, 213}, {114, 138, 164, 215}, {116, 140, 166, 217}, {118, 142, 168, 219},
+	{120, 144, 170, 221}, {122, 146, 172, 223}, {124, 148, 174, 225}, {126, 150, 176, 227},
+},
+},
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 2, 8}, {2, 2, 4, 10}, {4, 4, 6, 12}, {6, 6, 8, 14},
+	{8, 8, 10, 16}, {10, 10, 12, 18}, {12, 12, 14, 20}, {14, 14, 16, 22},
+	{16, 16, 18, 24}, {18, 18, 20, 26}, {20, 20, 22, 28}, {22, 22, 24, 30},
+	{24, 24, 26, 32}, {26, 26, 28, 34}, {28, 28, 30, 36}, {30, 30, 32, 38},
+	{32, 32, 34, 40}, {34, 34, 36, 42}, {36, 36, 38, 44}, {38, 38, 40, 46},
+	{40, 40, 42, 48}, {42, 42, 44, 50}, {44, 44, 46, 52}, {46, 46, 48, 54},
+	{48, 48, 50, 56}, {50, 50, 52, 58}, {52, 52, 54, 60}, {54, 54, 56, 62},
+	{56, 56, 58, 64}, {58, 58, 60, 66}, {60, 60, 62, 68}, {62, 62, 64, 70},
+	{64, 64, 66, 72}, {66, 66, 68, 74}, {68, 68, 70, 76}, {70, 70, 72, 78},
+	{72, 72, 74, 80}, {74, 74, 76, 82}, {76, 76, 78, 84}, {78, 78, 80, 86},
+	{80, 80, 82, 88}, {82, 82, 84, 90}, {84, 84, 86, 92}, {86, 86, 88, 94},
+	{88, 88, 90, 96}, {90, 90, 92, 98}, {92, 92, 94, 100}, {94, 94, 96, 102},
+	{96, 96, 98, 104}, {98, 98, 100, 106}, {100, 100, 102, 108}, {102, 102, 104, 110},
+	{104, 104, 106, 112}, {106, 106, 108, 114}, {108, 108, 110, 116}, {110, 110, 112, 118},
+	{112, 112, 114, 120}, {114, 114, 116, 122}, {116, 116, 118, 124}, {118, 118, 120, 126},
+	{120, 120, 122, 128}, {122, 122, 124, 130}, {124, 124, 126, 132}, {126, 126, 128, 134},
+},
+{
+	{0, 5, 10, 24}, {2, 7, 12, 26}, {4, 9, 14, 28}, {6, 11, 16, 30},
+	{8, 13, 18, 32}, {10, 15, 20, 34}, {12, 17, 22, 36}, {14, 19, 24, 38},
+	{16, 21, 26, 40}, {18, 23, 28, 42}, {20, 25, 30, 44}, {22, 27, 32, 46},
+	{24, 29, 34, 48}, {26, 31, 36, 50}, {28, 33, 38, 52}, {30, 35, 40, 54},
+	{32, 37, 42, 56}, {34, 39, 44, 58}, {36, 41, 46, 60}, {38, 43, 48, 62},
+	{40, 45, 50, 64}, {42, 47, 52, 66}, {44, 49, 54, 68}, {46, 51, 56, 70},
+	{48, 53, 58, 72}, {50, 55, 60, 74}, {52, 57, 62, 76}, {54, 59, 64, 78},
+	{56, 61, 66, 80}, {58, 63, 68, 82}, {60, 65, 70, 84}, {62, 67, 72, 86},
+	{64, 69, 74, 88}, {66, 71, 76, 90}, {68, 73, 78, 92}, {70, 75, 80, 94},
+	{72, 77, 82, 96}, {74, 79, 84, 98}, {76, 81, 86, 100}, {78, 83, 88, 102},
+	{80, 85, 90, 104}, {82, 87, 92, 106}, {84, 89, 94, 108}, {86, 91, 96, 110},
+	{88, 93, 98, 112}, {90, 95, 100, 114}, {92, 97, 102, 116}, {94, 99, 104, 118},
+	{96, 101, 106, 120}, {98, 103, 108, 122}, {100, 105, 110, 124}, {102, 107, 112, 126},
+	{104, 109, 114, 128}, {106, 111, 116, 130}, {108, 113, 118, 132}, {110, 115, 120, 134},
+	{112, 117, 122, 136}, {114, 119, 124, 138}, {116, 121, 126, 140}, {118, 123, 128, 142},
+	{120, 125, 130, 144}, {122, 127, 132, 146}, {124, 129, 134, 148}, {126, 131, 136, 150},
+},
+{
+	{0, 8, 18, 40}, {2, 10, 20, 42}, {4, 12, 22, 44}, {6, 14, 24, 46},
+	{8, 16, 26, 48}, {10, 18, 28, 50}, {12, 20, 30, 52}, {14, 22, 32, 54},
+	{16, 24, 34, 56}, {18, 26, 36, 58}, {20, 28, 38, 60}, {22, 30, 40, 62},
+	{24, 32, 42, 64}, {26, 34, 44, 66}, {28, 36, 46, 68}, {30, 38, 48, 70},
+	{32, 40, 50, 72}, {34, 42, 52, 74}, {36, 44, 54, 76}, {38, 46, 56, 78},
+	{40, 48, 58, 80}, {42, 50, 60, 82}, {44, 52, 62, 84}, {46, 54, 64, 86},
+	{48, 56, 66, 88}, {50, 58, 68, 90}, {52, 60, 70, 92}, {54, 62, 72, 94},
+	{56, 64, 74, 96}, {58, 66, 76, 98}, {60, 68, 78, 100}, {62, 70, 80, 102},
+	{64, 72, 82, 104}, {66, 74, 84, 106}, {68, 76, 86, 108}, {70, 78, 88, 110},
+	{72, 80, 90, 112}, {74, 82, 92, 114}, {76, 84, 94, 116}, {78, 86, 96, 118},
+	{80, 88, 98, 120}, {82, 90, 100, 122}, {84, 92, 102, 124}, {86, 94, 104, 126},
+	{88, 96, 106, 128}, {90, 98, 108, 130}, {92, 100, 110, 132}, {94, 102, 112, 134},
+	{96, 104, 114, 136}, {98, 106, 116, 138}, {100, 108, 118, 140}, {102, 110, 120, 142},
+	{104, 112, 122, 144}, {106, 114, 124, 146}, {108, 116, 126, 148}, {110, 118, 128, 150},
+	{112, 120, 130, 152}, {114, 122, 132, 154}, {116, 124, 134, 156}, {118, 126, 136, 158},
+	{120, 128, 138, 160}, {122, 130, 140, 162}, {124, 132, 142, 164}, {126, 134, 144, 166},
+},
+{
+	{0, 13, 26, 56}, {2, 15, 28, 58}, {4, 17, 30, 60}, {6, 19, 32, 62},
+	{8, 21, 34, 64}, {10, 23, 36, 66}, {12, 25, 38, 68}, {14, 27, 40, 70},
+	{16, 29, 42, 72}, {18, 31, 44, 74}, {20, 33, 46, 76}, {22, 35, 48, 78},
+	{24, 37, 50, 80}, {26, 39, 52, 82}, {28, 41, 54, 84}, {30, 43, 56, 86},
+	{32, 45, 58, 88}, {34, 47, 60, 90}, {36, 49, 62, 92}, {38, 51, 64, 94},
+	{40, 53, 66, 96}, {42, 55, 68, 98}, {44, 57, 70, 100}, {46, 59, 72, 102},
+	{48, 61, 74, 104}, {50, 63, 76, 106}, {52, 65, 78, 108}, {54, 67, 80, 110},
+	{56, 69, 82, 112}, {58, 71, 84, 114}, {60, 73, 86, 116}, {62, 75, 88, 118},
+	{64, 77, 90, 120}, {66, 79, 92, 122}, {68, 81, 94, 124}, {70, 83, 96, 126},
+	{72, 85, 98, 128}, {74, 87, 100, 130}, {76, 89, 102, 132}, {78, 91, 104, 134},
+	{80, 93, 106, 136}, {82, 95, 108, 138}, {84, 97, 110, 140}, {86, 99, 112, 142},
+	{88, 101, 114, 144}, {90, 103, 116, 146}, {92, 105, 118, 148}, {94, 107, 120, 150},
+	{96, 109, 122, 152}, {98, 111, 124, 154}, {100, 113, 126, 156}, {102, 115, 128, 158},
+	{104, 117, 130, 160}, {106, 119, 132, 162}, {108, 121, 134, 164}, {110, 123, 136, 166},
+	{112, 125, 138, 168}, {114, 127, 140, 170}, {116, 129, 142, 172}, {118, 131, 144, 174},
+	{120, 133, 146, 176}, {122, 135, 148, 178}, {124, 137, 150, 180}, {126, 139, 152, 182},
+},
+{
+	{0, 16, 34, 72}, {2, 18, 36, 74}, {4, 20, 38, 76}, {6, 22, 40, 78},
+	{8, 24, 42, 80}, {10, 26, 44, 82}, {12, 28, 46, 84}, {14, 30, 48, 86},
+	{16, 32, 50, 88}, {18, 34, 52, 90}, {20, 36, 54, 92}, {22, 38, 56, 94},
+	{24, 40, 58, 96}, {26, 42, 60, 98}, {28, 44, 62, 100}, {30, 46, 64, 102},
+	{32, 48, 66, 104}, {34, 50, 68, 106}, {36, 52, 70, 108}, {38, 54, 72, 110},
+	{40, 56, 74, 112}, {42, 58, 76, 114}, {44, 60, 78, 116}, {46, 62, 80, 118},
+	{48, 64, 82, 120}, {50, 66, 84, 122}, {52, 68, 86, 124}, {54, 70, 88, 126},
+	{56, 72, 90, 128}, {58, 74, 92, 130}, {60, 76, 94, 132}, {62, 78, 96, 134},
+	{64, 80, 98, 136}, {66, 82, 100, 138}, {68, 84, 102, 140}, {70, 86, 104, 142},
+	{72, 88, 106, 144}, {74, 90, 108, 146}, {76, 92, 110, 148}, {78, 94, 112, 150},
+	{80, 96, 114, 152}, {82, 98, 116, 154}, {84, 100, 118, 156}, {86, 102, 120, 158},
+	{88, 104, 122, 160}, {90, 106, 124, 162}, {92, 108, 126, 164}, {94, 110, 128, 166},
+	{96, 112, 130, 168}, {98, 114, 132, 170}, {100, 116, 134, 172}, {102, 118, 136, 174},
+	{104, 120, 138, 176}, {106, 122, 140, 178}, {108, 124, 142, 180}, {110, 126, 144, 182},
+	{112, 128, 146, 184}, {114, 130, 148, 186}, {116, 132, 150, 188}, {118, 134, 152, 190},
+	{120, 136, 154, 192}, {122, 138, 156, 194}, {124, 140, 158, 196}, {126, 142, 160, 198},
+},
+{
+	{0, 21, 42, 88}, {2, 23, 44, 90}, {4, 25, 46, 92}, {6, 27, 48, 94},
+	{8, 29, 50, 96}, {10, 31, 52, 98}, {12, 33, 54, 100}, {14, 35, 56, 102},
+	{16, 37, 58, 104}, {18, 39, 60, 106}, {20, 41, 62, 108}, {22, 43, 64, 110},
+	{24, 45, 66, 112}, {26, 47, 68, 114}, {28, 49, 70, 116}, {30, 51, 72, 118},
+	{32, 53, 74, 120}, {34, 55, 76, 122}, {36, 57, 78, 124}, {38, 59, 80, 126},
+	{40, 61, 82, 128}, {42, 63, 84, 130}, {44, 65, 86, 132}, {46, 67, 88, 134},
+	{48, 69, 90, 136}, {50, 71, 92, 138}, {52, 73, 94, 140}, {54, 75, 96, 142},
+	{56, 77, 98, 144}, {58, 79, 100, 146}, {60, 81, 102, 148}, {62, 83, 104, 150},
+	{64, 85, 106, 152}, {66, 87, 108, 154}, {68, 89, 110, 156}, {70, 91, 112, 158},
+	{72, 93, 114, 160}, {74, 95, 116, 162}, {76, 97, 118, 164}, {78, 99, 120, 166},
+	{80, 101, 122, 168}, {82, 103, 124, 170}, {84, 105, 126, 172}, {86, 107, 128, 174},
+	{88, 109, 130, 176}, {90, 111, 132, 178}, {92, 113, 134, 180}, {94, 115, 136, 182},
+	{96, 117, 138, 184}, {98, 119, 140, 186}, {100, 121, 142, 188}, {102, 123, 144, 190},
+	{104, 125, 146, 192}, {106, 127, 148, 194}, {108, 129, 150, 196}, {110, 131, 152, 198},
+	{112, 133, 154, 200}, {114, 135, 156, 202}, {116, 137, 158, 204}, {118, 139, 160, 206},
+	{120, 141, 162, 208}, {122, 143, 164, 210}, {124, 145, 166, 212}, {126, 147, 168, 214},
+},
+{
+	{0, 24, 50, 104}, {2, 26, 52, 106}, {4, 28, 54, 108}, {6, 30, 56, 110},
+	{8, 32, 58, 112}, {10, 34, 60, 114}, {12, 36, 62, 116}, {14, 38, 64, 118},
+	{16, 40, 66, 120}, {18, 42, 68, 122}, {20, 44, 70, 124}, {22, 46, 72, 126},
+	{24, 48, 74, 128}, {26, 50, 76, 130}, {28, 52, 78, 132}, {30, 54, 80, 134},
+	{32, 56, 82, 136}, {34, 58, 84, 138}, {36, 60, 86, 140}, {38, 62, 88, 142},
+	{40, 64, 90, 144}, {42, 66, 92, 146}, {44, 68, 94, 148}, {46, 70, 96, 150},
+	{48, 72, 98, 152}, {50, 74, 100, 154}, {52, 76, 102, 156}, {54, 78, 104, 158},
+	{56, 80, 106, 160}, {58, 82, 108, 162}, {60, 84, 110, 164}, {62, 86, 112, 166},
+	{64, 88, 114, 168}, {66, 90, 116, 170}, {68, 92, 118, 172}, {70, 94, 120, 174},
+	{72, 96, 122, 176}, {74, 98, 124, 178}, {76, 100, 126, 180}, {78, 102, 128, 182},
+	{80, 104, 130, 184}, {82, 106, 132, 186}, {84, 108, 134, 188}, {86, 110, 136, 190},
+	{88, 112, 138, 192}, {90, 114, 140, 194}, {92, 116, 142, 196}, {94, 118, 144, 198},
+	{96, 120, 146, 200}, {98, 122, 148, 202}, {100, 124, 150, 204}, {102, 126, 152, 206},
+	{104, 128, 154, 208}, {106, 130, 156, 210}, {108, 132, 158, 212}, {110, 134, 160, 214},
+	{112, 136, 162, 216}, {114, 138, 164, 218}, {116, 140, 166, 220}, {118, 142, 168, 222},
+	{120, 144, 170, 224}, {122, 146, 172, 226}, {124, 148, 174, 228}, {126, 150, 176, 230},
+},
+},
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 0, 2, 8}, {2, 2, 4, 10}, {4, 4, 6, 12}, {6, 6, 8, 14},
+	{8, 8, 10, 16}, {10, 10, 12, 18}, {12, 12, 14, 20}, {14, 14, 16, 22},
+	{16, 16, 18, 24}, {18, 18, 20, 26}, {20, 20, 22, 28}, {22, 22, 24, 30},
+	{24, 24, 26, 32}, {26, 26, 28, 34}, {28, 28, 30, 36}, {30, 30, 32, 38},
+	{32, 32, 34, 40}, {34, 34, 36, 42}, {36, 36, 38, 44}, {38, 38, 40, 46},
+	{40, 40, 42, 48}, {42, 42, 44, 50}, {44, 44, 46, 52}, {46, 46, 48, 54},
+	{48, 48, 50, 56}, {50, 50, 52, 58}, {52, 52, 54, 60}, {54, 54, 56, 62},
+	{56, 56, 58, 64}, {58, 58, 60, 66}, {60, 60, 62, 68}, {62, 62, 64, 70},
+	{64, 64, 66, 72}, {66, 66, 68, 74}, {68, 68, 70, 76}, {70, 70, 72, 78},
+	{72, 72, 74, 80}, {74, 74, 76, 82}, {76, 76, 78, 84}, {78, 78, 80, 86},
+	{80, 80, 82, 88}, {82, 82, 84, 90}, {84, 84, 86, 92}, {86, 86, 88, 94},
+	{88, 88, 90, 96}, {90, 90, 92, 98}, {92, 92, 94, 100}, {94, 94, 96, 102},
+	{96, 96, 98, 104}, {98, 98, 100, 106}, {100, 100, 102, 108}, {102, 102, 104, 110},
+	{104, 104, 106, 112}, {106, 106, 108, 114}, {108, 108, 110, 116}, {110, 110, 112, 118},
+	{112, 112, 114, 120}, {114, 114, 116, 122}, {116, 116, 118, 124}, {118, 118, 120, 126},
+	{120, 120, 122, 128}, {122, 122, 124, 130}, {124, 124, 126, 132}, {126, 126, 128, 134},
+},
+{
+	{0, 5, 10, 24}, {2, 7, 12, 26}, {4, 9, 14, 28}, {6, 11, 16, 30},
+	{8, 13, 18, 32}, {10, 15, 20, 34}, {12, 17, 22, 36}, {14, 19, 24, 38},
+	{16, 21, 26, 40}, {18, 23, 28, 42}, {20, 25, 30, 44}, {22, 27, 32, 46},
+	{24, 29, 34, 48}, {26, 31, 36, 50}, {28, 33, 38, 52}, {30, 35, 40, 54},
+	{32, 37, 42, 56}, {34, 39, 44, 58}, {36, 41, 46, 60}, {38, 43, 48, 62},
+	{40, 45, 50, 64}, {42, 47, 52, 66}, {44, 49, 54, 68}, {46, 51, 56, 70},
+	{48, 53, 58, 72}, {50, 55, 60, 74}, {52, 57, 62, 76}, {54, 59, 64, 78},
+	{56, 61, 66, 80}, {58, 63, 68, 82}, {60, 65, 70, 84}, {62, 67, 72, 86},
+	{64, 69, 74, 88}, {66, 71, 76, 90}, {68, 73, 78, 92}, {70, 75, 80, 94},
+	{72, 77, 82, 96}, {74, 79, 84, 98}, {76, 81, 86, 100}, {78, 83, 88, 102},
+	{80, 85, 90, 104}, {82, 87, 92, 106}, {84, 89, 94, 108}, {86, 91, 96, 110},
+	{88, 93, 98, 112}, {90, 95, 100, 114}, {92, 97, 102, 116}, {94, 99, 104, 118},
+	{96, 101, 106, 120}, {98, 103, 108, 122}, {100, 105, 110, 124}, {102, 107, 112, 126},
+	{104, 109, 114, 128}, {106, 111, 116, 130}, {108, 113, 118, 132}, {110, 115, 120, 134},
+	{112, 117, 122, 136}, {114, 119, 124, 138}, {116, 121, 126, 140}, {118, 123, 128, 142},
+	{120, 125, 130, 144}, {122, 127, 132, 146}, {124, 129, 134, 148}, {126, 131, 136, 150},
+},
+{
+	{0, 8, 18, 40}, {2, 10, 20, 42}, {4, 12, 22, 44}, {6, 14, 24, 46},
+	{8, 16, 26, 48}, {10, 18, 28, 50}, {12, 20, 30, 52}, {14, 22, 32, 54},
+	{16, 24, 34, 56}, {18, 26, 36, 58}, {20, 28, 38, 60}, {22, 30, 40, 62},
+	{24, 32, 42, 64}, {26, 34, 44, 66}, {28, 36, 46, 68}, {30, 38, 48, 70},
+	{32, 40, 50, 72}, {34, 42, 52, 74}, {36, 44, 54, 76}, {38, 46, 56, 78},
+	{40, 48, 58, 80}, {42, 50, 60, 82}, {44, 52, 62, 84}, {46, 54, 64, 86},
+	{48, 56, 66, 88}, {50, 58, 68, 90}, {52, 60, 70, 92}, {54, 62, 72, 94},
+	{56, 64, 74, 96}, {58, 66, 76, 98}, {60, 68, 78, 100}, {62, 70, 80, 102},
+	{64, 72, 82, 104}, {66, 74, 84, 106}, {68, 76, 86, 108}, {70, 78, 88, 110},
+	{72, 80, 90, 112}, {74, 82, 92, 114}, {76, 84, 94, 116}, {78, 86, 96, 118},
+	{80, 88, 98, 120}, {82, 90, 100, 122}, {84, 92, 102, 124}, {86, 94, 104, 126},
+	{88, 96, 106, 128}, {90, 98, 108, 130}, {92, 100, 110, 132}, {94, 102, 112, 134},
+	{96, 104, 114, 136}, {98, 106, 116, 138}, {100, 108, 118, 140}, {102, 110, 120, 142},
+	{104, 112, 122, 144}, {106, 114, 124, 146}, {108, 116, 126, 148}, {110, 118, 128, 150},
+	{112, 120, 130, 152}, {114, 122, 132, 154}, {116, 124, 134, 156}, {118, 126, 136, 158},
+	{120, 128, 138, 160}, {122, 130, 140, 162}, {124, 132, 142, 164}, {126, 134, 144, 166},
+},
+{
+	{0, 13, 26, 56}, {2, 15, 28, 58}, {4, 17, 30, 60}, {6, 19, 32, 62},
+	{8, 21, 34, 64}, {10, 23, 36, 66}, {12, 25, 38, 68}, {14, 27, 40, 70},
+	{16, 29, 42, 72}, {18, 31, 44, 74}, {20, 33, 46, 76}, {22, 35, 48, 78},
+	{24, 37, 50, 80}, {26, 39, 52, 82}, {28, 41, 54, 84}, {30, 43, 56, 86},
+	{32, 45, 58, 88}, {34, 47, 60, 90}, {36, 49, 62, 92}, {38, 51, 64, 94},
+	{40, 53, 66, 96}, {42, 55, 68, 98}, {44, 57, 70, 100}, {46, 59, 72, 102},
+	{48, 61, 74, 104}, {50, 63, 76, 106}, {52, 65, 78, 108}, {54, 67, 80, 110},
+	{56, 69, 82, 112}, {58, 71, 84, 114}, {60, 73, 86, 116}, {62, 75, 88, 118},
+	{64, 77, 90, 120}, {66, 79, 92, 122}, {68, 81, 94, 124}, {70, 83, 96, 126},
+	{72, 85, 98, 128}, {74, 87, 100, 130}, {76, 89, 102, 132}, {78, 91, 104, 134},
+	{80, 93, 106, 136}, {82, 95, 108, 138}, {84, 97, 110, 140}, {86, 99, 112, 142},
+	{88, 101, 114, 144}, {90, 103, 116, 146}, {92, 105, 118, 148}, {94, 107, 120, 150},
+	{96, 109, 122, 152}, {98, 111, 124, 154}, {100, 113, 126, 156}, {102, 115, 128, 158},
+	{104, 117, 130, 160}, {106, 119, 132, 162}, {108, 121, 134, 164}, {110, 123, 136, 166},
+	{112, 125, 138, 168}, {114, 127, 140, 170}, {116, 129, 142, 172}, {118, 131, 144, 174},
+	{120, 133, 146, 176}, {122, 135, 148, 178}, {124, 137, 150, 180}, {126, 139, 152, 182},
+},
+{
+	{0, 16, 34, 72}, {2, 18, 36, 74}, {4, 20, 38, 76}, {6, 22, 40, 78},
+	{8, 24, 42, 80}, {10, 26, 44, 82}, {12, 28, 46, 84}, {14, 30, 48, 86},
+	{16, 32, 50, 88}, {18, 34, 52, 90}, {20, 36, 54, 92}, {22, 38, 56, 94},
+	{24, 40, 58, 96}, {26, 42, 60, 98}, {28, 44, 62, 100}, {30, 46, 64, 102},
+	{32, 48, 66, 104}, {34, 50, 68, 106}, {36, 52, 70, 108}, {38, 54, 72, 110},
+	{40, 56, 74, 112}, {42, 58, 76, 114}, {44, 60, 78, 116}, {46, 62, 80, 118},
+	{48, 64, 82, 120}, {50, 66, 84, 122}, {52, 68, 86, 124}, {54, 70, 88, 126},
+	{56, 72, 90, 128}, {58, 74, 92, 130}, {60, 76, 94, 132}, {62, 78, 96, 134},
+	{64, 80, 98, 136}, {66, 82, 100, 138}, {68, 84, 102, 140}, {70, 86, 104, 142},
+	{72, 88, 106, 144}, {74, 90, 108, 146}, {76, 92, 110, 148}, {78, 94, 112, 150},
+	{80, 96, 114, 152}, {82, 98, 116, 154}, {84, 100, 118, 156}, {86, 102, 120, 158},
+	{88, 104, 122, 160}, {90, 106, 124, 162}, {92, 108, 126, 164}, {94, 110, 128, 166},
+	{96, 112, 130, 168}, {98, 114, 132, 170}, {100, 116, 134, 172}, {102, 118, 136, 174},
+	{104, 120, 138, 176}, {106, 122, 140, 178}, {108, 124, 142, 180}, {110, 126, 144, 182},
+	{112, 128, 146, 184}, {114, 130, 148, 186}, {116, 132, 150, 188}, {118, 134, 152, 190},
+	{120, 136, 154, 192}, {122, 138, 156, 194}, {124, 140, 158, 196}, {126, 142, 160, 198},
+},
+{
+	{0, 21, 42, 88}, {2, 23, 44, 90}, {4, 25, 46, 92}, {6, 27, 48, 94},
+	{8, 29, 50, 96}, {10, 31, 52, 98}, {12, 33, 54, 100}, {14, 35, 56, 102},
+	{16, 37, 58, 104}, {18, 39, 60, 106}, {20, 41, 62, 108}, {22, 43, 64, 110},
+	{24, 45, 66, 112}, {26, 47, 68, 114}, {28, 49, 70, 116}, {30, 51, 72, 118},
+	{32, 53, 74, 120}, {34, 55, 76, 122}, {36, 57, 78, 124}, {38, 59, 80, 126},
+	{40, 61, 82, 128}, {42, 63, 84, 130}, {44, 65, 86, 132}, {46, 67, 88, 134},
+	{48, 69, 90, 136}, {50, 71, 92, 138}, {52, 73, 94, 140}, {54, 75, 96, 142},
+	{56, 77, 98, 144}, {58, 79, 100, 146}, {60, 81, 102, 148}, {62, 83, 104, 150},
+	{64, 85, 106, 152}, {66, 87, 108, 154}, {68, 89, 110, 156}, {70, 91, 112, 158},
+	{72, 93, 114, 160}, {74, 95, 116, 162}, {76, 97, 118, 164}, {78, 99, 120, 166},
+	{80, 101, 122, 168}, {82, 103, 124, 170}, {84, 105, 126, 172}, {86, 107, 128, 174},
+	{88, 109, 130, 176}, {90, 111, 132, 178}, {92, 113, 134, 180}, {94, 115, 136, 182},
+	{96, 117, 138, 184}, {98, 119, 140, 186}, {100, 121, 142, 188}, {102, 123, 144, 190},
+	{104, 125, 146, 192}, {106, 127, 148, 194}, {108, 129, 150, 196}, {110, 131, 152, 198},
+	{112, 133, 154, 200}, {114, 135, 156, 202}, {116, 137, 158, 204}, {118, 139, 160, 206},
+	{120, 141, 162, 208}, {122, 143, 164, 210}, {124, 145, 166, 212}, {126, 147, 168, 214},
+},
+{
+	{0, 24, 50, 104}, {2, 26, 52, 106}, {4, 28, 54, 108}, {6, 30, 56, 110},
+	{8, 32, 58, 112}, {10, 34, 60, 114}, {12, 36, 62, 116}, {14, 38, 64, 118},
+	{16, 40, 66, 120}, {18, 42, 68, 122}, {20, 44, 70, 124}, {22, 46, 72, 126},
+	{24, 48, 74, 128}, {26, 50, 76, 130}, {28, 52, 78, 132}, {30, 54, 80, 134},
+	{32, 56, 82, 136}, {34, 58, 84, 138}, {36, 60, 86, 140}, {38, 62, 88, 142},
+	{40, 64, 90, 144}, {42, 66, 92, 146}, {44, 68, 94, 148}, {46, 70, 96, 150},
+	{48, 72, 98, 152}, {50, 74, 100, 154}, {52, 76, 102, 156}, {54, 78, 104, 158},
+	{56, 80, 106, 160}, {58, 82, 108, 162}, {60, 84, 110, 164}, {62, 86, 112, 166},
+	{64, 88, 114, 168}, {66, 90, 116, 170}, {68, 92, 118, 172}, {70, 94, 120, 174},
+	{72, 96, 122, 176}, {74, 98, 124, 178}, {76, 100, 126, 180}, {78, 102, 128, 182},
+	{80, 104, 130, 184}, {82, 106, 132, 186}, {84, 108, 134, 188}, {86, 110, 136, 190},
+	{88, 112, 138, 192}, {90, 114, 140, 194}, {92, 116, 142, 196}, {94, 118, 144, 198},
+	{96, 120, 146, 200}, {98, 122, 148, 202}, {100, 124, 150, 204}, {102, 126, 152, 206},
+	{104, 128, 154, 208}, {106, 130, 156, 210}, {108, 132, 158, 212}, {110, 134, 160, 214},
+	{112, 136, 162, 216}, {114, 138, 164, 218}, {116, 140, 166, 220}, {118, 142, 168, 222},
+	{120, 144, 170, 224}, {122, 146, 172, 226}, {124, 148, 174, 228}, {126, 150, 176, 230},
+},
+},
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 2, 5, 10}, {2, 4, 7, 12}, {4, 6, 9, 14}, {6, 8, 11, 16},
+	{8, 10, 13, 18}, {10, 12, 15, 20}, {12, 14, 17, 22}, {14, 16, 19, 24},
+	{16, 18, 21, 26}, {18, 20, 23, 28}, {20, 22, 25, 30}, {22, 24, 27, 32},
+	{24, 26, 29, 34}, {26, 28, 31, 36}, {28, 30, 33, 38}, {30, 32, 35, 40},
+	{32, 34, 37, 42}, {34, 36, 39, 44}, {36, 38, 41, 46}, {38, 40, 43, 48},
+	{40, 42, 45, 50}, {42, 44, 47, 52}, {44, 46, 49, 54}, {46, 48, 51, 56},
+	{48, 50, 53, 58}, {50, 52, 55, 60}, {52, 54, 57, 62}, {54, 56, 59, 64},
+	{56, 58, 61, 66}, {58, 60, 63, 68}, {60, 62, 65, 70}, {62, 64, 67, 72},
+	{64, 66, 69, 74}, {66, 68, 71, 76}, {68, 70, 73, 78}, {70, 72, 75, 80},
+	{72, 74, 77, 82}, {74, 76, 79, 84}, {76, 78, 81, 86}, {78, 80, 83, 88},
+	{80, 82, 85, 90}, {82, 84, 87, 92}, {84, 86, 89, 94}, {86, 88, 91, 96},
+	{88, 90, 93, 98}, {90, 92, 95, 100}, {92, 94, 97, 102}, {94, 96, 99, 104},
+	{96, 98, 101, 106}, {98, 100, 103, 108}, {100, 102, 105, 110}, {102, 104, 107, 112},
+	{104, 106, 109, 114}, {106, 108, 111, 116}, {108, 110, 113, 118}, {110, 112, 115, 120},
+	{112, 114, 117, 122}, {114, 116, 119, 124}, {116, 118, 121, 126}, {118, 120, 123, 128},
+	{120, 122, 125, 130}, {122, 124, 127, 132}, {124, 126, 129, 134}, {126, 128, 131, 136},
+},
+{
+	{0, 5, 13, 26}, {2, 7, 15, 28}, {4, 9, 17, 30}, {6, 11, 19, 32},
+	{8, 13, 21, 34}, {10, 15, 23, 36}, {12, 17, 25, 38}, {14, 19, 27, 40},
+	{16, 21, 29, 42}, {18, 23, 31, 44}, {20, 25, 33, 46}, {22, 27, 35, 48},
+	{24, 29, 37, 50}, {26, 31, 39, 52}, {28, 33, 41, 54}, {30, 35, 43, 56},
+	{32, 37, 45, 58}, {34, 39, 47, 60}, {36, 41, 49, 62}, {38, 43, 51, 64},
+	{40, 45, 53, 66}, {42, 47, 55, 68}, {44, 49, 57, 70}, {46, 51, 59, 72},
+	{48, 53, 61, 74}, {50, 55, 63, 76}, {52, 57, 65, 78}, {54, 59, 67, 80},
+	{56, 61, 69, 82}, {58, 63, 71, 84}, {60, 65, 73, 86}, {62, 67, 75, 88},
+	{64, 69, 77, 90}, {66, 71, 79, 92}, {68, 73, 81, 94}, {70, 75, 83, 96},
+	{72, 77, 85, 98}, {74, 79, 87, 100}, {76, 81, 89, 102}, {78, 83, 91, 104},
+	{80, 85, 93, 106}, {82, 87, 95, 108}, {84, 89, 97, 110}, {86, 91, 99, 112},
+	{88, 93, 101, 114}, {90, 95, 103, 116}, {92, 97, 105, 118}, {94, 99, 107, 120},
+	{96, 101, 109, 122}, {98, 103, 111, 124}, {100, 105, 113, 126}, {102, 107, 115, 128},
+	{104, 109, 117, 130}, {106, 111, 119, 132}, {108, 113, 121, 134}, {110, 115, 123, 136},
+	{112, 117, 125, 138}, {114, 119, 127, 140}, {116, 121, 129, 142}, {118, 123, 131, 144},
+	{120, 125, 133, 146}, {122, 127, 135, 148}, {124, 129, 137, 150}, {126, 131, 139, 152},
+},
+{
+	{0, 10, 21, 42}, {2, 12, 23, 44}, {4, 14, 25, 46}, {6, 16, 27, 48},
+	{8, 18, 29, 50}, {10, 20, 31, 52}, {12, 22, 33, 54}, {14, 24, 35, 56},
+	{16, 26, 37, 58}, {18, 28, 39, 60}, {20, 30, 41, 62}, {22, 32, 43, 64},
+	{24, 34, 45, 66}, {26, 36, 47, 68}, {28, 38, 49, 70}, {30, 40, 51, 72},
+	{32, 42, 53, 74}, {34, 44, 55, 76}, {36, 46, 57, 78}, {38, 48, 59, 80},
+	{40, 50, 61, 82}, {42, 52, 63, 84}, {44, 54, 65, 86}, {46, 56, 67, 88},
+	{48, 58, 69, 90}, {50, 60, 71, 92}, {52, 62, 73, 94}, {54, 64, 75, 96},
+	{56, 66, 77, 98}, {58, 68, 79, 100}, {60, 70, 81, 102}, {62, 72, 83, 104},
+	{64, 74, 85, 106}, {66, 76, 87, 108}, {68, 78, 89, 110}, {70, 80, 91, 112},
+	{72, 82, 93, 114}, {74, 84, 95, 116}, {76, 86, 97, 118}, {78, 88, 99, 120},
+	{80, 90, 101, 122}, {82, 92, 103, 124}, {84, 94, 105, 126}, {86, 96, 107, 128},
+	{88, 98, 109, 130}, {90, 100, 111, 132}, {92, 102, 113, 134}, {94, 104, 115, 136},
+	{96, 106, 117, 138}, {98, 108, 119, 140}, {100, 110, 121, 142}, {102, 112, 123, 144},
+	{104, 114, 125, 146}, {106, 116, 127, 148}, {108, 118, 129, 150}, {110, 120, 131, 152},
+	{112, 122, 133, 154}, {114, 124, 135, 156}, {116, 126, 137, 158}, {118, 128, 139, 160},
+	{120, 130, 141, 162}, {122, 132, 143, 164}, {124, 134, 145, 166}, {126, 136, 147, 168},
+},
+{
+	{0, 13, 29, 58}, {2, 15, 31, 60}, {4, 17, 33, 62}, {6, 19, 35, 64},
+	{8, 21, 37, 66}, {10, 23, 39, 68}, {12, 25, 41, 70}, {14, 27, 43, 72},
+	{16, 29, 45, 74}, {18, 31, 47, 76}, {20, 33, 49, 78}, {22, 35, 51, 80},
+	{24, 37, 53, 82}, {26, 39, 55, 84}, {28, 41, 57, 86}, {30, 43, 59, 88},
+	{32, 45, 61, 90}, {34, 47, 63, 92}, {36, 49, 65, 94}, {38, 51, 67, 96},
+	{40, 53, 69, 98}, {42, 55, 71, 100}, {44, 57, 73, 102}, {46, 59, 75, 104},
+	{48, 61, 77, 106}, {50, 63, 79, 108}, {52, 65, 81, 110}, {54, 67, 83, 112},
+	{56, 69, 85, 114}, {58, 71, 87, 116}, {60, 73, 89, 118}, {62, 75, 91, 120},
+	{64, 77, 93, 122}, {66, 79, 95, 124}, {68, 81, 97, 126}, {70, 83, 99, 128},
+	{72, 85, 101, 130}, {74, 87, 103, 132}, {76, 89, 105, 134}, {78, 91, 107, 136},
+	{80, 93, 109, 138}, {82, 95, 111, 140}, {84, 97, 113, 142}, {86, 99, 115, 144},
+	{88, 101, 117, 146}, {90, 103, 119, 148}, {92, 105, 121, 150}, {94, 107, 123, 152},
+	{96, 109, 125, 154}, {98, 111, 127, 156}, {100, 113, 129, 158}, {102, 115, 131, 160},
+	{104, 117, 133, 162}, {106, 119, 135, 164}, {108, 121, 137, 166}, {110, 123, 139, 168},
+	{112, 125, 141, 170}, {114, 127, 143, 172}, {116, 129, 145, 174}, {118, 131, 147, 176},
+	{120, 133, 149, 178}, {122, 135, 151, 180}, {124, 137, 153, 182}, {126, 139, 155, 184},
+},
+{
+	{0, 18, 37, 74}, {2, 20, 39, 76}, {4, 22, 41, 78}, {6, 24, 43, 80},
+	{8, 26, 45, 82}, {10, 28, 47, 84}, {12, 30, 49, 86}, {14, 32, 51, 88},
+	{16, 34, 53, 90}, {18, 36, 55, 92}, {20, 38, 57, 94}, {22, 40, 59, 96},
+	{24, 42, 61, 98}, {26, 44, 63, 100}, {28, 46, 65, 102}, {30, 48, 67, 104},
+	{32, 50, 69, 106}, {34, 52, 71, 108}, {36, 54, 73, 110}, {38, 56, 75, 112},
+	{40, 58, 77, 114}, {42, 60, 79, 116}, {44, 62, 81, 118}, {46, 64, 83, 120},
+	{48, 66, 85, 122}, {50, 68, 87, 124}, {52, 70, 89, 126}, {54, 72, 91, 128},
+	{56, 74, 93, 130}, {58, 76, 95, 132}, {60, 78, 97, 134}, {62, 80, 99, 136},
+	{64, 82, 101, 138}, {66, 84, 103, 140}, {68, 86, 105, 142}, {70, 88, 107, 144},
+	{72, 90, 109, 146}, {74, 92, 111, 148}, {76, 94, 113, 150}, {78, 96, 115, 152},
+	{80, 98, 117, 154}, {82, 100, 119, 156}, {84, 102, 121, 158}, {86, 104, 123, 160},
+	{88, 106, 125, 162}, {90, 108, 127, 164}, {92, 110, 129, 166}, {94, 112, 131, 168},
+	{96, 114, 133, 170}, {98, 116, 135, 172}, {100, 118, 137, 174}, {102, 120, 139, 176},
+	{104, 122, 141, 178}, {106, 124, 143, 180}, {108, 126, 145, 182}, {110, 128, 147, 184},
+	{112, 130, 149, 186}, {114, 132, 151, 188}, {116, 134, 153, 190}, {118, 136, 155, 192},
+	{120, 138, 157, 194}, {122, 140, 159, 196}, {124, 142, 161, 198}, {126, 144, 163, 200},
+},
+{
+	{0, 21, 45, 90}, {2, 23, 47, 92}, {4, 25, 49, 94}, {6, 27, 51, 96},
+	{8, 29, 53, 98}, {10, 31, 55, 100}, {12, 33, 57, 102}, {14, 35, 59, 104},
+	{16, 37, 61, 106}, {18, 39, 63, 108}, {20, 41, 65, 110}, {22, 43, 67, 112},
+	{24, 45, 69, 114}, {26, 47, 71, 116}, {28, 49, 73, 118}, {30, 51, 75, 120},
+	{32, 53, 77, 122}, {34, 55, 79, 124}, {36, 57, 81, 126}, {38, 59, 83, 128},
+	{40, 61, 85, 130}, {42, 63, 87, 132}, {44, 65, 89, 134}, {46, 67, 91, 136},
+	{48, 69, 93, 138}, {50, 71, 95, 140}, {52, 73, 97, 142}, {54, 75, 99, 144},
+	{56, 77, 101, 146}, {58, 79, 103, 148}, {60, 81, 105, 150}, {62, 83, 107, 152},
+	{64, 85, 109, 154}, {66, 87, 111, 156}, {68, 89, 113, 158}, {70, 91, 115, 160},
+	{72, 93, 117, 162}, {74, 95, 119, 164}, {76, 97, 121, 166}, {78, 99, 123, 168},
+	{80, 101, 125, 170}, {82, 103, 127, 172}, {84, 105, 129, 174}, {86, 107, 131, 176},
+	{88, 109, 133, 178}, {90, 111, 135, 180}, {92, 113, 137, 182}, {94, 115, 139, 184},
+	{96, 117, 141, 186}, {98, 119, 143, 188}, {100, 121, 145, 190}, {102, 123, 147, 192},
+	{104, 125, 149, 194}, {106, 127, 151, 196}, {108, 129, 153, 198}, {110, 131, 155, 200},
+	{112, 133, 157, 202}, {114, 135, 159, 204}, {116, 137, 161, 206}, {118, 139, 163, 208},
+	{120, 141, 165, 210}, {122, 143, 167, 212}, {124, 145, 169, 214}, {126, 147, 171, 216},
+},
+{
+	{0, 26, 53, 106}, {2, 28, 55, 108}, {4, 30, 57, 110}, {6, 32, 59, 112},
+	{8, 34, 61, 114}, {10, 36, 63, 116}, {12, 38, 65, 118}, {14, 40, 67, 120},
+	{16, 42, 69, 122}, {18, 44, 71, 124}, {20, 46, 73, 126}, {22, 48, 75, 128},
+	{24, 50, 77, 130}, {26, 52, 79, 132}, {28, 54, 81, 134}, {30, 56, 83, 136},
+	{32, 58, 85, 138}, {34, 60, 87, 140}, {36, 62, 89, 142}, {38, 64, 91, 144},
+	{40, 66, 93, 146}, {42, 68, 95, 148}, {44, 70, 97, 150}, {46, 72, 99, 152},
+	{48, 74, 101, 154}, {50, 76, 103, 156}, {52, 78, 105, 158}, {54, 80, 107, 160},
+	{56, 82, 109, 162}, {58, 84, 111, 164}, {60, 86, 113, 166}, {62, 88, 115, 168},
+	{64, 90, 117, 170}, {66, 92, 119, 172}, {68, 94, 121, 174}, {70, 96, 123, 176},
+	{72, 98, 125, 178}, {74, 100, 127, 180}, {76, 102, 129, 182}, {78, 104, 131, 184},
+	{80, 106, 133, 186}, {82, 108, 135, 188}, {84, 110, 137, 190}, {86, 112, 139, 192},
+	{88, 114, 141, 194}, {90, 116, 143, 196}, {92, 118, 145, 198}, {94, 120, 147, 200},
+	{96, 122, 149, 202}, {98, 124, 151, 204}, {100, 126, 153, 206}, {102, 128, 155, 208},
+	{104, 130, 157, 210}, {106, 132, 159, 212}, {108, 134, 161, 214}, {110, 136, 163, 216},
+	{112, 138, 165, 218}, {114, 140, 167, 220}, {116, 142, 169, 222}, {118, 144, 171, 224},
+	{120, 146, 173, 226}, {122, 148, 175, 228}, {124, 150, 177, 230}, {126, 152, 179, 232},
+},
+},
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 2, 5, 13}, {2, 4, 7, 15}, {4, 6, 9, 17}, {6, 8, 11, 19},
+	{8, 10, 13, 21}, {10, 12, 15, 23}, {12, 14, 17, 25}, {14, 16, 19, 27},
+	{16, 18, 21, 29}, {18, 20, 23, 31}, {20, 22, 25, 33}, {22, 24, 27, 35},
+	{24, 26, 29, 37}, {26, 28, 31, 39}, {28, 30, 33, 41}, {30, 32, 35, 43},
+	{32, 34, 37, 45}, {34, 36, 39, 47}, {36, 38, 41, 49}, {38, 40, 43, 51},
+	{40, 42, 45, 53}, {42, 44, 47, 55}, {44, 46, 49, 57}, {46, 48, 51, 59},
+	{48, 50, 53, 61}, {50, 52, 55, 63}, {52, 54, 57, 65}, {54, 56, 59, 67},
+	{56, 58, 61, 69}, {58, 60, 63, 71}, {60, 62, 65, 73}, {62, 64, 67, 75},
+	{64, 66, 69, 77}, {66, 68, 71, 79}, {68, 70, 73, 81}, {70, 72, 75, 83},
+	{72, 74, 77, 85}, {74, 76, 79, 87}, {76, 78, 81, 89}, {78, 80, 83, 91},
+	{80, 82, 85, 93}, {82, 84, 87, 95}, {84, 86, 89, 97}, {86, 88, 91, 99},
+	{88, 90, 93, 101}, {90, 92, 95, 103}, {92, 94, 97, 105}, {94, 96, 99, 107},
+	{96, 98, 101, 109}, {98, 100, 103, 111}, {100, 102, 105, 113}, {102, 104, 107, 115},
+	{104, 106, 109, 117}, {106, 108, 111, 119}, {108, 110, 113, 121}, {110, 112, 115, 123},
+	{112, 114, 117, 125}, {114, 116, 119, 127}, {116, 118, 121, 129}, {118, 120, 123, 131},
+	{120, 122, 125, 133}, {122, 124, 127, 135}, {124, 126, 129, 137}, {126, 128, 131, 139},
+},
+{
+	{0, 5, 13, 29}, {2, 7, 15, 31}, {4, 9, 17, 33}, {6, 11, 19, 35},
+	{8, 13, 21, 37}, {10, 15, 23, 39}, {12, 17, 25, 41}, {14, 19, 27, 43},
+	{16, 21, 29, 45}, {18, 23, 31, 47}, {20, 25, 33, 49}, {22, 27, 35, 51},
+	{24, 29, 37, 53}, {26, 31, 39, 55}, {28, 33, 41, 57}, {30, 35, 43, 59},
+	{32, 37, 45, 61}, {34, 39, 47, 63}, {36, 41, 49, 65}, {38, 43, 51, 67},
+	{40, 45, 53, 69}, {42, 47, 55, 71}, {44, 49, 57, 73}, {46, 51, 59, 75},
+	{48, 53, 61, 77}, {50, 55, 63, 79}, {52, 57, 65, 81}, {54, 59, 67, 83},
+	{56, 61, 69, 85}, {58, 63, 71, 87}, {60, 65, 73, 89}, {62, 67, 75, 91},
+	{64, 69, 77, 93}, {66, 71, 79, 95}, {68, 73, 81, 97}, {70, 75, 83, 99},
+	{72, 77, 85, 101}, {74, 79, 87, 103}, {76, 81, 89, 105}, {78, 83, 91, 107},
+	{80, 85, 93, 109}, {82, 87, 95, 111}, {84, 89, 97, 113}, {86, 91, 99, 115},
+	{88, 93, 101, 117}, {90, 95, 103, 119}, {92, 97, 105, 121}, {94, 99, 107, 123},
+	{96, 101, 109, 125}, {98, 103, 111, 127}, {100, 105, 113, 129}, {102, 107, 115, 131},
+	{104, 109, 117, 133}, {106, 111, 119, 135}, {108, 113, 121, 137}, {110, 115, 123, 139},
+	{112, 117, 125, 141}, {114, 119, 127, 143}, {116, 121, 129, 145}, {118, 123, 131, 147},
+	{120, 125, 133, 149}, {122, 127, 135, 151}, {124, 129, 137, 153}, {126, 131, 139, 155},
+},
+{
+	{0, 10, 21, 45}, {2, 12, 23, 47}, {4, 14, 25, 49}, {6, 16, 27, 51},
+	{8, 18, 29, 53}, {10, 20, 31, 55}, {12, 22, 33, 57}, {14, 24, 35, 59},
+	{16, 26, 37, 61}, {18, 28, 39, 63}, {20, 30, 41, 65}, {22, 32, 43, 67},
+	{24, 34, 45, 69}, {26, 36, 47, 71}, {28, 38, 49, 73}, {30, 40, 51, 75},
+	{32, 42, 53, 77}, {34, 44, 55, 79}, {36, 46, 57, 81}, {38, 48, 59, 83},
+	{40, 50, 61, 85}, {42, 52, 63, 87}, {44, 54, 65, 89}, {46, 56, 67, 91},
+	{48, 58, 69, 93}, {50, 60, 71, 95}, {52, 62, 73, 97}, {54, 64, 75, 99},
+	{56, 66, 77, 101}, {58, 68, 79, 103}, {60, 70, 81, 105}, {62, 72, 83, 107},
+	{64, 74, 85, 109}, {66, 76, 87, 111}, {68, 78, 89, 113}, {70, 80, 91, 115},
+	{72, 82, 93, 117}, {74, 84, 95, 119}, {76, 86, 97, 121}, {78, 88, 99, 123},
+	{80, 90, 101, 125}, {82, 92, 103, 127}, {84, 94, 105, 129}, {86, 96, 107, 131},
+	{88, 98, 109, 133}, {90, 100, 111, 135}, {92, 102, 113, 137}, {94, 104, 115, 139},
+	{96, 106, 117, 141}, {98, 108, 119, 143}, {100, 110, 121, 145}, {102, 112, 123, 147},
+	{104, 114, 125, 149}, {106, 116, 127, 151}, {108, 118, 129, 153}, {110, 120, 131, 155},
+	{112, 122, 133, 157}, {114, 124, 135, 159}, {116, 126, 137, 161}, {118, 128, 139, 163},
+	{120, 130, 141, 165}, {122, 132, 143, 167}, {124, 134, 145, 169}, {126, 136, 147, 171},
+},
+{
+	{0, 13, 29, 61}, {2, 15, 31, 63}, {4, 17, 33, 65}, {6, 19, 35, 67},
+	{8, 21, 37, 69}, {10, 23, 39, 71}, {12, 25, 41, 73}, {14, 27, 43, 75},
+	{16, 29, 45, 77}, {18, 31, 47, 79}, {20, 33, 49, 81}, {22, 35, 51, 83},
+	{24, 37, 53, 85}, {26, 39, 55, 87}, {28, 41, 57, 89}, {30, 43, 59, 91},
+	{32, 45, 61, 93}, {34, 47, 63, 95}, {36, 49, 65, 97}, {38, 51, 67, 99},
+	{40, 53, 69, 101}, {42, 55, 71, 103}, {44, 57, 73, 105}, {46, 59, 75, 107},
+	{48, 61, 77, 109}, {50, 63, 79, 111}, {52, 65, 81, 113}, {54, 67, 83, 115},
+	{56, 69, 85, 117}, {58, 71, 87, 119}, {60, 73, 89, 121}, {62, 75, 91, 123},
+	{64, 77, 93, 125}, {66, 79, 95, 127}, {68, 81, 97, 129}, {70, 83, 99, 131},
+	{72, 85, 101, 133}, {74, 87, 103, 135}, {76, 89, 105, 137}, {78, 91, 107, 139},
+	{80, 93, 109, 141}, {82, 95, 111, 143}, {84, 97, 113, 145}, {86, 99, 115, 147},
+	{88, 101, 117, 149}, {90, 103, 119, 151}, {92, 105, 121, 153}, {94, 107, 123, 155},
+	{96, 109, 125, 157}, {98, 111, 127, 159}, {100, 113, 129, 161}, {102, 115, 131, 163},
+	{104, 117, 133, 165}, {106, 119, 135, 167}, {108, 121, 137, 169}, {110, 123, 139, 171},
+	{112, 125, 141, 173}, {114, 127, 143, 175}, {116, 129, 145, 177}, {118, 131, 147, 179},
+	{120, 133, 149, 181}, {122, 135, 151, 183}, {124, 137, 153, 185}, {126, 139, 155, 187},
+},
+{
+	{0, 18, 37, 77}, {2, 20, 39, 79}, {4, 22, 41, 81}, {6, 24, 43, 83},
+	{8, 26, 45, 85}, {10, 28, 47, 87}, {12, 30, 49, 89}, {14, 32, 51, 91},
+	{16, 34, 53, 93}, {18, 36, 55, 95}, {20, 38, 57, 97}, {22, 40, 59, 99},
+	{24, 42, 61, 101}, {26, 44, 63, 103}, {28, 46, 65, 105}, {30, 48, 67, 107},
+	{32, 50, 69, 109}, {34, 52, 71, 111}, {36, 54, 73, 113}, {38, 56, 75, 115},
+	{40, 58, 77, 117}, {42, 60, 79, 119}, {44, 62, 81, 121}, {46, 64, 83, 123},
+	{48, 66, 85, 125}, {50, 68, 87, 127}, {52, 70, 89, 129}, {54, 72, 91, 131},
+	{56, 74, 93, 133}, {58, 76, 95, 135}, {60, 78, 97, 137}, {62, 80, 99, 139},
+	{64, 82, 101, 141}, {66, 84, 103, 143}, {68, 86, 105, 145}, {70, 88, 107, 147},
+	{72, 90, 109, 149}, {74, 92, 111, 151}, {76, 94, 113, 153}, {78, 96, 115, 155},
+	{80, 98, 117, 157}, {82, 100, 119, 159}, {84, 102, 121, 161}, {86, 104, 123, 163},
+	{88, 106, 125, 165}, {90, 108, 127, 167}, {92, 110, 129, 169}, {94, 112, 131, 171},
+	{96, 114, 133, 173}, {98, 116, 135, 175}, {100, 118, 137, 177}, {102, 120, 139, 179},
+	{104, 122, 141, 181}, {106, 124, 143, 183}, {108, 126, 145, 185}, {110, 128, 147, 187},
+	{112, 130, 149, 189}, {114, 132, 151, 191}, {116, 134, 153, 193}, {118, 136, 155, 195},
+	{120, 138, 157, 197}, {122, 140, 159, 199}, {124, 142, 161, 201}, {126, 144, 163, 203},
+},
+{
+	{0, 21, 45, 93}, {2, 23, 47, 95}, {4, 25, 49, 97}, {6, 27, 51, 99},
+	{8, 29, 53, 101}, {10, 31, 55, 103}, {12, 33, 57, 105}, {14, 35, 59, 107},
+	{16, 37, 61, 109}, {18, 39, 63, 111}, {20, 41, 65, 113}, {22, 43, 67, 115},
+	{24, 45, 69, 117}, {26, 47, 71, 119}, {28, 49, 73, 121}, {30, 51, 75, 123},
+	{32, 53, 77, 125}, {34, 55, 79, 127}, {36, 57, 81, 129}, {38, 59, 83, 131},
+	{40, 61, 85, 133}, {42, 63, 87, 135}, {44, 65, 89, 137}, {46, 67, 91, 139},
+	{48, 69, 93, 141}, {50, 71, 95, 143}, {52, 73, 97, 145}, {54, 75, 99, 147},
+	{56, 77, 101, 149}, {58, 79, 103, 151}, {60, 81, 105, 153}, {62, 83, 107, 155},
+	{64, 85, 109, 157}, {66, 87, 111, 159}, {68, 89, 113, 161}, {70, 91, 115, 163},
+	{72, 93, 117, 165}, {74, 95, 119, 167}, {76, 97, 121, 169}, {78, 99, 123, 171},
+	{80, 101, 125, 173}, {82, 103, 127, 175}, {84, 105, 129, 177}, {86, 107, 131, 179},
+	{88, 109, 133, 181}, {90, 111, 135, 183}, {92, 113, 137, 185}, {94, 115, 139, 187},
+	{96, 117, 141, 189}, {98, 119, 143, 191}, {100, 121, 145, 193}, {102, 123, 147, 195},
+	{104, 125, 149, 197}, {106, 127, 151, 199}, {108, 129, 153, 201}, {110, 131, 155, 203},
+	{112, 133, 157, 205}, {114, 135, 159, 207}, {116, 137, 161, 209}, {118, 139, 163, 211},
+	{120, 141, 165, 213}, {122, 143, 167, 215}, {124, 145, 169, 217}, {126, 147, 171, 219},
+},
+{
+	{0, 26, 53, 109}, {2, 28, 55, 111}, {4, 30, 57, 113}, {6, 32, 59, 115},
+	{8, 34, 61, 117}, {10, 36, 63, 119}, {12, 38, 65, 121}, {14, 40, 67, 123},
+	{16, 42, 69, 125}, {18, 44, 71, 127}, {20, 46, 73, 129}, {22, 48, 75, 131},
+	{24, 50, 77, 133}, {26, 52, 79, 135}, {28, 54, 81, 137}, {30, 56, 83, 139},
+	{32, 58, 85, 141}, {34, 60, 87, 143}, {36, 62, 89, 145}, {38, 64, 91, 147},
+	{40, 66, 93, 149}, {42, 68, 95, 151}, {44, 70, 97, 153}, {46, 72, 99, 155},
+	{48, 74, 101, 157}, {50, 76, 103, 159}, {52, 78, 105, 161}, {54, 80, 107, 163},
+	{56, 82, 109, 165}, {58, 84, 111, 167}, {60, 86, 113, 169}, {62, 88, 115, 171},
+	{64, 90, 117, 173}, {66, 92, 119, 175}, {68, 94, 121, 177}, {70, 96, 123, 179},
+	{72, 98, 125, 181}, {74, 100, 127, 183}, {76, 102, 129, 185}, {78, 104, 131, 187},
+	{80, 106, 133, 189}, {82, 108, 135, 191}, {84, 110, 137, 193}, {86, 112, 139, 195},
+	{88, 114, 141, 197}, {90, 116, 143, 199}, {92, 118, 145, 201}, {94, 120, 147, 203},
+	{96, 122, 149, 205}, {98, 124, 151, 207}, {100, 126, 153, 209}, {102, 128, 155, 211},
+	{104, 130, 157, 213}, {106, 132, 159, 215}, {108, 134, 161, 217}, {110, 136, 163, 219},
+	{112, 138, 165, 221}, {114, 140, 167, 223}, {116, 142, 169, 225}, {118, 144, 171, 227},
+	{120, 146, 173, 229}, {122, 148, 175, 231}, {124, 150, 177, 233}, {126, 152, 179, 235},
+},
+},
+{
+{
+	{0, 0, 0, 0}, {2, 2, 2, 2}, {4, 4, 4, 4}, {6, 6, 6, 6},
+	{8, 8, 8, 8}, {10, 10, 10, 10}, {12, 12, 12, 12}, {14, 14, 14, 14},
+	{16, 16, 16, 16}, {18, 18, 18, 18}, {20, 20, 20, 20}, {22, 22, 22, 22},
+	{24, 24, 24, 24}, {26, 26, 26, 26}, {28, 28, 28, 28}, {30, 30, 30, 30},
+	{32, 32, 32, 32}, {34, 34, 34, 34}, {36, 36, 36, 36}, {38, 38, 38, 38},
+	{40, 40, 40, 40}, {42, 42, 42, 42}, {44, 44, 44, 44}, {46, 46, 46, 46},
+	{48, 48, 48, 48}, {50, 50, 50, 50}, {52, 52, 52, 52}, {54, 54, 54, 54},
+	{56, 56, 56, 56}, {58, 58, 58, 58}, {60, 60, 60, 60}, {62, 62, 62, 62},
+	{64, 64, 64, 64}, {66, 66, 66, 66}, {68, 68, 68, 68}, {70, 70, 70, 70},
+	{72, 72, 72, 72}, {74, 74, 74, 74}, {76, 76, 76, 76}, {78, 78, 78, 78},
+	{80, 80, 80, 80}, {82, 82, 82, 82}, {84, 84, 84, 84}, {86, 86, 86, 86},
+	{88, 88, 88, 88}, {90, 90, 90, 90}, {92, 92, 92, 92}, {94, 94, 94, 94},
+	{96, 96, 96, 96}, {98, 98, 98, 98}, {100, 100, 100, 100}, {102, 102, 102, 102},
+	{104, 104, 104, 104}, {106, 106, 106, 106}, {108, 108, 108, 108}, {110, 110, 110, 110},
+	{112, 112, 112, 112}, {114, 114, 114, 114}, {116, 116, 116, 116}, {118, 118, 118, 118},
+	{120, 120, 120, 120}, {122, 122, 122, 122}, {124, 124, 124, 124}, {126, 126, 126, 126},
+},
+{
+	{0, 2, 8, 16}, {2, 4, 10, 18}, {4, 6, 12, 20}, {6, 8, 14, 22},
+	{8, 10, 16, 24}, {10, 12, 18, 26}, {12, 14, 20, 28}, {14, 16, 22, 30},
+	{16, 18, 24, 32}, {18, 20, 26, 34}, {20, 22, 28, 36}, {22, 24, 30, 38},
+	{24, 26, 32, 40}, {26, 28, 34, 42}, {28, 30, 36, 44}, {30, 32, 38, 46},
+	{32, 34, 40, 48}, {34, 36, 42, 50}, {36, 38, 44, 52}, {38, 40, 46, 54},
+	{40, 42, 48, 56}, {42, 44, 50, 58}, {44, 46, 52, 60}, {46, 48, 54, 62},
+	{48, 50, 56, 64}, {50, 52, 58, 66}, {52, 54, 60, 68}, {54, 56, 62, 70},
+	{56, 58, 64, 72}, {58, 60, 66, 74}, {60, 62, 68, 76}, {62, 64, 70, 78},
+	{64, 66, 72, 80}, {66, 68, 74, 82}, {68, 70, 76, 84}, {70, 72, 78, 86},
+	{72, 74, 80, 88}, {74, 76, 82, 90}, {76, 78, 84, 92}, {78, 80, 86, 94},
+	{80, 82, 88, 96}, {82, 84, 90, 98}, {84, 86, 92, 100}, {86, 88, 94, 102},
+	{88, 90, 96, 104}, {90, 92, 98, 106}, {92, 94, 100, 108}, {94, 96, 102, 110},
+	{96, 98, 104, 112}, {98, 100, 106, 114}, {100, 102, 108, 116}, {102, 104, 110, 118},
+	{104, 106, 112, 120}, {106, 108, 114, 122}, {108, 110, 116, 124}, {110, 112, 118, 126},
+	{112, 114, 120, 128}, {114, 116, 122, 130}, {116, 118, 124, 132}, {118, 120, 126, 134},
+	{120, 122, 128, 136}, {122, 124, 130, 138}, {124, 126, 132, 140}, {126, 128, 134, 142},
+},
+{
+	{0, 8, 16, 32}, {2, 10, 18, 34}, {4, 12, 20, 36}, {6, 14, 22, 38},
+	{8, 16, 24, 40}, {10, 18, 26, 42}, {12, 20, 28, 44}, {14, 22, 30, 46},
+	{16, 24, 32, 48}, {18, 26, 34, 50}, {20, 28, 36, 52}, {22, 30, 38, 54},
+	{24, 32, 40, 56}, {26, 34, 42, 58}, {28, 36, 44, 60}, {30, 38, 46, 62},
+	{32, 40, 48, 64}, {34, 42, 50, 66}, {36, 44, 52, 68}, {38, 46, 54, 70},
+	{40, 48, 56, 72}, {42, 50, 58, 74}, {44, 52, 60, 76}, {46, 54, 62, 78},
+	{48, 56, 64, 80}, {50, 58, 66, 82}, {52, 60, 68, 84}, {54, 62, 70, 86},
+	{56, 64, 72, 88}, {58, 66, 74, 90}, {60, 68, 76, 92}, {62, 70, 78, 94},
+	{64, 72, 80, 96}, {66, 74, 82, 98}, {68, 76, 84, 100}, {70, 78, 86, 102},
+	{72, 80, 88, 104}, {74, 82, 90, 106}, {76, 84, 92, 108}, {78, 86, 94, 110},
+	{80, 88, 96, 112}, {82, 90, 98, 114}, {84, 92, 100, 116}, {86, 94, 102, 118},
+	{88, 96, 104, 120}, {90, 98, 106, 122}, {92, 100, 108, 124}, {94, 102, 110, 126},
+	{96, 104, 112, 128}, {98, 106, 114, 130}, {100, 108, 116, 132}, {102, 110, 118, 134},
+	{104, 112, 120, 136}, {106, 114, 122, 138}, {108, 116, 124, 140}, {110, 118, 126, 142},
+	{112, 120, 128, 144}, {114, 122, 130, 146}, {116, 124, 132, 148}, {118, 126, 134, 150},
+	{120, 128, 136, 152}, {122, 130, 138, 154}, {124, 132, 140, 156}, {126, 134, 142, 158},
+},
+{
+	{0, 10, 24, 48}, {2, 12, 26, 50}, {4, 14, 28, 52}, {6, 16, 30, 54},
+	{8, 18, 32, 56}, {10, 20, 34, 58}, {12, 22, 36, 60}, {14, 24, 38, 62},
+	{16, 26, 40, 64}, {18, 28, 42, 66}, {20, 30, 44, 68}, {22, 32, 46, 70},
+	{24, 34, 48, 72}, {26, 36, 50, 74}, {28, 38, 52, 76}, {30, 40, 54, 78},
+	{32, 42, 56, 80}, {34, 44, 58, 82}, {36, 46, 60, 84}, {38, 48, 62, 86},
+	{40, 50, 64, 88}, {42, 52, 66, 90}, {44, 54, 68, 92}, {46, 56, 70, 94},
+	{48, 58, 72, 96}, {50, 60, 74, 98}, {52, 62, 76, 100}, {54, 64, 78, 102},
+	{56, 66, 80, 104}, {58, 68, 82, 106}, {60, 70, 84, 108}, {62, 72, 86, 110},
+	{64, 74, 88, 112}, {66, 76, 90, 114}, {68, 78, 92, 116}, {70, 80, 94, 118},
+	{72, 82, 96, 120}, {74, 84, 98, 122}, {76, 86, 100, 124}, {78, 88, 102, 126},
+	{80, 90, 104, 128}, {82, 92, 106, 130}, {84, 94, 108, 132}, {86, 96, 110, 134},
+	{88, 98, 112, 136}, {90, 100, 114, 138}, {92, 102, 116, 140}, {94, 104, 118, 142},
+	{96, 106, 120, 144}, {98, 108, 122, 146}, {100, 110, 124, 148}, {102, 112, 126, 150},
+	{104, 114, 128, 152}, {106, 116, 130, 154}, {108, 118, 132, 156}, {110, 120, 134, 158},
+	{112, 122, 136, 160}, {114, 124, 138, 162}, {116, 126, 140, 164}, {118, 128, 142, 166},
+	{120, 130, 144, 168}, {122, 132, 146, 170}, {124, 134, 148, 172}, {126, 136, 150, 174},
+},
+{
+	{0, 16, 32, 64}, {2, 18, 34, 66}, {4, 20, 36, 68}, {6, 22, 38, 70},
+	{8, 24, 40, 72}, {10, 26, 42, 74}, {12, 28, 44, 76}, {14, 30, 46, 78},
+	{16, 32, 48, 80}, {18, 34, 50, 82}, {20, 36, 52, 84}, {22, 38, 54, 86},
+	{24, 40, 56, 88}, {26, 42, 58, 90}, {28, 44, 60, 92}, {30, 46, 62, 94},
+	{32, 48, 64, 96}, {34, 50, 66, 98}, {36, 52, 68, 100}, {38, 54, 70, 102},
+	{40, 56, 72, 104}, {42, 58, 74, 106}, {44, 60, 76, 108}, {46, 62, 78, 110},
+	{48, 64, 80, 112}, {50, 66, 82, 114}, {52, 68, 84, 116}, {54, 70, 86, 118},
+	{56, 72, 88, 120}, {58, 74, 90, 122}, {60, 76, 92, 124}, {62, 78, 94, 126},
+	{64, 80, 96, 128}, {66, 82, 98, 130}, {68, 84, 100, 132}, {70, 86, 102, 134},
+	{72, 88, 104, 136}, {74, 90, 106, 138}, {76, 92, 108, 140}, {78, 94, 110, 142},
+	{80, 96, 112, 144}, {82, 98, 114, 146}, {84, 100, 116, 148}, {86, 102, 118, 150},
+	{88, 104, 120, 152}, {90, 106, 122, 154}, {92, 108, 124, 156}, {94, 110, 126, 158},
+	{96, 112, 128, 160}, {98, 114, 130, 162}, {100, 116, 132, 164}, {102, 118, 134, 166},
+	{104, 120, 136, 168}, {106, 122, 138, 170}, {108, 124, 140, 172}, {110, 126, 142, 174},
+	{112, 128, 144, 176}, {114, 130, 146, 178}, {116, 132, 148, 180}, {118, 134, 150, 182},
+	{120, 136, 152, 184}, {122, 138, 154, 186}, {124, 140, 156, 188}, {126, 142, 158, 190},
+},
+{
+	{0, 18, 40, 80}, {2, 20, 42, 82}, {4, 22, 44, 84}, {6, 24, 46, 86},
+	{8, 26, 48, 88}, {10, 28, 50, 90}, {12, 30, 52, 92}, {14, 32, 54, 94},
+	{16, 34, 56, 96}, {18, 36, 58, 98}, {20, 38, 60, 100}, {22, 40, 62, 102},
+	{24, 42, 64, 104}, {26, 44, 66, 106}, {28, 46, 68, 108}, {30, 48, 70, 110},
+	{32, 50, 72, 112}, {34, 52, 74, 114}, {36, 54, 76, 116}, {38, 56, 78, 118},
+	{40, 58, 80, 120}, {42, 60, 82, 122}, {44, 62, 84, 124}, {46, 64, 86, 126},
+	{48, 66, 88, 128}, {50, 68, 90, 130}, {52, 70, 92, 132}, {54, 72, 94, 134},
+	{56, 74, 96, 136}, {58, 76, 98, 138}, {60, 78, 100, 140}, {62, 80, 102, 142},
+	{64, 82, 104, 144}, {66, 84, 106, 146}, {68, 86, 108, 148}, {70, 88, 110, 150},
+	{72, 90, 112, 152}, {74, 92, 114, 154}, {76, 94, 116, 156}, {78, 96, 118, 158},
+	{80, 98, 120, 160}, {82, 100, 122, 162}, {84, 102, 124, 164}, {86, 104, 126, 166},
+	{88, 106, 128, 168}, {90, 108, 130, 170}, {92, 110, 132, 172}, {94, 112, 134, 174},
+	{96, 114, 136, 176}, {98, 116, 138, 178}, {100, 118, 140, 180}, {102, 120, 142, 182},
+	{104, 122, 144, 184}, {106, 124, 146, 186}, {108, 126, 148, 188}, {110, 128, 150, 190},
+	{112, 130, 152, 192}, {114, 132, 154, 194}, {116, 134, 156, 196}, {118, 136, 158, 198},
+	{120, 138, 160, 200}, {122, 140, 162, 202}, {124, 142, 164, 204}, {126, 144, 166, 206},
+},
+{
+	{0, 24, 48, 96}, {2, 26, 50, 98}, {4, 28, 52, 100}, {6, 30, 54, 102},
+	{8, 32, 56, 104}, {10, 34, 58, 106}, {12, 36, 60, 108}, {14, 38, 62, 110},
+	{16, 40, 64, 112}, {18, 42, 66, 114}, {20, 44, 68, 116}, {22, 46, 70, 118},
+	{24, 48, 72, 120}, {26, 50, 74, 122}, {28, 52, 76, 124}, {30, 54, 78, 126},
+	{32, 56, 80, 128}, {34, 58, 82, 130}, {36, 60, 84, 132}, {38, 62, 86, 134},
+	{40, 64, 88, 136}, {42, 66, 90, 138}, {44, 68, 92, 140}, {46, 70, 94, 142},
+	{48, 72, 96, 144}, {50, 74, 98, 146}, {52, 76, 100, 148}, {54, 78, 102, 150},
+	{56, 80, 104, 152}, {58, 82, 106, 154}, {60, 84, 108, 156}, {62, 86, 110, 158},
+	{64, 88, 112, 160}, {66, 90, 114, 162}, {68, 92, 116, 164}, {70, 94, 118, 166},
+	{72, 96, 120, 168}, {74, 98, 122, 170}, {76, 100, 124, 172}, {78, 102, 126, 174},
+	{80, 104, 128, 176}, {82, 106, 130, 178}, {84, 108, 132, 180}, {86, 110, 134, 182},
+	{88, 112, 136, 184}, {90, 114, 138, 186}, {92, 116, 140, 188}, {94, 118, 142, 190},
+	{96, 120, 144, 192}, {98, 122, 146, 194}, {100, 124, 148, 196}, {102, 126, 150, 198},
+	{104, 128, 152, 200}, {106, 130, 154, 202}, {108, 132, 156, 204}, {110, 134, 158, 206},
+	{112, 136, 160, 208}, {114, 138, 162, 210}, {116, 140, 164, 212}, {118, 142, 166, 214},
+	{120, 144, 168, 216}, {122, 146, 170, 218}, {124, 148, 172, 220}, {126, 150, 174, 222},
+},
+{
+	{0, 26, 56, 112}, {2, 28, 58, 114}, {4, 30, 60, 116}, {6, 32, 62, 118},
+	{8, 34, 64, 120}, {10, 36, 66, 122}, {12, 38, 68, 124}, {14, 40, 70, 126},
+	{16, 42, 72, 128}, {18, 44, 74, 130}, {20, 46, 76, 132}, {22, 48, 78, 134},
+	{24, 50, 80, 136}, {26, 52, 82, 138}, {28, 54, 84, 140}, {30, 56, 86, 142},
+	{32, 58, 88, 144}, {34, 60, 90, 146}, {36, 62, 92, 148}, {38, 64, 94, 150},
+	{40, 66, 96, 152}, {42, 68, 98, 154}, {44, 70, 100, 156}, {46, 72, 102, 158},
+	{48, 74, 104, 160}, {50, 76, 106, 162}, {52, 78, 108, 164}, {54, 80, 110, 166},
+	{56, 82, 112, 168}, {58, 84, 114, 170}, {60, 86, 116, 172}, {62, 88, 118, 174},
+	{64, 90, 120, 176}, {66, 92, 122, 178}, {68, 94, 124, 180}, {70, 96, 126, 182},
+	{72, 98, 128, 184}, {74, 100, 130, 186}, {76, 102, 132, 188}, {78, 104, 134, 190},
+	{80, 106, 136, 192}, {82, 108, 138, 194}, {84, 110, 140, 196}, {86, 112, 142, 198},
+	{88, 114, 144, 200}, {90, 116, 146, 202}, {92, 118, 148, 204}, {94, 120, 150, 206},
+	{96, 122, 152, 208}, {98, 124, 154, 210}, {100, 126, 156, 212}, {102, 128, 158, 214},
+	{104, 130, 160, 216}, {106, 132, 162, 218}, {108, 134, 164, 220}, {110, 136, 166, 222},
+	{112, 138, 168, 224}, {114, 140, 170, 226}, {116, 142, 172, 228}, {118, 144, 174, 230},
+	{120, 146, 176, 232}, {122, 148, 178, 234}, {124, 150, 180, 236}, {126, 152, 182, 238},
+},
+},
+};
+
+static const int32_t rksTable[2][8][2] = {
+{
+	{0, 0}, {0, 2}, {1, 4}, {1, 6},
+	{2, 8}, {2, 10}, {3, 12}, {3, 14},
+},
+{
+	{0, 1}, {0, 3}, {1, 5}, {1, 7},
+	{2, 9}, {2, 11}, {3, 13}, {3, 15},
+},
+};
@@ -0,0 +1,405 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include "emu.h"
+#include "audio.h"
+#include "exp_audio.h"
+
+#define EXP_AUDIO_OVERCLOCKING 0x80
+
+struct exp_audio_write {
+	uint32_t cycles;
+	uint16_t addr;
+	uint8_t value;
+	uint8_t flags;
+};
+
+/* One chip's deltas for a frame, kept apart from the others' so they
+   can be added to blip as one batch */
+struct exp_audio_deltas {
+	uint32_t *times;
+	int *deltas;
+	int count;
+	int size;
+};
+
+struct exp_audio_stem {
+	uint32_t cycles;
+	int stem;
+	int amplitude;
+};
+
+/* One frame's worth of work.  The CPU thread appends writes to the
+   current job; once submitted, the job belongs to the worker until
+   exp_audio_wait() returns.
+*/
+struct exp_audio_job {
+	struct exp_audio *exp;
+	struct exp_audio_write *writes;
+	int write_count;
+	int write_size;
+	struct exp_audio_deltas deltas[AUDIO_CHIP_COUNT];
+	struct exp_audio_stem *stems;
+	int stem_count;
+	int stem_size;
+	uint32_t cycles;
+	int overclocking;
+};
+
+struct exp_audio_chip {
+	void *chip;
+	const struct exp_audio_chip_ops *ops;
+};
+
+struct exp_audio {
+	struct emu *emu;
+	struct exp_audio_chip chips[EXP_AUDIO_CHIP_COUNT];
+	struct exp_audio_job jobs[2];
+	int current;
+	int busy;
+
+	/* Only touched while chip code is running, which is either
+	   the worker or the CPU thread after exp_audio_sync(), never
+	   both at once. */
+	struct exp_audio_job *delta_job;
+	int replaying;
+	int replay_overclocking;
+
+	/* Last level queued for each stem, so that unchanged levels
+	   aren't queued at all */
+	int stem_levels[AUDIO_STEM_COUNT];
+};
+
+static void exp_audio_wait(struct exp_audio *exp)
+{
+	if (exp->busy) {
+		audio_worker_wait();
+		exp->busy = 0;
+	}
+}
+
+static void replay_writes(struct exp_audio *exp, struct exp_audio_job *job)
+{
+	int i;
+
+	exp->replaying = 1;
+	for (i = 0; i < job->write_count; i++) {
+		struct exp_audio_write *write;
+		struct exp_audio_chip *chip;
+
+		write = &job->writes[i];
+		chip = &exp->chips[write->flags & ~EXP_AUDIO_OVERCLOCKING];
+		if (!chip->chip)
+			continue;
+
+		exp->replay_overclocking =
+			!!(write->flags & EXP_AUDIO_OVERCLOCKING);
+		chip->ops->write(chip->chip, write->addr, write->value,
+				 write->cycles);
+	}
+	exp->replaying = 0;
+	job->write_count = 0;
+}
+
+static void exp_audio_worker(void *data)
+{
+	struct exp_audio_job *job;
+	struct exp_audio *exp;
+	int i;
+
+	job = data;
+	exp = job->exp;
+
+	exp->delta_job = job;
+	replay_writes(exp, job);
+
+	exp->replaying = 1;
+	exp->replay_overclocking = job->overclocking;
+	for (i = 0; i < EXP_AUDIO_CHIP_COUNT; i++) {
+		struct exp_audio_chip *chip = &exp->chips[i];
+
+		if (!chip->chip)
+			continue;
+
+		chip->ops->run(chip->chip, job->cycles);
+		chip->ops->end_frame(chip->chip, job->cycles);
+	}
+	exp->replaying = 0;
+	exp->delta_job = NULL;
+}
+
+static void commit_deltas(struct exp_audio *exp, struct exp_audio_job *job)
+{
+	int i;
+
+	for (i = 0; i < AUDIO_CHIP_COUNT; i++) {
+		struct exp_audio_deltas *list = &job->deltas[i];
+
+		if (!list->count)
+			continue;
+
+		audio_add_delayed_deltas(exp->emu->audio, i, list->times,
+					 list->deltas, list->count);
+		list->count = 0;
+	}
+
+	for (i = 0; i < job->stem_count; i++) {
+		audio_set_delayed_stem(exp->emu->audio, job->stems[i].stem,
+				       job->stems[i].cycles,
+				       job->stems[i].amplitude);
+	}
+
+	job->stem_count = 0;
+}
+
+static void exp_audio_free(struct exp_audio *exp)
+{
+	int i, j;
+
+	for (i = 0; i < 2; i++) {
+		free(exp->jobs[i].writes);
+		for (j = 0; j < AUDIO_CHIP_COUNT; j++) {
+			free(exp->jobs[i].deltas[j].times);
+			free(exp->jobs[i].deltas[j].deltas);
+		}
+		free(exp->jobs[i].stems);
+	}
+
+	free(exp);
+}
+
+int exp_audio_register(struct emu *emu, enum exp_audio_chip_id id,
+		       void *chip, const struct exp_audio_chip_ops *ops)
+{
+	struct exp_audio *exp;
+	int i;
+
+	if (!emu->config->expansion_audio_thread)
+		return 0;
+
+	exp = emu->exp_audio;
+	if (!exp) {
+		exp = malloc(sizeof(*exp));
+		if (!exp)
+			return -1;
+
+		memset(exp, 0, sizeof(*exp));
+		exp->emu = emu;
+		for (i = 0; i < 2; i++)
+			exp->jobs[i].exp = exp;
+
+		emu->exp_audio = exp;
+		audio_set_frame_delay(emu->audio, 1);
+	}
+
+	exp->chips[id].chip = chip;
+	exp->chips[id].ops = ops;
+
+	return 0;
+}
+
+void exp_audio_unregister(struct emu *emu, enum exp_audio_chip_id id)
+{
+	struct exp_audio *exp;
+	int i;
+
+	exp = emu->exp_audio;
+	if (!exp)
+		return;
+
+	exp_audio_sync(emu);
+	exp->chips[id].chip = NULL;
+	exp->chips[id].ops = NULL;
+
+	for (i = 0; i < EXP_AUDIO_CHIP_COUNT; i++) {
+		if (exp->chips[i].chip)
+			return;
+	}
+
+	/* Last chip is gone; nothing left to defer */
+	commit_deltas(exp, &exp->jobs[exp->current ^ 1]);
+	audio_worker_stop();
+	audio_set_frame_delay(emu->audio, 0);
+	exp_audio_free(exp);
+	emu->exp_audio = NULL;
+}
+
+int exp_audio_deferred(struct emu *emu, enum exp_audio_chip_id id)
+{
+	return emu->exp_audio && emu->exp_audio->chips[id].chip;
+}
+
+void exp_audio_log_write(struct emu *emu, enum exp_audio_chip_id id,
+			 int addr, int value, uint32_t cycles)
+{
+	struct exp_audio_job *job;
+	struct exp_audio_write *write;
+
+	job = &emu->exp_audio->jobs[emu->exp_audio->current];
+
+	if (job->write_count == job->write_size) {
+		struct exp_audio_write *tmp;
+		int size;
+
+		size = job->write_size ? job->write_size * 2 : 256;
+		tmp = realloc(job->writes, size * sizeof(*tmp));
+		if (!tmp) {
+			/* Fall back to applying it now */
+			exp_audio_sync(emu);
+			emu->exp_audio->chips[id].ops->write(
+				emu->exp_audio->chips[id].chip,
+				addr, value, cycles);
+			return;
+		}
+
+		job->writes = tmp;
+		job->write_size = size;
+	}
+
+	write = &job->writes[job->write_count++];
+	write->cycles = cycles;
+	write->addr = addr;
+	write->value = value;
+	write->flags = id;
+	if (emu->overclocking)
+		write->flags |= EXP_AUDIO_OVERCLOCKING;
+}
+
+void exp_audio_add_delta(struct emu *emu, int chip, uint32_t cycles,
+			 int delta)
+{
+	struct exp_audio_job *job;
+	struct exp_audio_deltas *list;
+
+	job = emu->exp_audio ? emu->exp_audio->delta_job : NULL;
+	if (!job) {
+		audio_add_delta(emu->audio, chip, cycles, delta);
+		return;
+	}
+
+	list = &job->deltas[chip];
+
+	if (list->count == list->size) {
+		uint32_t *times;
+		int *deltas;
+		int size;
+
+		size = list->size ? list->size * 2 : 1024;
+		times = realloc(list->times, size * sizeof(*times));
+		if (!times)
+			return;
+
+		list->times = times;
+
+		deltas = realloc(list->deltas, size * sizeof(*deltas));
+		if (!deltas)
+			return;
+
+		list->deltas = deltas;
+		list->size = size;
+	}
+
+	list->times[list->count] = cycles;
+	list->deltas[list->count] = delta;
+	list->count++;
+}
+
+/* Only called while emu->audio_stems is set */
+void exp_audio_set_stem(struct emu *emu, int stem, uint32_t cycles,
+			int amplitude)
+{
+	struct exp_audio_job *job;
+
+	job = emu->exp_audio ? emu->exp_audio->delta_job : NULL;
+	if (!job) {
+		if (emu->exp_audio)
+			emu->exp_audio->stem_levels[stem] = amplitude;
+		audio_set_stem(emu->audio, stem, cycles, amplitude);
+		return;
+	}
+
+	if (emu->exp_audio->stem_levels[stem] == amplitude)
+		return;
+
+	if (job->stem_count == job->stem_size) {
+		struct exp_audio_stem *tmp;
+		int size;
+
+		size = job->stem_size ? job->stem_size * 2 : 1024;
+		tmp = realloc(job->stems, size * sizeof(*tmp));
+		if (!tmp)
+			return;
+
+		job->stems = tmp;
+		job->stem_size = size;
+	}
+
+	emu->exp_audio->stem_levels[stem] = amplitude;
+	job->stems[job->stem_count].cycles = cycles;
+	job->stems[job->stem_count].stem = stem;
+	job->stems[job->stem_count].amplitude = amplitude;
+	job->stem_count++;
+}
+
+int exp_audio_overclocking(struct emu *emu)
+{
+	if (emu->exp_audio && emu->exp_audio->replaying)
+		return emu->exp_audio->replay_overclocking;
+
+	return emu->overclocking;
+}
+
+void exp_audio_sync(struct emu *emu)
+{
+	struct exp_audio *exp;
+
+	exp = emu->exp_audio;
+	if (!exp)
+		return;
+
+	exp_audio_wait(exp);
+
+	/* The chips are ours again; bring them up to date with this
+	   frame's writes so far.  Deltas go straight to the audio
+	   buffer. */
+	replay_writes(exp, &exp->jobs[exp->current]);
+}
+
+void exp_audio_end_frame(struct emu *emu, uint32_t cycles)
+{
+	struct exp_audio *exp;
+	struct exp_audio_job *job;
+
+	exp = emu->exp_audio;
+	if (!exp)
+		return;
+
+	/* Last frame's deltas go in before the frontend closes that
+	   frame out. */
+	exp_audio_wait(exp);
+	commit_deltas(exp, &exp->jobs[exp->current ^ 1]);
+
+	job = &exp->jobs[exp->current];
+	job->cycles = cycles;
+	job->overclocking = emu->overclocking;
+	exp->current ^= 1;
+
+	exp->busy = 1;
+	audio_worker_submit(exp_audio_worker, job);
+}
@@ -19,10 +19,19 @@
 
 #include "emu.h"
 #include "audio.h"
+#include "exp_audio.h"
+
+/* Logged in place of fds_audio_enable() calls when deferred */
+#define FDS_AUDIO_ENABLE_ADDR 0x4023
 
 static CPU_WRITE_HANDLER(fds_audio_write_handler);
 static CPU_READ_HANDLER(fds_audio_read_handler);
 
+/* Clear to step the wave and modulator one clock at a time even when
+   they can't be heard, as they used to be.  tests/fds_audio_test.c
+   compares the two. */
+static int fds_audio_skip_inaudible = 1;
+
 struct volume_unit {
 	uint32_t timestamp;
 	int enabled;
@@ -142,27 +151,67 @@ static void wave_run(struct fds_audio_state *audio, uint32_t cycles);
 static void modulator_run(struct fds_audio_state *audio, uint32_t cycles);
 static void update_amplitude(struct fds_audio_state *audio, uint32_t cycles);
 
-void fds_audio_run(struct fds_audio_state *audio, uint32_t cycles)
+static void fds_audio_write(void *chip, int addr, int value, uint32_t cycles);
+static void fds_audio_update(void *chip, uint32_t cycles);
+static void fds_audio_update_end_frame(void *chip, uint32_t cycles);
+
+static const struct exp_audio_chip_ops fds_audio_ops = {
+	.write = fds_audio_write,
+	.run = fds_audio_update,
+	.end_frame = fds_audio_update_end_frame,
+};
+
+static void fds_audio_update(void *chip, uint32_t cycles)
 {
-	if (audio->emu->overclocking)
+	struct fds_audio_state *audio = chip;
+
+	if (exp_audio_overclocking(audio->emu))
 		return;
 
 	modulator_run(audio, cycles);
 }
 
+void fds_audio_run(struct fds_audio_state *audio, uint32_t cycles)
+{
+	if (exp_audio_deferred(audio->emu, EXP_AUDIO_FDS))
+		return;
+
+	fds_audio_update(audio, cycles);
+}
+
 void fds_audio_enable(struct fds_audio_state *audio, uint32_t cycles,
 		      int enabled)
 {
-	fds_audio_run(audio, cycles);
+	if (exp_audio_deferred(audio->emu, EXP_AUDIO_FDS)) {
+		exp_audio_log_write(audio->emu, EXP_AUDIO_FDS,
+				    FDS_AUDIO_ENABLE_ADDR, !!enabled, cycles);
+		return;
+	}
+
+	fds_audio_update(audio, cycles);
 	audio->enabled = enabled;
 }
 
 static CPU_WRITE_HANDLER(fds_audio_write_handler)
 {
-	struct fds_audio_state *audio;
+	if (exp_audio_deferred(emu, EXP_AUDIO_FDS)) {
+		exp_audio_log_write(emu, EXP_AUDIO_FDS, addr, value, cycles);
+		return;
+	}
 
-	audio = emu->fds_audio;
-	fds_audio_run(audio, cycles);
+	fds_audio_write(emu->fds_audio, addr, value, cycles);
+}
+
+static void fds_audio_write(void *chip, int addr, int value, uint32_t cycles)
+{
+	struct fds_audio_state *audio = chip;
+
+	fds_audio_update(audio, cycles);
+
+	if (addr == FDS_AUDIO_ENABLE_ADDR) {
+		audio->enabled = value;
+		return;
+	}
 
 	if (!audio->enabled)
 		return;
@@ -278,8 +327,12 @@ static CPU_READ_HANDLER(fds_audio_read_handler)
 
 	audio = emu->fds_audio;
 
+	/* Gains change as the envelopes run, so catch up even when
+	   rendering is deferred. */
+	exp_audio_sync(emu);
+
 	data = value;
-	fds_audio_run(audio, cycles);
+	fds_audio_update(audio, cycles);
 
 	if (!audio->enabled)
 		return 0;
@@ -313,11 +366,13 @@ int fds_audio_init(struct emu *emu)
 	audio->emu = emu;
 	emu->fds_audio = audio;
 
-	return 0;
+	return exp_audio_register(emu, EXP_AUDIO_FDS, audio, &fds_audio_ops);
 }
 
 void fds_audio_cleanup(struct emu *emu)
 {
+	exp_audio_unregister(emu, EXP_AUDIO_FDS);
+
 	if (emu->fds_audio)
 		free(emu->fds_audio);
 
@@ -348,6 +403,16 @@ void fds_audio_reset(struct fds_audio_state *audio, int hard)
 
 void fds_audio_end_frame(struct fds_audio_state *audio, uint32_t cycles)
 {
+	if (exp_audio_deferred(audio->emu, EXP_AUDIO_FDS))
+		return;
+
+	fds_audio_update_end_frame(audio, cycles);
+}
+
+static void fds_audio_update_end_frame(void *chip, uint32_t cycles)
+{
+	struct fds_audio_state *audio = chip;
+
 	audio->modulator.timestamp -= cycles;
 	audio->wave.timestamp -= cycles;
 	audio->sweep.timestamp -= cycles;
@@ -394,9 +459,6 @@ static void update_amplitude(struct fds_audio_state *audio, uint32_t cycles)
 		else
 			amp *= audio->wave.table[audio->wave.step];
 
-		amp *= audio->emu->config->fds_volume;
-		amp /= 100;
-
 		amp >>= 8;
 	} else {
 		amp = 0;
@@ -404,9 +466,16 @@ static void update_amplitude(struct fds_audio_state *audio, uint32_t cycles)
 
 	delta = amp - audio->volume.last_amplitude;
 	if (delta) {
-		audio_add_delta(audio->emu->audio, cycles, delta);
+		exp_audio_add_delta(audio->emu, AUDIO_CHIP_FDS, cycles, delta);
 		audio->volume.last_amplitude = amp;
 	}
+
+	/* fds_volume is applied to the deltas as the chip's gain, so the
+	   stem has to apply it itself */
+	if (audio->emu->audio_stems) {
+		exp_audio_set_stem(audio->emu, AUDIO_STEM_FDS, cycles,
+				   amp * audio->emu->config->fds_volume / 100);
+	}
 }
 
 static void update_mod(struct fds_audio_state *audio, uint32_t cycles)
@@ -535,6 +604,36 @@ static void volume_run(struct fds_audio_state *audio, uint32_t cycles)
 	}
 }
 
+/* Returns the number of ticks for which the wave position can't affect
+   the output, or 0 if it can.  The output is silent at zero gain and
+   holds last_value while the wave table is writable; either way that
+   lasts until the volume envelope next clocks (or for good, if the
+   envelope can't bring the gain up from zero). */
+static int wave_inaudible_ticks(struct fds_audio_state *audio, int remaining)
+{
+	struct volume_unit *volume;
+
+	volume = &audio->volume;
+
+	if (!fds_audio_skip_inaudible ||
+	    (volume->gain && !audio->wave.writable)) {
+		return 0;
+	}
+
+	if (!audio->envelopes_enabled || !volume->enabled ||
+	    !volume->period) {
+		return remaining;
+	}
+
+	if (!volume->gain && !volume->increase)
+		return remaining;
+
+	if (volume->period - volume->counter < remaining)
+		return volume->period - volume->counter;
+
+	return remaining;
+}
+
 static void wave_run(struct fds_audio_state *audio, uint32_t cycles)
 {
 	struct wave_unit *wave;
@@ -556,6 +655,22 @@ static void wave_run(struct fds_audio_state *audio, uint32_t cycles)
 		int ticks_to_next_clock;
 		int clocks;
 
+		/* Step the wave in bulk while nobody can hear it */
+		clocks = wave_inaudible_ticks(audio, remaining);
+		if (clocks) {
+			uint32_t total;
+
+			total = wave->accumulator + (uint32_t)clocks *
+				wave->pitch;
+			wave->accumulator = total & 0xffff;
+			wave->step = (wave->step + (total >> 16)) & 0x3f;
+			wave->timestamp += clocks *
+				audio->emu->apu_clock_divider;
+			remaining -= clocks;
+			volume_run(audio, wave->timestamp);
+			continue;
+		}
+
 		acc_remaining = 65536 - wave->accumulator;
 		ticks_to_next_clock = acc_remaining / wave->pitch;
 		if (acc_remaining % wave->pitch)
@@ -579,11 +694,33 @@ static void wave_run(struct fds_audio_state *audio, uint32_t cycles)
 	}
 }
 
+/* Applies the next modulation table entry to the sweep bias */
+static void modulator_step(struct fds_audio_state *audio)
+{
+	static const int8_t adjust[] = { 0, 1, 2, 4, 0, -4, -2, -1 };
+	struct modulator_unit *modulator;
+	int tmp;
+
+	modulator = &audio->modulator;
+
+	tmp = modulator->table[modulator->step];
+	modulator->step = (modulator->step + 1) & 0x3f;
+
+	if (tmp == 4)
+		modulator->sweep_bias = 0;
+	else
+		modulator->sweep_bias += adjust[tmp];
+
+	if (modulator->sweep_bias > 63)
+		modulator->sweep_bias -= 128;
+	else if (modulator->sweep_bias < -64)
+		modulator->sweep_bias += 128;
+}
+
 static void modulator_run(struct fds_audio_state *audio, uint32_t cycles)
 {
 	struct modulator_unit *modulator;
 	int remaining;
-	int8_t adjust[] = { 0, 1, 2, 4, 0, -4, -2, -1 };
 
 	modulator = &audio->modulator;
 
@@ -596,6 +733,27 @@ static void modulator_run(struct fds_audio_state *audio, uint32_t cycles)
 	remaining = (cycles - modulator->timestamp) /
 		audio->emu->apu_clock_divider;;
 
+	/* With the wave halted nothing is audible and the envelopes are
+	   stopped, so only the modulator itself needs to advance; the
+	   wave pitch can be brought up to date once at the end. */
+	if (fds_audio_skip_inaudible && !audio->wave.enabled) {
+		uint64_t total;
+		int steps;
+
+		total = modulator->accumulator +
+			(uint64_t)remaining * modulator->pitch;
+		modulator->accumulator = total & 0xffff;
+		modulator->timestamp += remaining *
+			audio->emu->apu_clock_divider;
+
+		for (steps = total >> 16; steps > 0; steps--)
+			modulator_step(audio);
+
+		sweep_run(audio, modulator->timestamp);
+		update_mod(audio, modulator->timestamp);
+		return;
+	}
+
 	while (remaining) {
 		int acc_remaining;
 		int ticks_to_next_clock;
@@ -615,22 +773,8 @@ static void modulator_run(struct fds_audio_state *audio, uint32_t cycles)
 		remaining -= clocks;
 		sweep_run(audio, modulator->timestamp);
 		if (modulator->accumulator >= 65536) {
-			int tmp;
 			modulator->accumulator &= 0xffff;
-
-			tmp = modulator->table[modulator->step];
-			modulator->step = (modulator->step + 1) & 0x3f;
-
-			if (tmp == 4)
-				modulator->sweep_bias = 0;
-			else
-				modulator->sweep_bias += adjust[tmp];
-
-			if (modulator->sweep_bias > 63)
-				modulator->sweep_bias -= 128;
-			else if (modulator->sweep_bias < -64)
-				modulator->sweep_bias += 128;
-
+			modulator_step(audio);
 			update_mod(audio, modulator->timestamp);
 		}
 	}
@@ -102,6 +102,14 @@ static struct state_item mmc5_audio_state_items[] = {
 	STATE_ITEM_END(),
 };
 
+static uint32_t mmc5_pulse_out(uint32_t pulse_tmp)
+{
+	if (!pulse_tmp)
+		return 0;
+
+	return (65536) * 9552 / (100 * 812800 / pulse_tmp + 10000);
+}
+
 static void mmc5_audio_update_amplitude(struct mmc5_audio_state *audio,
 					uint32_t cycles)
 {
@@ -118,10 +126,7 @@ static void mmc5_audio_update_amplitude(struct mmc5_audio_state *audio,
 
 	pcm_tmp = audio->pcm * 64 * config->mmc5_pcm_volume;
 
-	if (pulse_tmp)
-		pulse_out = (65536) * 9552 / (100 * 812800 / pulse_tmp + 10000);
-	else
-		pulse_out = 0;
+	pulse_out = mmc5_pulse_out(pulse_tmp);
 
 	/* PCM audio volume is apparently closer to linear than the 2A03's DMC
 	   channel.
@@ -136,9 +141,24 @@ static void mmc5_audio_update_amplitude(struct mmc5_audio_state *audio,
 
 	delta = -(out - audio->last_amplitude);
 	if (delta) {
-		audio_add_delta(audio->emu->audio, cycles, delta);
+		audio_add_delta(audio->emu->audio, AUDIO_CHIP_MMC5, cycles,
+				delta);
 		audio->last_amplitude = out;
 	}
+
+	/* Inverted like the mix */
+	if (audio->emu->audio_stems) {
+		audio_set_stem(audio->emu->audio, AUDIO_STEM_MMC5_PULSE0,
+			       cycles, -(int)mmc5_pulse_out(
+				       audio->mmc5_pulse[0].amplitude *
+				       config->mmc5_pulse0_volume));
+		audio_set_stem(audio->emu->audio, AUDIO_STEM_MMC5_PULSE1,
+			       cycles, -(int)mmc5_pulse_out(
+				       audio->mmc5_pulse[1].amplitude *
+				       config->mmc5_pulse1_volume));
+		audio_set_stem(audio->emu->audio, AUDIO_STEM_MMC5_PCM,
+			       cycles, -(int)pcm_out);
+	}
 }
 
 static CPU_READ_HANDLER(mmc5_audio_pcm_read_handler)
@@ -19,6 +19,7 @@
 
 #include "emu.h"
 #include "audio.h"
+#include "exp_audio.h"
 
 #define active_channels() (((audio->ram[0x7f] >> 4) & 0x07))
 
@@ -32,6 +33,10 @@
 	                   (audio->ram[(x << 3) | 0x43] << 8) | \
 		           (audio->ram[(x << 3) | 0x45] << 16)) & 0xffffff)
 
+/* Clear to make the mixed output step one channel clock at a time, as
+   it used to.  tests/namco163_audio_test.c compares the two. */
+static int namco163_bulk_stepping = 1;
+
 static const int gain = 6.0 * 9752.0 /	(15.0 * 15.0 * 256.0) * 256.0;
 static const int mixer_adjust[9] = { 256, 256, 128, 256 / 3, 64, 256 / 5,
 				     256 / 6, 256 / 6, 256 / 6 };
@@ -43,6 +48,8 @@ struct namco163_audio_state {
 	int enabled;
 	uint8_t *ram;
 	int last_amp[8];
+	int last_output;
+	int mixed;
 	int next_channel;
 	struct emu *emu;
 };
@@ -55,6 +62,17 @@ static struct state_item namco163_audio_state_items[] = {
 	STATE_8BIT(namco163_audio_state, next_channel),
 };
 
+static void namco163_audio_write(void *chip, int addr, int value,
+				 uint32_t cycles);
+static void namco163_audio_update(void *chip, uint32_t cycles);
+static void namco163_audio_update_end_frame(void *chip, uint32_t cycles);
+
+static const struct exp_audio_chip_ops namco163_audio_ops = {
+	.write = namco163_audio_write,
+	.run = namco163_audio_update,
+	.end_frame = namco163_audio_update_end_frame,
+};
+
 static void set_channel_phase(struct namco163_audio_state *audio, int channel,
 			      int phase)
 {
@@ -96,13 +114,249 @@ static int channel_amp(struct namco163_audio_state *audio, int channel, int phas
 void namco163_audio_run(struct namco163_audio_state *audio,
 		       uint32_t cycles)
 {
+	if (exp_audio_deferred(audio->emu, EXP_AUDIO_NAMCO163))
+		return;
+
+	namco163_audio_update(audio, cycles);
+}
+
+static void set_stem(struct namco163_audio_state *audio, int channel,
+		     uint32_t timestamp, int amp)
+{
+	exp_audio_set_stem(audio->emu, AUDIO_STEM_NAMCO163 + channel,
+			   timestamp, amp);
+}
+
+/* Advances a channel by one of its clocks and returns the new phase */
+static uint32_t step_channel_phase(struct namco163_audio_state *audio,
+				   int channel)
+{
+	uint32_t phase;
+	uint32_t length;
+
+	length = channel_length(channel) << 16;
+	phase = (channel_phase(channel) + channel_frequency(channel)) &
+		0x00ffffff;
+
+	while (phase >= length)
+		phase -= length;
+
+	set_channel_phase(audio, channel, phase);
+
+	return phase;
+}
+
+/* Returns non-zero if any active channel's wave overlaps the active
+   channels' registers, in which case its samples change as the phases
+   are updated. */
+static int waves_overlap_registers(struct namco163_audio_state *audio,
+				   int count)
+{
+	int first_register;
+	int channel;
+
+	/* In 4-bit samples */
+	first_register = (0x40 + (8 - count) * 8) * 2;
+
+	for (channel = 8 - count; channel < 8; channel++) {
+		int start, end;
+
+		start = audio->ram[0x46 | (channel << 3)];
+		end = start + channel_length(channel);
+
+		if (end > first_register || end > 0x100)
+			return 1;
+	}
+
+	return 0;
+}
+
+/* Mixed output, one channel clock at a time */
+static void stepped_mixed_update(struct namco163_audio_state *audio,
+				 int channel, int count, uint32_t clocks,
+				 int multiplier)
+{
+	uint32_t timestamp;
+
+	timestamp = audio->timestamp;
+
+	while (clocks) {
+		uint32_t phase;
+		int amp;
+
+		phase = step_channel_phase(audio, channel);
+		timestamp += multiplier;
+		amp = channel_amp(audio, channel, phase);
+
+		if (amp != audio->last_amp[channel]) {
+			exp_audio_add_delta(audio->emu, AUDIO_CHIP_NAMCO163,
+					    timestamp,
+					    amp - audio->last_amp[channel]);
+			audio->last_amp[channel] = amp;
+			if (audio->emu->audio_stems)
+				set_stem(audio, channel, timestamp, amp);
+		}
+
+		clocks--;
+		channel--;
+		if (channel < 8 - count)
+			channel = 7;
+	}
+}
+
+/* Mixed output: each channel holds its last sample, so the output
+   only changes when a channel's phase crosses into a new wave sample
+   (or its volume or the wave itself changed).  Registers can't change
+   during a run, so each channel is stepped straight from one sample
+   boundary to the next.
+*/
+static void mixed_update(struct namco163_audio_state *audio, int channel,
+			 int count, uint32_t clocks, int multiplier)
+{
+	int i;
+
+	/* Unless the wave is read from the phase registers */
+	if (!namco163_bulk_stepping ||
+	    waves_overlap_registers(audio, count)) {
+		stepped_mixed_update(audio, channel, count, clocks,
+				     multiplier);
+		return;
+	}
+
+	for (i = 0; i < count && i < clocks; i++) {
+		uint32_t updates, update;
+		uint32_t phase, frequency, length;
+		uint32_t timestamp;
+		uint32_t steps;
+		int amp;
+
+		/* This channel is clocked on clocks i + 1, i + 1 + count,
+		   i + 1 + 2 * count, ... of this run. */
+		updates = (clocks - i - 1) / count + 1;
+
+		/* The first clock also wraps a phase left out of range
+		   by a length change. */
+		phase = step_channel_phase(audio, channel);
+		frequency = channel_frequency(channel);
+		length = channel_length(channel) << 16;
+		update = 1;
+
+		while (1) {
+			amp = channel_amp(audio, channel, phase);
+			if (amp != audio->last_amp[channel]) {
+				timestamp = audio->timestamp +
+					(i + 1 + (update - 1) * count) *
+					multiplier;
+				exp_audio_add_delta(audio->emu,
+						    AUDIO_CHIP_NAMCO163,
+						    timestamp,
+						    amp - audio->last_amp[channel]);
+				audio->last_amp[channel] = amp;
+				if (audio->emu->audio_stems)
+					set_stem(audio, channel, timestamp,
+						 amp);
+			}
+
+			if (update == updates || !frequency)
+				break;
+
+			/* Clocks until the next wave sample */
+			steps = ((((phase >> 16) + 1) << 16) - phase +
+				 frequency - 1) / frequency;
+			if (steps > updates - update)
+				steps = updates - update;
+
+			phase = (phase + (uint64_t)steps * frequency) % length;
+			update += steps;
+		}
+
+		set_channel_phase(audio, channel, phase);
+
+		channel--;
+		if (channel < 8 - count)
+			channel = 7;
+	}
+}
+
+/* Multiplexed output: like the real chip, only the channel being
+   clocked is heard, so the output changes whenever consecutive
+   channels differ.  Scaled by the channel count so that it averages
+   out to the same level as the mixed output.
+*/
+static void multiplexed_update(struct namco163_audio_state *audio,
+			       int channel, int count, uint32_t clocks,
+			       int multiplier)
+{
+	uint32_t timestamp;
+
+	timestamp = audio->timestamp;
+
+	while (clocks) {
+		uint32_t phase;
+		int amp;
+
+		phase = step_channel_phase(audio, channel);
+		timestamp += multiplier;
+		amp = channel_amp(audio, channel, phase);
+
+		/* Stems hold each channel's last sample either way */
+		if (audio->emu->audio_stems)
+			set_stem(audio, channel, timestamp, amp);
+
+		amp *= count;
+
+		if (amp != audio->last_output) {
+			exp_audio_add_delta(audio->emu, AUDIO_CHIP_NAMCO163,
+					    timestamp,
+					    amp - audio->last_output);
+			audio->last_output = amp;
+		}
+
+		clocks--;
+		channel--;
+		if (channel < 8 - count)
+			channel = 7;
+	}
+}
+
+/* Switching output modes replaces one output level with the other */
+static void set_output_mode(struct namco163_audio_state *audio, int mixed)
+{
+	int delta;
+	int i;
+
+	mixed = !!mixed;
+	if (mixed == audio->mixed)
+		return;
+
+	delta = 0;
+	if (audio->mixed) {
+		for (i = 0; i < 8; i++) {
+			delta -= audio->last_amp[i];
+			audio->last_amp[i] = 0;
+		}
+	} else {
+		delta -= audio->last_output;
+		audio->last_output = 0;
+	}
+
+	if (delta)
+		exp_audio_add_delta(audio->emu, AUDIO_CHIP_NAMCO163,
+				    audio->timestamp, delta);
+
+	audio->mixed = mixed;
+}
+
+static void namco163_audio_update(void *chip, uint32_t cycles)
+{
+	struct namco163_audio_state *audio = chip;
 	uint32_t clocks_elapsed;
 	int channel;
 	int min_channel;
-	int length;
+	int count;
 	int multiplier;
 
-	if (audio->emu->overclocking)
+	if (exp_audio_overclocking(audio->emu))
 		return;
 
 	if (!audio->enabled) {
@@ -113,56 +367,51 @@ void namco163_audio_run(struct namco163_audio_state *audio,
 	clocks_elapsed = (cycles - audio->timestamp) /
 		(audio->emu->apu_clock_divider * 15);
 
+	if (!clocks_elapsed)
+		return;
+
 	channel = audio->next_channel;
 	min_channel = 7 - active_channels();
 
 	if (channel < min_channel)
 		channel = 7;
 
+	count = 8 - min_channel;
 	multiplier = 15 * audio->emu->apu_clock_divider;
 
-	while (clocks_elapsed) {
-		int old_phase, phase;
-		int frequency;
-		int tmp;
-		int amp, delta;
-
-		old_phase = channel_phase(channel);
-		length = channel_length(channel);
-		frequency = channel_frequency(channel);
-		phase = (old_phase + frequency) & 0x00ffffff;
-		tmp = length << 16;
-
-		while (phase >= tmp)
-			phase -= tmp;
-
-		set_channel_phase(audio, channel, phase);
-		audio->timestamp += multiplier;
-		amp = channel_amp(audio, channel, phase);
-		delta = amp - audio->last_amp[channel];
+	set_output_mode(audio, audio->emu->config->namco163_mixed_output);
 
-		if (delta) {
-			audio_add_delta(audio->emu->audio,
-			                audio->timestamp, delta);
-			audio->last_amp[channel] = amp;
-		}
-
-		clocks_elapsed--;
-		channel--;
-		if (channel < min_channel)
-			channel = 7;
+	if (audio->mixed) {
+		mixed_update(audio, channel, count, clocks_elapsed,
+			     multiplier);
+	} else {
+		multiplexed_update(audio, channel, count, clocks_elapsed,
+				   multiplier);
 	}
 
-	audio->next_channel = channel;
+	/* Channels are clocked from 7 down to min_channel */
+	audio->next_channel = 7 - (7 - channel + clocks_elapsed % count) %
+		count;
+	audio->timestamp += clocks_elapsed * multiplier;
 }
 
 CPU_WRITE_HANDLER(namco163_audio_write_handler)
 {
-	struct namco163_audio_state *audio;
+	if (exp_audio_deferred(emu, EXP_AUDIO_NAMCO163)) {
+		exp_audio_log_write(emu, EXP_AUDIO_NAMCO163, addr, value,
+				    cycles);
+		return;
+	}
 
-	audio = emu->namco163_audio;
+	namco163_audio_write(emu->namco163_audio, addr, value, cycles);
+}
+
+static void namco163_audio_write(void *chip, int addr, int value,
+				 uint32_t cycles)
+{
+	struct namco163_audio_state *audio = chip;
 
-	namco163_audio_run(audio, cycles);
+	namco163_audio_update(audio, cycles);
 
 	if (addr >= 0xf800) {
 		audio->current_address = value & 0x7f;
@@ -185,7 +434,10 @@ CPU_READ_HANDLER(namco163_audio_read_handler)
 
 	audio = emu->namco163_audio;
 
-	namco163_audio_run(audio, cycles);
+	/* Reads see the channel phases, so the chip has to be caught
+	   up here even when rendering is deferred. */
+	exp_audio_sync(emu);
+	namco163_audio_update(audio, cycles);
 
 	if (addr >= 0x4800) {
 		value = audio->ram[audio->current_address];
@@ -211,11 +463,14 @@ int namco163_audio_init(struct emu *emu)
 	audio->emu = emu;
 	emu->namco163_audio = audio;
 
-	return 0;
+	return exp_audio_register(emu, EXP_AUDIO_NAMCO163, audio,
+				  &namco163_audio_ops);
 }
 
 void namco163_audio_cleanup(struct emu *emu)
 {
+	exp_audio_unregister(emu, EXP_AUDIO_NAMCO163);
+
 	if (emu->namco163_audio)
 		free(emu->namco163_audio);
 
@@ -249,11 +504,21 @@ void namco163_audio_reset(struct namco163_audio_state *audio, int hard)
 	audio->timestamp = 0;
 }
 
-void namco163_audio_end_frame(struct namco163_audio_state *audio, uint32_t cycles)
+static void namco163_audio_update_end_frame(void *chip, uint32_t cycles)
 {
+	struct namco163_audio_state *audio = chip;
+
 	audio->timestamp -= cycles;
 }
 
+void namco163_audio_end_frame(struct namco163_audio_state *audio, uint32_t cycles)
+{
+	if (exp_audio_deferred(audio->emu, EXP_AUDIO_NAMCO163))
+		return;
+
+	namco163_audio_update_end_frame(audio, cycles);
+}
+
 void namco163_audio_install_handlers(struct emu *emu, int multi_chip_nsf)
 {
 	cpu_set_write_handler(emu->cpu, 0xf800, 1, 0,
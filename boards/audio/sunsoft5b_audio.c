@@ -294,9 +294,10 @@ void sunsoft5b_audio_update_amplitude(struct sunsoft5b_audio_state *audio,
 	config = audio->emu->config;
 
 	for (i = 0; i < 3; i++) {
+		int channel_out = 0;
+
 		if ((!audio->noise_enabled[i] || noise) &&
 		    (!audio->tone_enabled[i] || audio->tone[i].amplitude)) {
-			int channel_out;
 			int volume = config->sunsoft5b_channel_volume[i];
 
 			if (audio->envelope_enabled[i]) {
@@ -305,13 +306,20 @@ void sunsoft5b_audio_update_amplitude(struct sunsoft5b_audio_state *audio,
 				channel_out = volume_table[audio->tone[i].volume];
 			}
 
-			out += 128 * 64 * volume * channel_out / 10000;
+			channel_out = 128 * 64 * volume * channel_out / 10000;
+			out += channel_out;
+		}
+
+		if (audio->emu->audio_stems) {
+			audio_set_stem(audio->emu->audio,
+				       AUDIO_STEM_SUNSOFT5B + i, cycles,
+				       channel_out);
 		}
 	}
 
 	if (out != audio->last_amplitude) {
-		audio_add_delta(audio->emu->audio, cycles,
-		                out - audio->last_amplitude);
+		audio_add_delta(audio->emu->audio, AUDIO_CHIP_SUNSOFT5B,
+		                cycles, out - audio->last_amplitude);
 		audio->last_amplitude = out;
 	}
 }
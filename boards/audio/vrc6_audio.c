@@ -138,10 +138,22 @@ static void update_amplitude(struct vrc6_audio_state *audio, uint32_t cycles)
 
 	if (amplitude != audio->last_amplitude) {
 		int delta = amplitude - audio->last_amplitude;
-		audio_add_delta(audio->emu->audio,
+		audio_add_delta(audio->emu->audio, AUDIO_CHIP_VRC6,
 		                audio->timestamp, delta);
 		audio->last_amplitude = amplitude;
 	}
+
+	if (audio->emu->audio_stems) {
+		audio_set_stem(audio->emu->audio, AUDIO_STEM_VRC6_PULSE0,
+			       audio->timestamp,
+			       (audio->pulse[0].amplitude * master) >> 8);
+		audio_set_stem(audio->emu->audio, AUDIO_STEM_VRC6_PULSE1,
+			       audio->timestamp,
+			       (audio->pulse[1].amplitude * master) >> 8);
+		audio_set_stem(audio->emu->audio, AUDIO_STEM_VRC6_SAWTOOTH,
+			       audio->timestamp,
+			       (audio->sawtooth.amplitude * master) >> 8);
+	}
 }
 
 static void pulse_enable(struct vrc6_audio_state *audio, int channel,
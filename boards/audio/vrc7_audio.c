@@ -19,6 +19,7 @@
 
 #include "emu.h"
 #include "audio.h"
+#include "exp_audio.h"
 #include "emu2413.h"
 
 #define DEFAULT_RATE 48000
@@ -103,6 +104,16 @@ void vrc7_audio_cleanup(struct emu *emu);
 void vrc7_audio_reset(struct vrc7_audio_state *, int);
 void vrc7_audio_end_frame(struct vrc7_audio_state *, uint32_t cycles);
 
+static void vrc7_audio_write(void *chip, int addr, int value, uint32_t cycles);
+static void vrc7_audio_update(void *chip, uint32_t cycles);
+static void vrc7_audio_update_end_frame(void *chip, uint32_t cycles);
+
+static const struct exp_audio_chip_ops vrc7_audio_ops = {
+	.write = vrc7_audio_write,
+	.run = vrc7_audio_update,
+	.end_frame = vrc7_audio_update_end_frame,
+};
+
 int vrc7_audio_init(struct emu *emu)
 {
 	struct vrc7_audio_state *audio;
@@ -120,7 +131,7 @@ int vrc7_audio_init(struct emu *emu)
 	OPLL_set_quality(audio->opll, 1);
 	OPLL_set_rate(audio->opll, 49716);
 
-	return 0;
+	return exp_audio_register(emu, EXP_AUDIO_VRC7, audio, &vrc7_audio_ops);
 }
 
 void vrc7_audio_reset(struct vrc7_audio_state *audio, int hard)
@@ -138,11 +149,21 @@ void vrc7_audio_reset(struct vrc7_audio_state *audio, int hard)
 	}
 }
 
-void vrc7_audio_end_frame(struct vrc7_audio_state *audio, uint32_t cycles)
+static void vrc7_audio_update_end_frame(void *chip, uint32_t cycles)
 {
+	struct vrc7_audio_state *audio = chip;
+
 	audio->timestamp -= cycles;
 }
 
+void vrc7_audio_end_frame(struct vrc7_audio_state *audio, uint32_t cycles)
+{
+	if (exp_audio_deferred(audio->emu, EXP_AUDIO_VRC7))
+		return;
+
+	vrc7_audio_update_end_frame(audio, cycles);
+}
+
 static int update_amplitude(struct vrc7_audio_state *audio)
 {
 	int amplitude;
@@ -153,7 +174,7 @@ static int update_amplitude(struct vrc7_audio_state *audio)
 	amplitude = 0;
 
 	for (i = 0; i < 6; i++) {
-		int32_t val = audio->opll->slot[(i<<1)|1].output[1];
+		int32_t val = audio->opll->slots.output[1][(i<<1)|1];
 		amplitude += val * 128 * audio->emu->config->vrc7_channel_volume[i];
 	}
 
@@ -168,13 +189,41 @@ static int update_amplitude(struct vrc7_audio_state *audio)
 		return delta;
 }
 
+static void update_stems(struct vrc7_audio_state *audio, uint32_t cycles)
+{
+	const int master = 0.8f * 256.0;
+	int i;
+
+	for (i = 0; i < 6; i++) {
+		int32_t val = audio->opll->slots.output[1][(i<<1)|1];
+		int amplitude;
+
+		amplitude = val * 128 * audio->emu->config->vrc7_channel_volume[i];
+		amplitude = amplitude * master / 100 >> 8;
+
+		if (audio->muted)
+			amplitude = 0;
+
+		exp_audio_set_stem(audio->emu, AUDIO_STEM_VRC7 + i, cycles,
+				   amplitude);
+	}
+}
+
 CPU_WRITE_HANDLER(vrc7_audio_write_handler)
 {
-	struct vrc7_audio_state *audio;
+	if (exp_audio_deferred(emu, EXP_AUDIO_VRC7)) {
+		exp_audio_log_write(emu, EXP_AUDIO_VRC7, addr, value, cycles);
+		return;
+	}
 
-	audio = emu->vrc7_audio;
+	vrc7_audio_write(emu->vrc7_audio, addr, value, cycles);
+}
 
-	vrc7_audio_run(audio, cycles);
+static void vrc7_audio_write(void *chip, int addr, int value, uint32_t cycles)
+{
+	struct vrc7_audio_state *audio = chip;
+
+	vrc7_audio_update(audio, cycles);
 
 	if (addr == 0x9010) {
 		OPLL_writeIO(audio->opll, 0, value);
@@ -188,20 +237,32 @@ CPU_WRITE_HANDLER(vrc7_audio_write_handler)
 
 		if (!audio->muted && muted) {
 			delta = -audio->last_amplitude;
-			audio_add_delta(audio->emu->audio,
-			                cycles, delta);
+			exp_audio_add_delta(audio->emu, AUDIO_CHIP_VRC7,
+					    cycles, delta);
 		} else if (audio->muted && !muted) {
 			delta = audio->last_amplitude;
-			audio_add_delta(audio->emu->audio,
-			                cycles, delta);
+			exp_audio_add_delta(audio->emu, AUDIO_CHIP_VRC7,
+					    cycles, delta);
 		}
 
 		audio->muted = muted;
+
+		if (audio->emu->audio_stems)
+			update_stems(audio, cycles);
 	}
 }
 
 void vrc7_audio_run(struct vrc7_audio_state *audio, uint32_t cycles)
 {
+	if (exp_audio_deferred(audio->emu, EXP_AUDIO_VRC7))
+		return;
+
+	vrc7_audio_update(audio, cycles);
+}
+
+static void vrc7_audio_update(void *chip, uint32_t cycles)
+{
+	struct vrc7_audio_state *audio = chip;
 	int elapsed;
 	int timestamp;
 	int clocks;
@@ -210,19 +271,38 @@ void vrc7_audio_run(struct vrc7_audio_state *audio, uint32_t cycles)
 	elapsed = cycles - timestamp;
 	clocks = elapsed / (36 * audio->emu->apu_clock_divider);
 
-	if (audio->emu->overclocking)
+	if (exp_audio_overclocking(audio->emu))
 		return;
 
 	while (clocks > 0) {
 		int delta;
 
 		timestamp += 36 * audio->emu->apu_clock_divider;
+
+		/* Once every channel has finished the output can't
+		   change until the next register write, so the rest of
+		   this run can be skipped. */
+		if (OPLL_is_silent(audio->opll)) {
+			OPLL_skip(audio->opll, clocks);
+			delta = update_amplitude(audio);
+			if (delta)
+				exp_audio_add_delta(audio->emu,
+						    AUDIO_CHIP_VRC7,
+						    timestamp, delta);
+			if (audio->emu->audio_stems)
+				update_stems(audio, timestamp);
+			timestamp += (clocks - 1) * 36 *
+				audio->emu->apu_clock_divider;
+			break;
+		}
+
 		OPLL_calc(audio->opll);
 		delta = update_amplitude(audio);
-		if (delta) {
-			audio_add_delta(audio->emu-> audio,
-			                timestamp, delta);
-		}
+		if (delta)
+			exp_audio_add_delta(audio->emu, AUDIO_CHIP_VRC7,
+					    timestamp, delta);
+		if (audio->emu->audio_stems)
+			update_stems(audio, timestamp);
 		clocks--;
 	}
 
@@ -231,6 +311,8 @@ void vrc7_audio_run(struct vrc7_audio_state *audio, uint32_t cycles)
 
 void vrc7_audio_cleanup(struct emu *emu)
 {
+	exp_audio_unregister(emu, EXP_AUDIO_VRC7);
+
 	if (emu->vrc7_audio) {
 		OPLL_delete(emu->vrc7_audio->opll);
 		free(emu->vrc7_audio);
@@ -251,6 +333,7 @@ int vrc7_audio_save_state(struct emu *emu, struct save_state *state)
 {
 
 	struct vrc7_audio_state *audio;
+	OPLL_SLOT slot;
 	size_t size;
 	uint8_t *buf, *ptr;
 	int rc;
@@ -260,8 +343,8 @@ int vrc7_audio_save_state(struct emu *emu, struct save_state *state)
 
 	size  = pack_state(audio, vrc7_audio_state_items, NULL);
 	size += pack_state(&audio->opll, vrc7_opll_state_items, NULL);
-	size += 12 * pack_state(&audio->opll->slot[0],
-				vrc7_opll_slot_state_items, NULL);
+	size += OPLL_SLOT_NUM * pack_state(&slot, vrc7_opll_slot_state_items,
+					   NULL);
 
 	buf = malloc(size);
 	if (!buf)
@@ -271,9 +354,11 @@ int vrc7_audio_save_state(struct emu *emu, struct save_state *state)
 	ptr += pack_state(audio, vrc7_audio_state_items, ptr);
 	ptr += pack_state(audio->opll, vrc7_opll_state_items, ptr);
 
-	for (i = 0; i < 12; i++) {
-		ptr += pack_state(&audio->opll->slot[i],
-				  vrc7_opll_slot_state_items, ptr);
+	/* The OPLL keeps its slots one array per field; they're saved
+	   one slot at a time, as they always have been. */
+	for (i = 0; i < OPLL_SLOT_NUM; i++) {
+		OPLL_get_slot(audio->opll, i, &slot);
+		ptr += pack_state(&slot, vrc7_opll_slot_state_items, ptr);
 	}
 
 	rc = save_state_add_chunk(state, "VC7S", buf, size);
@@ -285,6 +370,7 @@ int vrc7_audio_save_state(struct emu *emu, struct save_state *state)
 int vrc7_audio_load_state(struct emu *emu, struct save_state *state)
 {
 	struct vrc7_audio_state *audio;
+	OPLL_SLOT slot;
 	size_t size;
 	uint8_t *buf;
 	int i;
@@ -297,9 +383,11 @@ int vrc7_audio_load_state(struct emu *emu, struct save_state *state)
 	buf += unpack_state(audio, vrc7_audio_state_items, buf);
 	buf += unpack_state(audio->opll, vrc7_opll_state_items, buf);
 
-	for (i = 0; i < 12; i++) {
-		buf += unpack_state(&audio->opll->slot[i],
-				    vrc7_opll_slot_state_items, buf);
+	/* Fields the state doesn't include are left as they were */
+	for (i = 0; i < OPLL_SLOT_NUM; i++) {
+		OPLL_get_slot(audio->opll, i, &slot);
+		buf += unpack_state(&slot, vrc7_opll_slot_state_items, buf);
+		OPLL_set_slot(audio->opll, i, &slot);
 	}
 
 	return 0;
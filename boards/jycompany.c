@@ -117,6 +117,11 @@ static struct bank jycompany_init_chr[] = {
 /* FIXME placeholder */
 #define reverse_bank(b, k) ((b)->prg_banks[k].bank = reverse_lookup[(b)->prg_banks[k].bank] >> 1)
 
+/* MMC2-style latches switch on fetches of tiles $FD and $FE */
+static const int jycompany_triggers[] = {
+	0x0fd8, 0x0fe8, 0x1fd8, 0x1fe8, -1
+};
+
 static void jycompany_ppu_read_hook(struct board *board, int ppu_addr)
 {
 	int latch;
@@ -252,7 +257,8 @@ static void jycompany_set_chr_mode(struct board *board, int mode)
 		board->chr_banks0[4].address = 0x1000;
 		board->chr_banks0[6].address = 0x1000;
 		if (mirror)
-			ppu_set_read_hook(jycompany_ppu_read_hook);
+			ppu_set_read_hook_triggers(jycompany_ppu_read_hook,
+						   jycompany_triggers);
 		break;
 	case 0x02:
 		board->chr_banks0[0].size = SIZE_2K;
@@ -27,6 +27,12 @@ static void mmc4_reset(struct board *board, int);
 static CPU_WRITE_HANDLER(mmc4_write_handler);
 static void mmc4_ppu_hook(struct board *board, int addr);
 
+/* The latches only change on fetches of tiles $FD and $FE (high
+   plane) from either pattern table */
+static const int mmc4_triggers[] = {
+	0x0fd8, 0x0fe8, 0x1fd8, 0x1fe8, -1
+};
+
 static struct board_funcs mmc4_funcs =
     { .init = mmc4_init, .reset = mmc4_reset, };
 
@@ -85,7 +91,7 @@ struct board_info board_pxrom = {
 
 static int mmc4_init(struct board *board)
 {
-	ppu_set_read_hook(mmc4_ppu_hook);
+	ppu_set_read_hook_triggers(mmc4_ppu_hook, mmc4_triggers);
 
 	return 0;
 }
@@ -116,6 +122,10 @@ static void mmc4_ppu_hook(struct board *board, int ppu_addr)
 		return;
 	}
 
+	/* Most triggering fetches don't change anything */
+	if ((bank >> 1 ? _latch1 : _latch0) == 0xfd + (bank & 1))
+		return;
+
 	if (bank >> 1)
 		_latch1 = 0xfd + (bank & 1);
 	else
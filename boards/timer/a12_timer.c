@@ -91,6 +91,7 @@ struct a12_timer {
 	int prescaler_mask;
 	int prescaler_size;
 	int prescaler;
+	int fast_irq_enabled;
 
 	struct emu *emu;
 };
@@ -203,6 +204,7 @@ int a12_timer_init(struct emu *emu, int variant)
 	timer->alt = 0;
 	timer->a12_rise_delta = 4;
 	timer->edge = 0x1000;
+	timer->fast_irq_enabled = emu->config->a12_timer_fast_irq;
 
 	switch (variant) {
 	case A12_TIMER_VARIANT_MMC3_STD:
@@ -570,7 +572,7 @@ static void a12_timer_schedule_irq(struct a12_timer *timer)
 	}
 
 #if FAST_IRQ
-	tested_fast_irq_method = 0;
+	tested_fast_irq_method = !timer->fast_irq_enabled;
 #endif
 
 	while (count >= 0) {
@@ -43,6 +43,45 @@ struct m2_timer
 	struct emu *emu;
 };
 
+/* Clear to make the prescaler math step one underflow at a time, as
+   it used to.  tests/m2_timer_test.c compares the two. */
+static int m2_timer_closed_form = 1;
+
+/* The prescaler is decremented by 'decrement' every CPU cycle and
+   has 'reload' + 1 added when it goes negative.  Starting from
+   'prescaler', the k-th underflow happens on cycle
+   (prescaler + (k - 1) * (reload + 1)) / decrement + 1, which gives
+   the closed forms below.  They only hold if reloading can't leave
+   the prescaler negative, so callers check prescaler_closed_form()
+   first and step otherwise.
+*/
+static int prescaler_closed_form(int prescaler, int decrement, int reload)
+{
+	return m2_timer_closed_form && (prescaler >= 0) &&
+		(decrement >= 1) && (decrement <= reload + 1);
+}
+
+/* Underflows during the next 'cycles' CPU cycles */
+static int prescaler_underflows(int prescaler, int decrement, int reload,
+				int cycles)
+{
+	int64_t last;
+
+	last = (int64_t)decrement * cycles - 1 - prescaler;
+	if (last < 0)
+		return 0;
+
+	return last / (reload + 1) + 1;
+}
+
+/* CPU cycles until the given underflow (counting from 1) */
+static int prescaler_cycles_until(int prescaler, int decrement, int reload,
+				  int underflow)
+{
+	return (prescaler + (int64_t)(underflow - 1) * (reload + 1)) /
+		decrement + 1;
+}
+
 static struct state_item m2_timer_state_items[] = {
 	STATE_32BIT(m2_timer, timestamp),
 	STATE_32BIT(m2_timer, flags),
@@ -178,6 +217,16 @@ void m2_timer_schedule_irq(struct m2_timer *timer, uint32_t cycles)
 			(prescaler_reload + 1);
 		remaining %= timer->prescaler_decrement;
 
+		if ((remaining > 0) &&
+		    prescaler_closed_form(prescaler,
+					  timer->prescaler_decrement,
+					  prescaler_reload)) {
+			cpu_clocks += prescaler_cycles_until(prescaler,
+				      timer->prescaler_decrement,
+				      prescaler_reload, remaining);
+			remaining = 0;
+		}
+
 		while (remaining > 0) {
 			clocks = (prescaler / timer->prescaler_decrement) + 1;
 
@@ -291,6 +340,21 @@ void m2_timer_run(struct m2_timer *timer, uint32_t cycles)
 			timer->prescaler_decrement;
 		elapsed %= prescaler_reload + 1;
 
+		if (elapsed &&
+		    prescaler_closed_form(prescaler,
+					  timer->prescaler_decrement,
+					  prescaler_reload)) {
+			int underflows;
+
+			underflows = prescaler_underflows(prescaler,
+				     timer->prescaler_decrement,
+				     prescaler_reload, elapsed);
+			counter_clocks += underflows;
+			prescaler += underflows * (prescaler_reload + 1) -
+				elapsed * timer->prescaler_decrement;
+			elapsed = 0;
+		}
+
 		while (elapsed) {
 			int clocks = (prescaler /
 				      timer->prescaler_decrement) + 1;
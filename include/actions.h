@@ -427,4 +427,6 @@
 #define ACTION_OVERCLOCK_POST_RENDER   0x80ffff57
 #define ACTION_OVERCLOCK_VBLANK        0x80ffff58
 
+#define ACTION_TOGGLE_AUDIO_STATS      0x30ffff59
+
 #endif
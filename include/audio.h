@@ -24,14 +24,68 @@
 
 struct audio_state;
 
+/* Sound chips; each one's deltas are staged separately until the
+   end of the frame */
+enum audio_chip {
+	AUDIO_CHIP_APU,
+	AUDIO_CHIP_VRC6,
+	AUDIO_CHIP_VRC7,
+	AUDIO_CHIP_NAMCO163,
+	AUDIO_CHIP_FDS,
+	AUDIO_CHIP_MMC5,
+	AUDIO_CHIP_SUNSOFT5B,
+	AUDIO_CHIP_COUNT,
+};
+
+/* Individual sound sources, for capturing each one separately */
+enum audio_stem {
+	AUDIO_STEM_PULSE0,
+	AUDIO_STEM_PULSE1,
+	AUDIO_STEM_TRIANGLE,
+	AUDIO_STEM_NOISE,
+	AUDIO_STEM_DMC,
+	AUDIO_STEM_VRC6_PULSE0,
+	AUDIO_STEM_VRC6_PULSE1,
+	AUDIO_STEM_VRC6_SAWTOOTH,
+	AUDIO_STEM_VRC7,	/* 6 channels */
+	AUDIO_STEM_NAMCO163 = AUDIO_STEM_VRC7 + 6, /* 8 channels */
+	AUDIO_STEM_FDS = AUDIO_STEM_NAMCO163 + 8,
+	AUDIO_STEM_MMC5_PULSE0,
+	AUDIO_STEM_MMC5_PULSE1,
+	AUDIO_STEM_MMC5_PCM,
+	AUDIO_STEM_SUNSOFT5B,	/* 3 channels */
+	AUDIO_STEM_COUNT = AUDIO_STEM_SUNSOFT5B + 3,
+};
+
 int audio_init(struct emu *emu);
-void audio_cleanup(struct audio_state *audio);
-int audio_fill_buffer(struct audio_state *audio, uint32_t cycles);
-void audio_add_delta(struct audio_state *audio, unsigned time, int delta);
+int audio_cleanup(struct audio_state *audio);
+void audio_fill_buffer(struct audio_state *audio, uint32_t cycles);
+void audio_add_delta(struct audio_state *audio, int chip, unsigned time,
+		     int delta);
+void audio_add_delayed_deltas(struct audio_state *audio, int chip,
+			      const uint32_t *times, const int *deltas,
+			      int count);
+void audio_set_frame_delay(struct audio_state *audio, int enabled);
+void audio_set_render_output(void (*output)(const int16_t *samples,
+					    int count, void *data),
+			     void *data);
+void audio_set_stem(struct audio_state *audio, int stem, unsigned time,
+		    int amplitude);
+void audio_set_delayed_stem(struct audio_state *audio, int stem,
+			    unsigned time, int amplitude);
+void audio_set_stem_output(void (*output)(int stem, const int16_t *samples,
+					  int count, void *data),
+			   void *data);
+const char *audio_stem_name(int stem);
+void audio_worker_submit(void (*func)(void *), void *data);
+void audio_worker_wait(void);
+void audio_worker_stop(void);
 int audio_buffer_check(void);
 void audio_pause(int);
 int audio_apply_config(struct audio_state *audio);
 void audio_mute(int);
+void audio_show_stats(void);
+void audio_toggle_stats(int);
 
 void audio_reset(struct audio_state *audio);
 
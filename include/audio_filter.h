@@ -0,0 +1,55 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#ifndef __AUDIO_FILTER_H__
+#define __AUDIO_FILTER_H__
+
+#include <stdint.h>
+
+/* First-order filters modelling the console's analog output stage.
+   Samples are filtered in place, in fixed point; state is kept
+   between calls so a stream can be filtered a block at a time.
+*/
+
+enum audio_filter_type {
+	AUDIO_FILTER_NONE,
+	AUDIO_FILTER_NES,	/* 90 Hz and 440 Hz high-pass, 14 kHz low-pass */
+	AUDIO_FILTER_FAMICOM,	/* 37 Hz high-pass, 14 kHz low-pass */
+};
+
+#define AUDIO_FILTER_MAX_STAGES 3
+
+struct audio_filter_stage {
+	int32_t coeff;		/* 16.16 */
+	int highpass;
+	int32_t prev_in;	/* samples * 4096 */
+	int32_t out;
+};
+
+struct audio_filter {
+	int stage_count;
+	struct audio_filter_stage stages[AUDIO_FILTER_MAX_STAGES];
+};
+
+void audio_filter_init(struct audio_filter *filter,
+		       enum audio_filter_type type, double sample_rate);
+void audio_filter_run(struct audio_filter *filter, int16_t *samples,
+		      int count, int stereo);
+
+#endif				/* __AUDIO_FILTER_H__ */
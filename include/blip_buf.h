@@ -32,6 +32,15 @@ void blip_clear( blip_t* );
 /** Adds positive/negative delta into buffer at specified clock time. */
 void blip_add_delta( blip_t*, unsigned int clock_time, int delta );
 
+enum { /** Gain for blip_add_deltas() that leaves deltas unchanged. */
+blip_unity_gain = 1 << 16 };
+
+/** Adds deltas [i] at clock time times [i] for each of the count deltas, each
+one scaled by gain/blip_unity_gain. Same as calling blip_add_delta() for each
+scaled delta, but the setup is done once for the whole batch. */
+void blip_add_deltas( blip_t*, unsigned const times [], int const deltas [],
+int count, int gain );
+
 /** Same as blip_add_delta(), but uses faster, lower-quality synthesis. */
 void blip_add_delta_fast( blip_t*, unsigned int clock_time, int delta );
 
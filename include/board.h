@@ -63,6 +63,16 @@ enum board_info_flag {
 	BOARD_INFO_FLAG_M2_TIMER = 0x80,
 };
 
+/* Page table entries rewritten by the bank sync functions */
+struct board_sync_stats {
+	unsigned int prg_syncs;
+	unsigned int prg_pages;
+	unsigned int chr_syncs;
+	unsigned int chr_pages;
+	unsigned int nmt_syncs;
+	unsigned int nmt_pages;
+};
+
 #define MAP_PRG_SLOT_SIZE 2048
 #define MAP_PRG_START 0x6000
 #define MAP_PRG_END   0x10000
@@ -114,6 +124,8 @@ void board_set_dip_switch(struct board *, int sw, int on);
 void board_set_ppu_mirroring(struct board *, int type);
 
 void board_end_frame(struct board *, uint32_t cycles);
+void board_get_sync_stats(struct board *, struct board_sync_stats *frame,
+			  struct board_sync_stats *total);
 
 int board_init(struct emu *, struct rom *rom);
 void board_reset(struct board *, int hard);
@@ -127,6 +139,7 @@ void board_nmt_sync(struct board *);
 
 void board_get_chr_rom(struct board *, uint8_t ** romptr, size_t *sizeptr);
 void board_get_mapper_ram(struct board *, uint8_t ** ramptr, size_t *sizeptr);
+void board_get_wram(struct board *, uint8_t ** ramptr, size_t *sizeptr);
 
 uint32_t board_get_type(struct board *);
 int board_save_state(struct board *board, struct save_state *state);
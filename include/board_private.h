@@ -99,6 +99,21 @@ struct bank {
 	int type;
 };
 
+/* A PRG or CHR slot as last written to the CPU or PPU page tables */
+struct bank_mapping {
+	uint8_t *data;
+	size_t size;
+	uint32_t address;
+	uint64_t pages;		/* bit n set if 1 KB page n is written */
+	int perms;
+};
+
+/* A nametable as last passed to ppu_map_nametable() */
+struct nmt_mapping {
+	uint8_t *data;
+	int perms;
+};
+
 struct nmt_bank {
 	int bank;
 	int type;
@@ -171,6 +186,13 @@ struct board {
 	HANDLE nv_ram_handle;
 	HANDLE nv_ram_map_handle;
 #endif
+	/* Periodic writeback of battery-backed RAM that isn't memory
+	   mapped: the path it is saved to, a copy of what was last
+	   written, and the interval and frame count in frames. */
+	char *nv_ram_save_path;
+	uint8_t *nv_ram_shadow;
+	unsigned int nv_ram_writeback_interval;
+	unsigned int nv_ram_writeback_frames;
 	uint8_t *ram_data;
 	size_t ram_size;
 
@@ -205,6 +227,20 @@ struct board {
 	struct bank chr_banks1[12];
 	struct nmt_bank nmt_banks[4];
 
+	struct bank_mapping prg_mappings[20];
+	struct bank_mapping chr_mappings[2][12];
+	struct nmt_mapping nmt_mappings[4];
+	int prg_mappings_valid;
+	int chr_mappings_valid[2];
+	int nmt_mappings_valid;
+
+	/* Page table work done by the sync functions: this frame so
+	   far, the last complete frame, and since the board was loaded */
+	struct board_sync_stats sync_stats;
+	struct board_sync_stats last_sync_stats;
+	struct board_sync_stats total_sync_stats;
+	unsigned int sync_stats_frames;
+
 	unsigned int prg_and;
 	unsigned int prg_or;
 	unsigned int chr_and;
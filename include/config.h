@@ -67,6 +67,10 @@ struct config {
 
 	int fps_display_enabled;
 	int scanline_renderer_enabled;
+	int scanline_renderer_auto;
+	int scanline_renderer_unsafe;
+	int a12_timer_fast_irq;
+	const char *state_export_name;
 	int window_scaling_factor;
 	int fullscreen;
 	int autohide_cursor;
@@ -116,14 +120,19 @@ struct config {
 	/* Audio/APU options */
 	int sample_rate;
 	int audio_buffer_size;
+	int audio_latency_target;
+	int expansion_audio_thread;
 	int force_stereo;
 	int dynamic_rate_adjustment_enabled;
+	int audio_resampler_rate;
+	const char *audio_filter;
 	int master_volume;
 	int apu_pulse0_volume;
 	int apu_pulse1_volume;
 	int apu_triangle_volume;
 	int apu_noise_volume;
 	int apu_dmc_volume;
+	int apu_synthesis_enabled;
 	int fds_volume;
 	int vrc6_pulse0_volume;
 	int vrc6_pulse1_volume;
@@ -134,6 +143,7 @@ struct config {
 	int mmc5_pcm_volume;
 	int sunsoft5b_channel_volume[3];
 	int namco163_channel_volume[8];
+	int namco163_mixed_output;
 	int swap_pulse_duty_cycles;
 	const char *raw_pcm_filter;
 
@@ -156,6 +166,7 @@ struct config {
 	int skip_maincfg;
 	int skip_romcfg;
 	int nvram_uses_memmap;
+	int nvram_writeback_interval;
 	int autopatch_enabled;
 	const char *timing;
 	int save_uses_romdir;
@@ -210,8 +221,6 @@ struct config {
 #endif
 
 	double dynamic_rate_adjustment_max;
-	double dynamic_rate_adjustment_low_watermark;
-	double dynamic_rate_adjustment_buffer_range;
 
 	const char *preferred_console_type;
 	const char *rom_system_type;
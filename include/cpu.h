@@ -108,6 +108,9 @@ int cpu_get_pc(struct cpu_state *cpu);
 int cpu_get_opcode(struct cpu_state *cpu);
 int cpu_get_opcode_address(struct cpu_state *cpu);
 int cpu_get_stack_pointer(struct cpu_state *cpu);
+void cpu_get_registers(struct cpu_state *cpu, int *pc, int *a, int *x,
+		       int *y, int *s, int *p);
+uint32_t cpu_get_frame_irq_hash(struct cpu_state *cpu);
 void cpu_set_trace(struct cpu_state *cpu, int enabled);
 int cpu_save_state(struct cpu_state *cpu, struct save_state *state);
 int cpu_load_state(struct cpu_state *cpu, struct save_state *state);
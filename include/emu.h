@@ -34,6 +34,8 @@ struct rom;
 struct vrc_timer;
 struct a12_timer;
 struct m2_timer;
+struct state_export;
+struct exp_audio;
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -126,6 +128,8 @@ struct emu {
 	struct vrc_timer *vrc_timer;
 	struct a12_timer *a12_timer;
 	struct m2_timer *m2_timer;
+	struct state_export *state_export;
+	struct exp_audio *exp_audio;
 
 	/* Nothing below here should be modified directly; any
 	   changes should be done with the appropriate
@@ -160,6 +164,11 @@ struct emu {
 
 	int overclocking;
 
+	/* Set by the audio frontend while each sound source is being
+	   captured separately; sound chips report their channels'
+	   levels with audio_set_stem() only when this is set. */
+	int audio_stems;
+
 	struct rom *rom;
 	uint8_t *bios;
 	size_t bios_size;
@@ -189,6 +198,12 @@ void emu_toggle_scanline_renderer(struct emu *emu);
 void emu_toggle_sprites(struct emu *emu);
 void emu_toggle_bg(struct emu *emu);
 void emu_toggle_cheats(struct emu *emu);
+void emu_set_frame_hash_enabled(struct emu *emu, int enabled);
+uint64_t emu_get_frame_hash(struct emu *emu);
+uint64_t emu_get_scanline_hash(struct emu *emu, int scanline);
+uint32_t emu_get_frame_irq_hash(struct emu *emu);
+void emu_get_cpu_registers(struct emu *emu, int *pc, int *a, int *x,
+			   int *y, int *s, int *p);
 void emu_pause(struct emu *emu, int pause);
 int emu_load_state(struct emu *emu, const char *filename);
 int emu_save_state(struct emu *emu, const char *filename);
@@ -10,7 +10,7 @@ typedef struct __OPLL_PATCH {
 	uint32_t TL, FB, EG, ML, AR, DR, SL, RR, KR, KL, AM, PM, WF;
 } OPLL_PATCH;
 
-/* slot */
+/* One slot, in the layout the save state uses; see OPLL_get_slot() */
 typedef struct __OPLL_SLOT {
 
 	OPLL_PATCH patch;
@@ -22,7 +22,7 @@ typedef struct __OPLL_SLOT {
 	int32_t output[2];	/* Output value of slot */
 
 	/* for Phase Generator (PG) */
-	uint16_t *sintbl;	/* Wavetable */
+	const uint16_t *sintbl;	/* Wavetable */
 	uint32_t phase;		/* Phase */
 	uint32_t dphase;	/* Phase increment amount */
 	uint32_t pgout;		/* output */
@@ -40,6 +40,45 @@ typedef struct __OPLL_SLOT {
 	uint32_t egout;		/* output */
 } OPLL_SLOT;
 
+#define OPLL_SLOT_NUM (6 * 2)
+
+/* All slots, one array per field so that calc() can step every slot
+   at once.  The modulator and carrier of channel n are slots 2n and
+   2n + 1. */
+typedef struct __OPLL_SLOTS {
+
+	/* voice data */
+	uint32_t TL[OPLL_SLOT_NUM], FB[OPLL_SLOT_NUM], EG[OPLL_SLOT_NUM];
+	uint32_t ML[OPLL_SLOT_NUM], AR[OPLL_SLOT_NUM], DR[OPLL_SLOT_NUM];
+	uint32_t SL[OPLL_SLOT_NUM], RR[OPLL_SLOT_NUM], KR[OPLL_SLOT_NUM];
+	uint32_t KL[OPLL_SLOT_NUM], AM[OPLL_SLOT_NUM], PM[OPLL_SLOT_NUM];
+	uint32_t WF[OPLL_SLOT_NUM];
+
+	int32_t type[OPLL_SLOT_NUM];
+
+	/* OUTPUT */
+	int32_t feedback[OPLL_SLOT_NUM];
+	int32_t output[2][OPLL_SLOT_NUM];
+
+	/* for Phase Generator (PG) */
+	const uint16_t *sintbl[OPLL_SLOT_NUM];
+	uint32_t phase[OPLL_SLOT_NUM];
+	uint32_t dphase[OPLL_SLOT_NUM];
+	uint32_t pgout[OPLL_SLOT_NUM];
+
+	/* for Envelope Generator (EG) */
+	int32_t fnum[OPLL_SLOT_NUM];
+	int32_t block[OPLL_SLOT_NUM];
+	int32_t volume[OPLL_SLOT_NUM];
+	int32_t sustine[OPLL_SLOT_NUM];
+	uint32_t tll[OPLL_SLOT_NUM];
+	uint32_t rks[OPLL_SLOT_NUM];
+	int32_t eg_mode[OPLL_SLOT_NUM];
+	uint32_t eg_phase[OPLL_SLOT_NUM];
+	uint32_t eg_dphase[OPLL_SLOT_NUM];
+	uint32_t egout[OPLL_SLOT_NUM];
+} OPLL_SLOTS;
+
 /* Mask */
 #define OPLL_MASK_CH(x) (1<<(x))
 
@@ -78,7 +117,7 @@ typedef struct __OPLL {
 	int32_t key_status[6];
 
 	/* Slot */
-	OPLL_SLOT slot[6 * 2];
+	OPLL_SLOTS slots;
 
 	/* Voice Data */
 	OPLL_PATCH patch[19 * 2];
@@ -101,10 +140,16 @@ extern void OPLL_writeReg(OPLL *, uint32_t reg, uint32_t val);
 
 /* Synthsize */
 extern int16_t OPLL_calc(OPLL *);
+extern int OPLL_is_silent(OPLL *);
+extern void OPLL_skip(OPLL *, uint32_t count);
 
 /* Misc */
 extern void OPLL_forceRefresh(OPLL *);
 
+/* Save state */
+extern void OPLL_get_slot(OPLL *, int32_t i, OPLL_SLOT *slot);
+extern void OPLL_set_slot(OPLL *, int32_t i, const OPLL_SLOT *slot);
+
 /* Channel Mask */
 extern uint32_t OPLL_setMask(OPLL *, uint32_t mask);
 extern uint32_t OPLL_toggleMask(OPLL *, uint32_t mask);
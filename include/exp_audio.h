@@ -0,0 +1,71 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#ifndef __EXP_AUDIO_H__
+#define __EXP_AUDIO_H__
+
+#include "emu.h"
+
+/* Deferred rendering of expansion audio.
+
+   When expansion_audio_thread is enabled, chips that register here
+   don't synthesize anything while the CPU runs.  Their register writes
+   are logged with timestamps instead, and at the end of each frame the
+   log is handed to a worker thread, which replays it against the chip
+   and collects the resulting deltas while the next frame is emulated.
+   Those deltas are added to the audio buffer at the end of the next
+   frame; the frontend delays the whole mix by one frame so they still
+   line up with the APU.
+
+   Anything that needs the chip's current state (register reads, save
+   states, resets) must call exp_audio_sync() first, which waits for
+   the worker and replays the current frame's log inline.
+*/
+
+enum exp_audio_chip_id {
+	EXP_AUDIO_VRC7,
+	EXP_AUDIO_NAMCO163,
+	EXP_AUDIO_FDS,
+	EXP_AUDIO_CHIP_COUNT,
+};
+
+struct exp_audio_chip_ops {
+	/* Applies a register write, after catching up to 'cycles' */
+	void (*write)(void *chip, int addr, int value, uint32_t cycles);
+	void (*run)(void *chip, uint32_t cycles);
+	void (*end_frame)(void *chip, uint32_t cycles);
+};
+
+struct exp_audio;
+
+int exp_audio_register(struct emu *emu, enum exp_audio_chip_id id,
+		       void *chip, const struct exp_audio_chip_ops *ops);
+void exp_audio_unregister(struct emu *emu, enum exp_audio_chip_id id);
+int exp_audio_deferred(struct emu *emu, enum exp_audio_chip_id id);
+void exp_audio_log_write(struct emu *emu, enum exp_audio_chip_id id,
+			 int addr, int value, uint32_t cycles);
+void exp_audio_add_delta(struct emu *emu, int chip, uint32_t cycles,
+			 int delta);
+void exp_audio_set_stem(struct emu *emu, int stem, uint32_t cycles,
+			int amplitude);
+int exp_audio_overclocking(struct emu *emu);
+void exp_audio_sync(struct emu *emu);
+void exp_audio_end_frame(struct emu *emu, uint32_t cycles);
+
+#endif				/* __EXP_AUDIO_H__ */
@@ -28,6 +28,10 @@
 int check_file_exists(const char *name);
 int readfile(const char *name, uint8_t * buf, uint32_t size);
 int writefile(const char *name, uint8_t * buf, uint32_t size);
+int writefile_atomic(const char *name, const uint8_t *buf, uint32_t size);
+int writefile_async(const char *name, const uint8_t *buf, uint32_t size);
+void writefile_async_wait(void);
+void writefile_async_stop(void);
 ssize_t get_file_size(const char *name);
 int process_file(const char *filename, void *data,
                  void (*callback)(char *, int, void *), int, int, int);
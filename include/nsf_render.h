@@ -0,0 +1,55 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#ifndef __NSF_RENDER_H__
+#define __NSF_RENDER_H__
+
+#include "emu.h"
+
+struct nsf_render_options {
+	/* Output file; ending in ".wav" writes a WAV file, anything
+	   else raw 16-bit little-endian PCM.  If it contains "%d",
+	   each track goes to its own file with the track number
+	   substituted, otherwise tracks are concatenated in order. */
+	const char *output;
+
+	/* Comma-separated tracks and ranges ("1,3,5-8"); NULL or
+	   "all" for every track in the file. */
+	const char *tracks;
+
+	/* Maximum length of each track, in seconds */
+	int length;
+
+	/* Seconds of silence that end a track once it has started
+	   playing; 0 to always render the full length */
+	int silence;
+
+	/* Number of tracks to render at once; 0 for one per CPU */
+	int jobs;
+
+	/* If set, each sound source is also written to its own file
+	   (see stems.h); "%d" is replaced by the track number and is
+	   required when rendering more than one track. */
+	const char *stems;
+};
+
+int nsf_render(struct emu *emu, char *filename,
+	       struct nsf_render_options *options);
+
+#endif				/* __NSF_RENDER_H__ */
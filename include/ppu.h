@@ -42,8 +42,11 @@ int ppu_get_type(struct ppu_state *);
 void ppu_set_reset_connected(struct ppu_state *ppu, int connected);
 int ppu_get_reset_connected(struct ppu_state *ppu);
 void ppu_set_read_hook(void (*hook) (struct board *, int));
+void ppu_set_read_hook_triggers(void (*hook) (struct board *, int),
+				const int *triggers);
 void ppu_enable_a12_timer(struct ppu_state *ppu, int);
 uint8_t *ppu_get_oam_ptr(struct ppu_state *ppu);
+uint8_t *ppu_get_palette_ptr(struct ppu_state *ppu);
 void ppu_use_exram(struct ppu_state *ppu, int mode, uint32_t cycles);
 uint32_t ppu_get_cycles(struct ppu_state *ppu, int *, int *, int *, int *);
 int ppu_get_burst_phase(struct ppu_state *ppu);
@@ -79,8 +82,15 @@ void ppu_set_split_screen_bank(struct ppu_state *, int value, uint32_t cycles);
 void ppu_set_sprite_limit(struct ppu_state *, int);
 void ppu_set_sprite_hiding(struct ppu_state *, int);
 void ppu_set_scanline_renderer(struct ppu_state *, int);
+void ppu_get_renderer_stats(struct ppu_state *ppu,
+			    unsigned int *scanline_frames,
+			    unsigned int *cycle_frames,
+			    unsigned int *midline_update_frames);
 void ppu_toggle_bg(struct ppu_state *);
 void ppu_toggle_sprites(struct ppu_state *);
+void ppu_set_frame_hash_enabled(struct ppu_state *ppu, int enabled);
+uint64_t ppu_get_frame_hash(struct ppu_state *ppu);
+uint64_t ppu_get_scanline_hash(struct ppu_state *ppu, int scanline);
 int ppu_save_state(struct ppu_state *ppu, struct save_state *state);
 int ppu_load_state(struct ppu_state *ppu, struct save_state *state);
 uint8_t ppu_peek(struct ppu_state *ppu, int addr);
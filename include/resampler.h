@@ -0,0 +1,47 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#ifndef __RESAMPLER_H__
+#define __RESAMPLER_H__
+
+#include <stdint.h>
+
+/* Polyphase windowed-sinc resampler for 16-bit mono audio.
+
+   The filter is designed once, for the rates given to
+   resampler_new(); resampler_set_rates() only changes the step
+   between output samples, so small rate adjustments are cheap.
+   Resampled output is buffered internally until it's read.
+*/
+
+struct resampler;
+
+struct resampler *resampler_new(double input_rate, double output_rate,
+				int output_size);
+void resampler_delete(struct resampler *resampler);
+void resampler_set_rates(struct resampler *resampler, double input_rate,
+			 double output_rate);
+int resampler_input_space(struct resampler *resampler);
+int resampler_write(struct resampler *resampler, const int16_t *samples,
+		    int count);
+int resampler_samples_avail(struct resampler *resampler);
+int resampler_read_samples(struct resampler *resampler, int16_t *out,
+			   int count, int stereo);
+
+#endif				/* __RESAMPLER_H__ */
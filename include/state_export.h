@@ -0,0 +1,71 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#ifndef __STATE_EXPORT_H__
+#define __STATE_EXPORT_H__
+
+#include <stdint.h>
+
+/* Layout of the shared memory region created when state_export_name
+   is set.  The region starts with this header; each block of state
+   is found at the given offset from the start of the region.
+
+   The emulator updates the region once per frame.  'sequence' is odd
+   while an update is in progress, so a reader should:
+
+   1. read 'sequence' (acquire); retry if odd
+   2. copy or inspect whatever it needs
+   3. read 'sequence' again (acquire); retry if it changed
+
+   Pixels are palette indices (including emphasis bits) as produced by
+   the PPU, one uint32_t per pixel, 256x240.
+*/
+
+#define STATE_EXPORT_MAGIC   0x58454e43	/* "CNEX" */
+#define STATE_EXPORT_VERSION 1
+
+struct state_export_header {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t header_size;
+	uint32_t total_size;
+	uint32_t sequence;
+	uint32_t loaded;
+	uint64_t frame;
+	uint32_t ram_offset;
+	uint32_t ram_size;
+	uint32_t wram_offset;
+	uint32_t wram_size;
+	uint32_t oam_offset;
+	uint32_t oam_size;
+	uint32_t palette_offset;
+	uint32_t palette_size;
+	uint32_t pixel_offset;
+	uint32_t pixel_size;
+};
+
+#ifndef STATE_EXPORT_READER
+#include "emu.h"
+
+int state_export_init(struct emu *emu);
+void state_export_update(struct emu *emu);
+void state_export_cleanup(struct emu *emu);
+#endif
+
+#endif				/* __STATE_EXPORT_H__ */
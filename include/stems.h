@@ -0,0 +1,39 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#ifndef __STEMS_H__
+#define __STEMS_H__
+
+/* Writes each sound source to its own file while rendering.  The
+   pattern's "%s" is replaced by the source's name ("pulse1", "vrc7_3",
+   etc.); without one, the name is added before the extension.  Only
+   sources that make a sound get a file, but every file starts at the
+   beginning of the render so they line up. */
+
+struct stems;
+
+struct stems *stems_open(const char *pattern, int sample_rate);
+int stems_close(struct stems *stems);
+
+/* Output callbacks for audio_set_stem_output() and, for a "mix" file
+   alongside the stems, audio_set_render_output() */
+void stems_write(int stem, const int16_t *samples, int count, void *data);
+void stems_write_mix(const int16_t *samples, int count, void *data);
+
+#endif				/* __STEMS_H__ */
@@ -0,0 +1,37 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#ifndef __WAV_H__
+#define __WAV_H__
+
+#include <stdint.h>
+
+/* 16-bit mono sample output.  Files whose names end in ".wav" get a
+   WAV header (filled in by wav_close()); anything else is written as
+   raw little-endian PCM. */
+
+struct wav_file;
+
+struct wav_file *wav_open(const char *path, int sample_rate);
+int wav_write(struct wav_file *wav, const int16_t *samples, int count);
+int wav_write_silence(struct wav_file *wav, uint32_t count);
+uint32_t wav_sample_count(struct wav_file *wav);
+int wav_close(struct wav_file *wav);
+
+#endif				/* __WAV_H__ */
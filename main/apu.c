@@ -29,6 +29,12 @@
 
 #define FRAME_INTERRUPT_DISABLED 0x40
 
+/* Mixer lookup table sizes: pulse0 + pulse1 (0-30) and
+   3 * triangle + 2 * noise + dmc (0-202).
+*/
+#define PULSE_MIX_SIZE 31
+#define TND_MIX_SIZE   203
+
 #define sched_next_frame_step(y) (apu->next_frame_step += \
                                   apu->apu_clock_divider * (y))
 
@@ -77,6 +83,7 @@ struct pulse {
 	int amplitude;
 	int enabled;
 	uint32_t next_clock;
+	uint32_t next_change;	/* next clock that toggles the output */
 };
 
 struct triangle {
@@ -153,6 +160,14 @@ struct apu_state {
 	uint32_t frame_counter_register_timestamp;
 	int apu_clock_divider;
 	int pcm_write_count;
+	int synthesis;
+	int amplitude_dirty;
+
+	/* Only used when the volumes within each group are equal */
+	int pulse_mix_enabled;
+	int tnd_mix_enabled;
+	uint32_t pulse_mix[PULSE_MIX_SIZE];
+	uint32_t tnd_mix[TND_MIX_SIZE];
 
 	struct emu *emu;
 };
@@ -386,105 +401,137 @@ static void clock_sweeps(struct apu_state *apu)
 	clock_sweep(&apu->pulse[1].sweep);
 }
 
-static void pulse_update_volume(struct apu_state *apu, int c, uint32_t cycles)
+static inline int pulse_muted(struct pulse *pulse)
 {
-	struct pulse *pulse;
-	int volume;
-	int new_amplitude;
-	int duty;
 	int offset;
 
-	pulse = &apu->pulse[c];
-	volume = channel_volume(pulse);
 	offset = pulse->period >> pulse->sweep.shift;
 	if (pulse->sweep.negate_flag)
 		offset = 0;
 
-	new_amplitude = 0;
+	return (!channel_volume(pulse) || pulse->period < 8 ||
+		(pulse->period + offset) >= 0x800);
+}
 
-	duty = 1 << pulse->duty_cycle;
-	if (pulse->duty_cycle == 3) {
-		duty = 2;
-		new_amplitude = volume;
-	}
+static inline int pulse_duty(struct pulse *pulse)
+{
+	if (pulse->duty_cycle == 3)
+		return 2;
 
-	if (pulse->phase < duty)
-		new_amplitude ^= volume;
+	return 1 << pulse->duty_cycle;
+}
 
-	/* See if the channel has been muted */
-	if (!volume || pulse->period < 8 || (pulse->period + offset) >= 0x800) {
-		new_amplitude = 0;
+/* Apply every timer clock scheduled before 'limit'.  The output only
+   changes on the clocks that move the sequencer to phase 0 or to the
+   duty cycle boundary; apu_run() stops at those (next_change), so
+   every other clock can be applied in one step whenever the channel
+   state is needed.
+*/
+static void pulse_sync(struct apu_state *apu, int c, uint32_t limit)
+{
+	struct pulse *pulse;
+	uint32_t period;
+	uint32_t count;
+	int volume;
+	int duty;
+	int phase;
+
+	pulse = &apu->pulse[c];
+
+	if (pulse->next_clock >= limit)
+		return;
+
+	period = ((pulse->period << 1) + 2) * apu->apu_clock_divider;
+	count = (limit - pulse->next_clock + period - 1) / period;
+	pulse->next_clock += count * period;
+
+	if (pulse_muted(pulse) || !apu->synthesis) {
+		pulse->phase = (pulse->phase + count) % 8;
+		return;
 	}
 
-	if (new_amplitude != pulse->amplitude) {
-		pulse->amplitude = new_amplitude;
-		apu_update_amplitude(apu, cycles);
+	volume = channel_volume(pulse);
+	duty = pulse_duty(pulse);
+	phase = pulse->phase;
+
+	while (count--) {
+		phase = (phase + 1) % 8;
+		if (phase == 0 || phase == duty) {
+			int delta = pulse->amplitude ? volume : -volume;
+			pulse->amplitude -= delta;
+		}
 	}
+
+	pulse->phase = phase;
 }
 
-static inline void pulse_run(struct apu_state *apu, int c,
-			     uint32_t cycles) __attribute((always_inline));
-static inline void pulse_run(struct apu_state *apu, int c, uint32_t cycles)
+/* Find the timestamp of the next clock that changes the output, or
+   ~0 if the channel is silent.
+*/
+static void pulse_schedule(struct apu_state *apu, int c)
 {
 	struct pulse *pulse;
-	int timer_period;
-	int volume;
-	int offset = 0;
-	int delta;
+	uint32_t period;
+	int phase;
 	int duty;
-	int muted = 0;
-	uint32_t limit;
-
+	int steps;
 
 	pulse = &apu->pulse[c];
-	limit = apu->next_frame_step;
+	pulse->next_change = ~0;
 
-	if (limit > cycles)
-		limit = cycles;
+	if (!apu->synthesis || pulse_muted(pulse))
+		return;
 
-	timer_period = (pulse->period << 1) + 2;
-	volume = channel_volume(pulse);
-	offset = pulse->period >> pulse->sweep.shift;
-	if (pulse->sweep.negate_flag)
-		offset = 0;
+	period = ((pulse->period << 1) + 2) * apu->apu_clock_divider;
+	duty = pulse_duty(pulse);
+	phase = (pulse->phase + 1) % 8;
+	steps = 0;
 
-	if (!volume || pulse->period < 8 || (pulse->period + offset) >= 0x800) {
-		muted = 1;
+	while (phase != 0 && phase != duty) {
+		phase = (phase + 1) % 8;
+		steps++;
 	}
 
-	duty = 1 << pulse->duty_cycle;
-	if (pulse->duty_cycle == 3)
-		duty = 2;
+	pulse->next_change = pulse->next_clock + steps * period;
+}
 
-	delta = pulse->amplitude ? volume : -volume;
+static void pulse_update_volume(struct apu_state *apu, int c, uint32_t cycles)
+{
+	struct pulse *pulse;
+	int volume;
+	int new_amplitude;
+	int duty;
 
-	if (muted) {
-		int cycles_to_run;
-		int period;
-		int count;
+	pulse = &apu->pulse[c];
+	volume = channel_volume(pulse);
 
-		period = timer_period * apu->apu_clock_divider;
-		cycles_to_run = limit - pulse->next_clock;
+	new_amplitude = 0;
 
-		count = cycles_to_run / period;
-		if (cycles_to_run % period)
-			count++;
+	duty = pulse_duty(pulse);
+	if (pulse->duty_cycle == 3)
+		new_amplitude = volume;
 
-		pulse->phase = (pulse->phase + count) % 8;
-		pulse->next_clock += count * period;
+	if (pulse->phase < duty)
+		new_amplitude ^= volume;
 
-		return;
-	}
+	/* See if the channel has been muted */
+	if (pulse_muted(pulse))
+		new_amplitude = 0;
+
+	pulse_schedule(apu, c);
 
-	/* We need to clock the channel only once if it isn't silent.  But if
-	   it is, we can clock it until it is no longer silent (probably the
-	   next time the frame counter is clocked. */
-	pulse->phase = (pulse->phase + 1) % 8;
-	if (!muted && (pulse->phase == 0 || pulse->phase == duty)) {
-		delta = -delta;
-		pulse->amplitude += delta;
+	if (new_amplitude != pulse->amplitude) {
+		pulse->amplitude = new_amplitude;
+		apu_update_amplitude(apu, cycles);
 	}
-	pulse->next_clock += timer_period * apu->apu_clock_divider;
+}
+
+static inline void pulse_run(struct apu_state *apu, int c,
+			     uint32_t time) __attribute((always_inline));
+static inline void pulse_run(struct apu_state *apu, int c, uint32_t time)
+{
+	pulse_sync(apu, c, time + 1);
+	pulse_schedule(apu, c);
 }
 
 static inline void triangle_run(struct apu_state *apu,
@@ -643,6 +690,7 @@ static CPU_WRITE_HANDLER(pulse_write_handler)
 
 	c = (addr >= 0x4004) ? 1 : 0;
 	pulse = &apu->pulse[c];
+	pulse_sync(apu, c, cycles);
 
 //      printf("called from %x, wrote %x\n", cpu_get_pc(), value);
 
@@ -998,8 +1046,10 @@ int apu_init(struct emu *emu)
 	if (!apu)
 		return 0;
 
+	memset(apu, 0, sizeof(*apu));
 	apu->emu = emu;
 	emu->apu = apu;
+	apu->synthesis = 1;
 
 	for (i = 0; i < 4; i++) {
 		cpu_set_write_handler(apu->emu->cpu, 0x4000 + i, 1, 0,
@@ -1071,6 +1121,9 @@ void apu_reset(struct apu_state *apu, int hard)
 		apu->dmc_irq_flag = 0;
 
 		apu->last_amplitude = 0.0;
+		apu->amplitude_dirty = 1;
+		pulse_schedule(apu, 0);
+		pulse_schedule(apu, 1);
 		frame_counter_write_handler(apu->emu, 0x4017,
 					    apu->frame_counter_mode,
 					    cpu_get_cycles(apu->emu->cpu) +
@@ -1163,6 +1216,10 @@ void apu_reset(struct apu_state *apu, int hard)
 	apu->noise.length.halt = 0;
 
 	apu->noise.shift = 1;
+
+	apu->amplitude_dirty = 1;
+	pulse_schedule(apu, 0);
+	pulse_schedule(apu, 1);
 }
 
 static void set_frame_irq_flag(struct emu *emu)
@@ -1179,9 +1236,22 @@ static void set_frame_irq_flag(struct emu *emu)
 
 void apu_end_frame(struct apu_state *apu, uint32_t cycles)
 {
+	int i;
+
 	apu->pcm_write_count = 0;
-	apu->pulse[0].next_clock -= cycles;
-	apu->pulse[1].next_clock -= cycles;
+
+	for (i = 0; i < 2; i++) {
+		pulse_sync(apu, i, cycles);
+		apu->pulse[i].next_clock -= cycles;
+		if (apu->pulse[i].next_change != ~0)
+			apu->pulse[i].next_change -= cycles;
+	}
+
+	if (!apu->synthesis) {
+		apu->triangle.next_clock = cycles;
+		apu->noise.next_clock = cycles;
+	}
+
 	apu->triangle.next_clock -= cycles;
 	apu->noise.next_clock -= cycles;
 	apu->dmc.next_clock -= cycles;
@@ -1206,6 +1276,10 @@ static void clock_frame_counter(struct apu_state *apu)
 	do_quarter_frame = 0;
 	do_half_frame = 0;
 
+	/* Envelopes, length counters and sweeps may change below */
+	pulse_sync(apu, 0, cycles);
+	pulse_sync(apu, 1, cycles);
+
 	if (cycles == apu->frame_counter_register_timestamp) {
 		apu->frame_counter_mode = apu->frame_counter_register;
 		apu->frame_counter_register_timestamp = ~0;
@@ -1314,59 +1388,149 @@ static void clock_frame_counter(struct apu_state *apu)
 	pulse_update_volume(apu, 1, cycles);
 	noise_update_volume(apu, cycles);
 }
+
+static uint32_t pulse_mix(uint32_t pulse_tmp)
+{
+	if (!pulse_tmp)
+		return 0;
+
+	return (65536) * 9552 / (100 * 812800 / pulse_tmp + 10000);
+}
+
+static uint32_t tnd_mix(uint32_t tnd_tmp)
+{
+	if (!tnd_tmp)
+		return 0;
+
+	return (65536) * 16367  / (100 * 2432900 / tnd_tmp + 10000);
+}
+
+/* Precompute the nonlinear mixer output for every possible channel
+   sum.  A table can only stand in for the formula when all channels
+   in the group share a volume, since otherwise the weighted sum isn't
+   a function of the raw sum; mixed volumes use the formula directly.
+*/
+static void apu_build_mix_tables(struct apu_state *apu)
+{
+	struct config *config;
+	int i;
+
+	config = apu->emu->config;
+
+	apu->pulse_mix_enabled =
+		(config->apu_pulse0_volume == config->apu_pulse1_volume);
+
+	apu->tnd_mix_enabled =
+		(config->apu_triangle_volume == config->apu_noise_volume) &&
+		(config->apu_triangle_volume == config->apu_dmc_volume);
+
+	for (i = 0; i < PULSE_MIX_SIZE; i++)
+		apu->pulse_mix[i] = pulse_mix(i * config->apu_pulse0_volume);
+
+	for (i = 0; i < TND_MIX_SIZE; i++)
+		apu->tnd_mix[i] = tnd_mix(i * config->apu_triangle_volume);
+}
+
+/* Each channel as it would sound with the others silent */
+static void apu_update_stems(struct apu_state *apu, uint32_t cycles)
+{
+	struct audio_state *audio;
+	struct config *config;
+
+	audio = apu->emu->audio;
+	config = apu->emu->config;
+
+	audio_set_stem(audio, AUDIO_STEM_PULSE0, cycles,
+		       pulse_mix(apu->pulse[0].amplitude *
+				 config->apu_pulse0_volume));
+	audio_set_stem(audio, AUDIO_STEM_PULSE1, cycles,
+		       pulse_mix(apu->pulse[1].amplitude *
+				 config->apu_pulse1_volume));
+	audio_set_stem(audio, AUDIO_STEM_TRIANGLE, cycles,
+		       tnd_mix(3 * apu->triangle.amplitude *
+			       config->apu_triangle_volume));
+	audio_set_stem(audio, AUDIO_STEM_NOISE, cycles,
+		       tnd_mix(2 * apu->noise.amplitude *
+			       config->apu_noise_volume));
+	audio_set_stem(audio, AUDIO_STEM_DMC, cycles,
+		       tnd_mix(apu->dmc.amplitude * config->apu_dmc_volume));
+}
+
 static void apu_update_amplitude(struct apu_state *apu, uint32_t cycles)
 {
 	uint32_t pulse_out, tnd_out;
 	int delta;
 	uint32_t pulse_tmp, tnd_tmp;
+	unsigned int index;
 	uint32_t out;
 	struct config *config;
 
-	config = apu->emu->config;
-
-	pulse_tmp  = apu->pulse[0].amplitude * config->apu_pulse0_volume;
-	pulse_tmp += apu->pulse[1].amplitude * config->apu_pulse1_volume;
+	if (!apu->synthesis)
+		return;
 
-	tnd_tmp  = 3 * apu->triangle.amplitude * config->apu_triangle_volume;
-	tnd_tmp += 2 * apu->noise.amplitude * config->apu_noise_volume;
-	tnd_tmp +=     apu->dmc.amplitude * config->apu_dmc_volume;
+	apu->amplitude_dirty = 0;
+	config = apu->emu->config;
 
-	if (pulse_tmp)
-		pulse_out = (65536) * 9552 / (100 * 812800 / pulse_tmp + 10000);
-	else
-		pulse_out = 0;
+	index = apu->pulse[0].amplitude + apu->pulse[1].amplitude;
+	if (apu->pulse_mix_enabled && index < PULSE_MIX_SIZE) {
+		pulse_out = apu->pulse_mix[index];
+	} else {
+		pulse_tmp  = apu->pulse[0].amplitude *
+			config->apu_pulse0_volume;
+		pulse_tmp += apu->pulse[1].amplitude *
+			config->apu_pulse1_volume;
+		pulse_out = pulse_mix(pulse_tmp);
+	}
 
-	if (tnd_tmp)
-		tnd_out = (65536) * 16367  / (100 * 2432900 / tnd_tmp + 10000);
-	else
-		tnd_out = 0;
+	index = 3 * apu->triangle.amplitude + 2 * apu->noise.amplitude +
+		apu->dmc.amplitude;
+	if (apu->tnd_mix_enabled && index < TND_MIX_SIZE) {
+		tnd_out = apu->tnd_mix[index];
+	} else {
+		tnd_tmp  = 3 * apu->triangle.amplitude *
+			config->apu_triangle_volume;
+		tnd_tmp += 2 * apu->noise.amplitude *
+			config->apu_noise_volume;
+		tnd_tmp +=     apu->dmc.amplitude * config->apu_dmc_volume;
+		tnd_out = tnd_mix(tnd_tmp);
+	}
 
 	out = pulse_out + tnd_out;
 
 	delta = out - apu->last_amplitude;
 	if (delta) {
-		audio_add_delta(apu->emu->audio, cycles, delta);
+		audio_add_delta(apu->emu->audio, AUDIO_CHIP_APU, cycles, delta);
 		apu->last_amplitude = out;
 	}
 
+	if (apu->emu->audio_stems)
+		apu_update_stems(apu, cycles);
 }
 
 void apu_run(struct apu_state *apu, uint32_t cycles)
 {
 	while (!apu->emu->overclocking) {
 		uint32_t time = -1;
+		int amplitude;
 //              uint32_t time = apu->next_frame_step;
 		/* if (time > cycles) */
 		/*      time = cycles; */
 
-		if (apu->pulse[0].next_clock < time)
-			time = apu->pulse[0].next_clock;
-		if (apu->pulse[1].next_clock < time)
-			time = apu->pulse[1].next_clock;
-		if (apu->triangle.next_clock < time)
-			time = apu->triangle.next_clock;
-		if (apu->noise.next_clock < time)
-			time = apu->noise.next_clock;
+		/* Pulse channels only need attention when their output
+		   changes; the clocks in between are applied lazily by
+		   pulse_sync().  Without synthesis the triangle and noise
+		   timers have no observable effect and aren't run at all.
+		*/
+		if (apu->pulse[0].next_change < time)
+			time = apu->pulse[0].next_change;
+		if (apu->pulse[1].next_change < time)
+			time = apu->pulse[1].next_change;
+		if (apu->synthesis) {
+			if (apu->triangle.next_clock < time)
+				time = apu->triangle.next_clock;
+			if (apu->noise.next_clock < time)
+				time = apu->noise.next_clock;
+		}
 		if (apu->dmc.next_clock < time)
 			time = apu->dmc.next_clock;
 		if (apu->next_frame_step < time)
@@ -1393,18 +1557,35 @@ void apu_run(struct apu_state *apu, uint32_t cycles)
 
 		if (time == apu->next_frame_step)
 			clock_frame_counter(apu);
-		if (apu->pulse[0].next_clock <= time)
-			pulse_run(apu, 0, cycles);
-		if (apu->pulse[1].next_clock <= time)
-			pulse_run(apu, 1, cycles);
-		if (apu->triangle.next_clock <= time)
+
+		amplitude = apu->amplitude_dirty;
+
+		if (apu->pulse[0].next_change <= time) {
+			pulse_run(apu, 0, time);
+			amplitude = 1;
+		}
+		if (apu->pulse[1].next_change <= time) {
+			pulse_run(apu, 1, time);
+			amplitude = 1;
+		}
+		if (apu->synthesis && apu->triangle.next_clock <= time) {
+			int old = apu->triangle.amplitude;
 			triangle_run(apu, cycles);
-		if (apu->noise.next_clock <= time)
+			amplitude |= (old != apu->triangle.amplitude);
+		}
+		if (apu->synthesis && apu->noise.next_clock <= time) {
+			int old = apu->noise.amplitude;
 			noise_run(apu, cycles);
-		if (apu->dmc.next_clock <= time)
+			amplitude |= (old != apu->noise.amplitude);
+		}
+		if (apu->dmc.next_clock <= time) {
+			int old = apu->dmc.amplitude;
 			dmc_run(apu, time);
+			amplitude |= (old != apu->dmc.amplitude);
+		}
 
-		apu_update_amplitude(apu, time);
+		if (amplitude)
+			apu_update_amplitude(apu, time);
 
 	}
 
@@ -1536,6 +1717,20 @@ int apu_apply_config(struct apu_state *apu)
 		apu->raw_pcm_filter = 2;
 	}
 
+	apu_build_mix_tables(apu);
+	apu->amplitude_dirty = 1;
+
+	if (apu->synthesis != apu->emu->config->apu_synthesis_enabled) {
+		apu->synthesis = apu->emu->config->apu_synthesis_enabled;
+		apu->amplitude_dirty = 1;
+		if (apu->synthesis) {
+			apu->triangle.next_clock = apu->last_time;
+			apu->noise.next_clock = apu->last_time;
+		}
+		pulse_schedule(apu, 0);
+		pulse_schedule(apu, 1);
+	}
+
 	return 0;
 }
 
@@ -1658,6 +1853,10 @@ int apu_load_state(struct apu_state *apu, struct save_state *state)
 
 	buf += unpack_state(&apu->dmc, dmc_state_items, buf);
 
+	apu->amplitude_dirty = 1;
+	pulse_schedule(apu, 0);
+	pulse_schedule(apu, 1);
+
 	return 0;
 }
 
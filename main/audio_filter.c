@@ -0,0 +1,121 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <math.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "audio_filter.h"
+
+/* Fractional bits kept in the filter state.  With fewer, rounding
+   error in the 37 Hz high-pass (which is divided by roughly 1 - a,
+   a couple of hundred at 48 kHz) leaves a small DC offset of its own.
+*/
+#define AUDIO_FILTER_STATE_BITS 12
+
+static void add_stage(struct audio_filter *filter, int highpass,
+		      double cutoff, double sample_rate)
+{
+	struct audio_filter_stage *stage;
+	double pole;
+
+	/* Matched to the RC filter's analog pole */
+	pole = exp(-2 * M_PI * cutoff / sample_rate);
+
+	stage = &filter->stages[filter->stage_count++];
+	stage->coeff = (int32_t)((highpass ? pole : 1 - pole) * 65536 + 0.5);
+	stage->highpass = highpass;
+	stage->prev_in = 0;
+	stage->out = 0;
+}
+
+void audio_filter_init(struct audio_filter *filter,
+		       enum audio_filter_type type, double sample_rate)
+{
+	memset(filter, 0, sizeof(*filter));
+
+	/* A low-pass at or above Nyquist would just be a delay */
+	switch (type) {
+	case AUDIO_FILTER_NES:
+		add_stage(filter, 1, 90, sample_rate);
+		add_stage(filter, 1, 440, sample_rate);
+		if (sample_rate > 28000)
+			add_stage(filter, 0, 14000, sample_rate);
+		break;
+	case AUDIO_FILTER_FAMICOM:
+		add_stage(filter, 1, 37, sample_rate);
+		if (sample_rate > 28000)
+			add_stage(filter, 0, 14000, sample_rate);
+		break;
+	default:
+		break;
+	}
+}
+
+/* Each stage's output feeds back into the next sample, so there's
+   nothing to vectorize across samples; the whole chain is a handful
+   of integer multiply-adds per sample. */
+void audio_filter_run(struct audio_filter *filter, int16_t *samples,
+		      int count, int stereo)
+{
+	struct audio_filter_stage *stage;
+	int step;
+	int32_t x;
+	int i, s;
+
+	if (!filter->stage_count)
+		return;
+
+	step = stereo ? 2 : 1;
+
+	for (i = 0; i < count; i++) {
+		x = (int32_t)samples[i * step] << AUDIO_FILTER_STATE_BITS;
+
+		for (s = 0; s < filter->stage_count; s++) {
+			int64_t acc;
+
+			stage = &filter->stages[s];
+			if (stage->highpass) {
+				/* y = a * (y + x - x_prev) */
+				acc = (int64_t)stage->coeff *
+					((int64_t)stage->out + x - stage->prev_in);
+				stage->prev_in = x;
+			} else {
+				/* y = y + b * (x - y) */
+				acc = ((int64_t)stage->out << 16) +
+					(int64_t)stage->coeff *
+					((int64_t)x - stage->out);
+			}
+
+			stage->out = (int32_t)((acc + 0x8000) >> 16);
+			x = stage->out;
+		}
+
+		x = (x + (1 << (AUDIO_FILTER_STATE_BITS - 1))) >>
+			AUDIO_FILTER_STATE_BITS;
+		if (x > 32767)
+			x = 32767;
+		else if (x < -32768)
+			x = -32768;
+
+		samples[i * step] = x;
+		if (stereo)
+			samples[i * step + 1] = x;
+	}
+}
@@ -25,6 +25,27 @@ extern FILE *outfile;
 	#include "blargg_test.h"
 #endif
 
+/* SSE2/AVX2 versions of delta insertion and sample output, selected at
+runtime. Both produce exactly the same results as the scalar code. */
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__)) && \
+	!defined (BLIP_NO_SIMD)
+	#define BLIP_SIMD 1
+	#include <immintrin.h>
+#else
+	#define BLIP_SIMD 0
+#endif
+
+#if defined (__GNUC__)
+	#define BLIP_ALWAYS_INLINE static inline __attribute__((always_inline))
+#else
+	#define BLIP_ALWAYS_INLINE static inline
+#endif
+
+enum { simd_none = 0, simd_sse2 = 1, simd_avx2 = 2 };
+static int simd_level = -1;
+
+static void init_simd( void );
+
 /* Equivalent to ULONG_MAX >= 0xFFFFFFFF00000000.
 Avoids constants that don't fit in 32 bits. */
 #if ULONG_MAX/0xFFFFFFFF > 0xFFFFFFFF
@@ -55,6 +76,7 @@ enum { phase_count = 1 << phase_bits };
 enum { delta_bits  = 15 };
 enum { delta_unit  = 1 << delta_bits };
 enum { frac_bits = time_bits - pre_shift };
+enum { gain_bits = 16 };
 
 /* We could eliminate avail and encode whole samples in offset, but that would
 limit the total buffered samples to blip_max_frame. That could only be
@@ -107,6 +129,7 @@ static void check_assumptions( void )
 	assert( n == min_sample );
 	
 	assert( blip_max_ratio <= time_unit );
+	assert( blip_unity_gain == 1 << gain_bits );
 	assert( blip_max_frame <= (fixed_t) -1 >> time_bits );
 }
 
@@ -124,6 +147,8 @@ blip_t* blip_new( int size )
 			m->size   = size;
 			blip_clear( m );
 			check_assumptions();
+			if ( simd_level < 0 )
+				init_simd();
 		} else {
 			free(m);
 			m = NULL;
@@ -212,6 +237,85 @@ static void remove_samples( blip_t* m, int count )
 	memset( &buf [remain], 0, count * sizeof buf [0] );
 }
 
+#if BLIP_SIMD
+
+enum { read_chunk = 256 };
+
+/* Packs count already-clamped samples to shorts, duplicating each one
+for stereo output */
+__attribute__((target("sse2")))
+static void store_samples_sse2( short out [], int const in [], int count, int stereo )
+{
+	int i;
+	
+	for ( i = 0; i + 8 <= count; i += 8 )
+	{
+		__m128i s = _mm_packs_epi32( _mm_load_si128( (__m128i const*) (in + i) ),
+				_mm_load_si128( (__m128i const*) (in + i + 4) ) );
+		
+		if ( stereo )
+		{
+			_mm_storeu_si128( (__m128i*) (out + i * 2), _mm_unpacklo_epi16( s, s ) );
+			_mm_storeu_si128( (__m128i*) (out + i * 2 + 8), _mm_unpackhi_epi16( s, s ) );
+		}
+		else
+		{
+			_mm_storeu_si128( (__m128i*) (out + i), s );
+		}
+	}
+	
+	for ( ; i < count; i++ )
+	{
+		if ( stereo )
+		{
+			out [i * 2]     = in [i];
+			out [i * 2 + 1] = in [i];
+		}
+		else
+		{
+			out [i] = in [i];
+		}
+	}
+}
+
+/* The integrator and high-pass filter form a serial dependency chain (each
+output feeds back into the sum), so only the conversion and interleaving
+of the results is done in vector registers. */
+static int read_samples_simd( blip_t* m, short out [], int count, int stereo )
+{
+	int tmp [read_chunk] __attribute__((aligned(16)));
+	buf_t const* in = m->samples;
+	int sum = m->integrator;
+	int remain = count;
+	
+	while ( remain )
+	{
+		int n = remain < read_chunk ? remain : read_chunk;
+		int i;
+		
+		for ( i = 0; i < n; i++ )
+		{
+			int s = ARITH_SHIFT( sum, delta_bits );
+			sum += in [i];
+			CLAMP( s );
+			tmp [i] = s;
+			sum -= s << (delta_bits - bass_shift);
+		}
+		
+		store_samples_sse2( out, tmp, n, stereo );
+		out += stereo ? n * 2 : n;
+		in += n;
+		remain -= n;
+	}
+	m->integrator = sum;
+	
+	remove_samples( m, count );
+	
+	return count;
+}
+
+#endif
+
 int blip_read_samples( blip_t* m, short out [], int count, int stereo )
 {
 	assert( count >= 0 );
@@ -219,6 +323,11 @@ int blip_read_samples( blip_t* m, short out [], int count, int stereo )
 	if ( count > m->avail )
 		count = m->avail;
 	
+	#if BLIP_SIMD
+	if ( count && simd_level > simd_none )
+		return read_samples_simd( m, out, count, stereo );
+	#endif
+	
 	if ( count )
 	{
 		buf_t const* in  = m->samples;
@@ -298,27 +407,127 @@ static short const bl_step [phase_count + 1] [half_width] =
 {    0,   43, -115,  350, -488, 1136, -914, 5861}
 };
 
+#if BLIP_SIMD
+
+/* bl_step rearranged so that all 16 output taps for a phase are
+contiguous: out [i] += kernel [phase] [0] [i] * delta +
+kernel [phase] [1] [i] * delta2, matching blip_add_delta(). */
+static int kernel [phase_count] [2] [half_width * 2] __attribute__((aligned(32)));
+
+static void init_kernel( void )
+{
+	int phase, i;
+	
+	for ( phase = 0; phase < phase_count; phase++ )
+	{
+		for ( i = 0; i < half_width; i++ )
+		{
+			kernel [phase] [0] [i] = bl_step [phase] [i];
+			kernel [phase] [1] [i] = bl_step [phase + 1] [i];
+			kernel [phase] [0] [half_width + i] =
+				bl_step [phase_count - phase] [half_width - 1 - i];
+			kernel [phase] [1] [half_width + i] =
+				bl_step [phase_count - phase - 1] [half_width - 1 - i];
+		}
+	}
+}
+
+/* Low 32 bits of a 32x32 multiply by a broadcast value, without SSE4.1 */
+__attribute__((target("sse2")))
+static inline __m128i mullo_sse2( __m128i a, __m128i b )
+{
+	__m128i even = _mm_mul_epu32( a, b );
+	__m128i odd  = _mm_mul_epu32( _mm_srli_epi64( a, 32 ), b );
+	return _mm_unpacklo_epi32( _mm_shuffle_epi32( even, _MM_SHUFFLE( 0, 0, 2, 0 ) ),
+			_mm_shuffle_epi32( odd, _MM_SHUFFLE( 0, 0, 2, 0 ) ) );
+}
+
+__attribute__((target("sse2")))
+static void add_delta_sse2( buf_t* out, int phase, int delta, int delta2 )
+{
+	int const* k1 = kernel [phase] [0];
+	int const* k2 = kernel [phase] [1];
+	__m128i d1 = _mm_set1_epi32( delta );
+	__m128i d2 = _mm_set1_epi32( delta2 );
+	int i;
+	
+	for ( i = 0; i < half_width * 2; i += 4 )
+	{
+		__m128i o = _mm_loadu_si128( (__m128i*) (out + i) );
+		__m128i a = mullo_sse2( _mm_load_si128( (__m128i const*) (k1 + i) ), d1 );
+		__m128i b = mullo_sse2( _mm_load_si128( (__m128i const*) (k2 + i) ), d2 );
+		o = _mm_add_epi32( o, _mm_add_epi32( a, b ) );
+		_mm_storeu_si128( (__m128i*) (out + i), o );
+	}
+}
+
+__attribute__((target("avx2")))
+static void add_delta_avx2( buf_t* out, int phase, int delta, int delta2 )
+{
+	int const* k1 = kernel [phase] [0];
+	int const* k2 = kernel [phase] [1];
+	__m256i d1 = _mm256_set1_epi32( delta );
+	__m256i d2 = _mm256_set1_epi32( delta2 );
+	__m256i lo = _mm256_loadu_si256( (__m256i*) out );
+	__m256i hi = _mm256_loadu_si256( (__m256i*) (out + 8) );
+	
+	lo = _mm256_add_epi32( lo, _mm256_add_epi32(
+			_mm256_mullo_epi32( _mm256_load_si256( (__m256i const*) k1 ), d1 ),
+			_mm256_mullo_epi32( _mm256_load_si256( (__m256i const*) k2 ), d2 ) ) );
+	hi = _mm256_add_epi32( hi, _mm256_add_epi32(
+			_mm256_mullo_epi32( _mm256_load_si256( (__m256i const*) (k1 + 8) ), d1 ),
+			_mm256_mullo_epi32( _mm256_load_si256( (__m256i const*) (k2 + 8) ), d2 ) ) );
+	
+	_mm256_storeu_si256( (__m256i*) out, lo );
+	_mm256_storeu_si256( (__m256i*) (out + 8), hi );
+}
+
+static void init_simd( void )
+{
+	init_kernel();
+	
+	__builtin_cpu_init();
+	if ( __builtin_cpu_supports( "avx2" ) )
+		simd_level = simd_avx2;
+	else if ( __builtin_cpu_supports( "sse2" ) )
+		simd_level = simd_sse2;
+	else
+		simd_level = simd_none;
+}
+
+#else
+
+static void init_simd( void )
+{
+	simd_level = simd_none;
+}
+
+#endif
+
 /* Shifting by pre_shift allows calculation using unsigned int rather than
 possibly-wider fixed_t. On 32-bit platforms, this is likely more efficient.
 And by having pre_shift 32, a 32-bit platform can easily do the shift by
 simply ignoring the low half. */
 
-void blip_add_delta( blip_t* m, unsigned time, int delta )
+/* Finds where a delta at fixed (time * factor + offset, shifted down by
+pre_shift) goes, and splits it between the two kernel phases around it. */
+static inline buf_t* delta_position( buf_t* base, unsigned fixed, int* phase,
+		int* delta, int* delta2 )
 {
-	unsigned fixed = (unsigned) ((time * m->factor + m->offset) >> pre_shift);
-	buf_t* out = m->samples + m->avail + (fixed >> frac_bits);
-	
 	int const phase_shift = frac_bits - phase_bits;
-	int phase = fixed >> phase_shift & (phase_count - 1);
-	short const* in  = bl_step [phase];
-	short const* rev = bl_step [phase_count - phase];
-
 	int interp = fixed >> (phase_shift - delta_bits) & (delta_unit - 1);
-	int delta2 = (delta * interp) >> delta_bits;
-	delta -= delta2;
+	
+	*phase  = fixed >> phase_shift & (phase_count - 1);
+	*delta2 = (*delta * interp) >> delta_bits;
+	*delta -= *delta2;
+	
+	return base + (fixed >> frac_bits);
+}
 
-	/* Fails if buffer size was exceeded */
-	assert( out <= &m->samples[m->size + end_frame_extra] );
+static inline void add_delta_scalar( buf_t* out, int phase, int delta, int delta2 )
+{
+	short const* in  = bl_step [phase];
+	short const* rev = bl_step [phase_count - phase];
 	
 	out [0] += in[0]*delta + in[half_width+0]*delta2;
 	out [1] += in[1]*delta + in[half_width+1]*delta2;
@@ -340,6 +549,110 @@ void blip_add_delta( blip_t* m, unsigned time, int delta )
 	out [15] += in[0]*delta + in[0-half_width]*delta2;
 }
 
+void blip_add_delta( blip_t* m, unsigned time, int delta )
+{
+	unsigned fixed = (unsigned) ((time * m->factor + m->offset) >> pre_shift);
+	int phase, delta2;
+	buf_t* out = delta_position( m->samples + m->avail, fixed, &phase,
+			&delta, &delta2 );
+
+	/* Fails if buffer size was exceeded */
+	assert( out <= &m->samples[m->size + end_frame_extra] );
+	
+	#if BLIP_SIMD
+	if ( simd_level == simd_avx2 )
+	{
+		add_delta_avx2( out, phase, delta, delta2 );
+		return;
+	}
+	else if ( simd_level == simd_sse2 )
+	{
+		add_delta_sse2( out, phase, delta, delta2 );
+		return;
+	}
+	#endif
+	
+	add_delta_scalar( out, phase, delta, delta2 );
+}
+
+/* Loop for blip_add_deltas(). The buffer position, rate and kernel choice
+are fixed for the whole batch, so they're loaded once; each copy below is
+built for one kernel so that the kernel is inlined into the loop. */
+BLIP_ALWAYS_INLINE void add_deltas( blip_t* m,
+		unsigned const times [], int const deltas [], int count, int gain,
+		int level )
+{
+	fixed_t const factor = m->factor;
+	fixed_t const offset = m->offset;
+	buf_t* const base = m->samples + m->avail;
+	buf_t const* const end = &m->samples [m->size + end_frame_extra];
+	int i;
+	
+	for ( i = 0; i < count; i++ )
+	{
+		unsigned fixed = (unsigned) ((times [i] * factor + offset) >> pre_shift);
+		int delta = deltas [i];
+		int phase, delta2;
+		buf_t* out;
+		
+		if ( gain != blip_unity_gain )
+			delta = (int) (((long long) delta * gain) >> gain_bits);
+		
+		out = delta_position( base, fixed, &phase, &delta, &delta2 );
+		
+		/* Fails if buffer size was exceeded */
+		assert( out <= end );
+		
+		#if BLIP_SIMD
+		if ( level == simd_avx2 )
+			add_delta_avx2( out, phase, delta, delta2 );
+		else if ( level == simd_sse2 )
+			add_delta_sse2( out, phase, delta, delta2 );
+		else
+		#endif
+			add_delta_scalar( out, phase, delta, delta2 );
+	}
+}
+
+#if BLIP_SIMD
+
+__attribute__((target("avx2")))
+static void add_deltas_avx2( blip_t* m, unsigned const times [],
+		int const deltas [], int count, int gain )
+{
+	add_deltas( m, times, deltas, count, gain, simd_avx2 );
+}
+
+__attribute__((target("sse2")))
+static void add_deltas_sse2( blip_t* m, unsigned const times [],
+		int const deltas [], int count, int gain )
+{
+	add_deltas( m, times, deltas, count, gain, simd_sse2 );
+}
+
+#endif
+
+void blip_add_deltas( blip_t* m, unsigned const times [], int const deltas [],
+		int count, int gain )
+{
+	assert( count >= 0 );
+	
+	#if BLIP_SIMD
+	if ( simd_level == simd_avx2 )
+	{
+		add_deltas_avx2( m, times, deltas, count, gain );
+		return;
+	}
+	else if ( simd_level == simd_sse2 )
+	{
+		add_deltas_sse2( m, times, deltas, count, gain );
+		return;
+	}
+	#endif
+	
+	add_deltas( m, times, deltas, count, gain, simd_none );
+}
+
 void blip_add_delta_fast( blip_t* m, unsigned time, int delta )
 {
 	unsigned fixed = (unsigned) ((time * m->factor + m->offset) >> pre_shift);
@@ -31,6 +31,7 @@
 #include "file_io.h"
 #include "patch.h"
 #include "m2_timer.h"
+#include "exp_audio.h"
 #include "fds.h"
 
 struct board_name_mapping {
@@ -1276,6 +1277,97 @@ static int board_memmap_nvram(struct board *board, size_t size,
 
 #endif
 
+/* Battery-backed RAM that isn't memory mapped would otherwise only be
+   saved when the ROM is unloaded, so a crash loses everything since.
+   Keep a copy of what is on disk and write the RAM back from the file
+   writer thread whenever it differs.  Boards with a pre-save hook are
+   skipped, as that hook may only run once, just before unloading. */
+static void board_init_nvram_writeback(struct board *board,
+				       const char *file)
+{
+	int interval;
+
+	interval = board->emu->config->nvram_writeback_interval;
+	if (!interval || !board->nv_ram_size)
+		return;
+
+	if (board->info->funcs && board->info->funcs->nvram_pre_save)
+		return;
+
+	board->nv_ram_save_path = strdup(file);
+	board->nv_ram_shadow = malloc(board->nv_ram_size);
+	if (!board->nv_ram_save_path || !board->nv_ram_shadow) {
+		free(board->nv_ram_save_path);
+		free(board->nv_ram_shadow);
+		board->nv_ram_save_path = NULL;
+		board->nv_ram_shadow = NULL;
+		return;
+	}
+
+	memcpy(board->nv_ram_shadow, board->nv_ram_data, board->nv_ram_size);
+	board->nv_ram_writeback_interval = interval * board->emu->nes_framerate;
+	board->nv_ram_writeback_frames = 0;
+}
+
+static void board_nvram_writeback(struct board *board)
+{
+	uint8_t *data, *shadow;
+	size_t size, start, end;
+
+	if (!board->nv_ram_shadow)
+		return;
+
+	board->nv_ram_writeback_frames++;
+	if (board->nv_ram_writeback_frames < board->nv_ram_writeback_interval)
+		return;
+
+	board->nv_ram_writeback_frames = 0;
+
+	/* Battery-backed chip RAM (Namco 163 wave RAM) may still be
+	   written by the expansion audio worker, and this frame's
+	   writes may only be in its log. */
+	exp_audio_sync(board->emu);
+
+	data = board->nv_ram_data;
+	shadow = board->nv_ram_shadow;
+	size = board->nv_ram_size;
+
+	for (start = 0; start < size; start++) {
+		if (data[start] != shadow[start])
+			break;
+	}
+
+	if (start == size)
+		return;
+
+	for (end = size; end > start; end--) {
+		if (data[end - 1] != shadow[end - 1])
+			break;
+	}
+
+	memcpy(shadow + start, data + start, end - start);
+
+	log_dbg("nvram: $%zx-$%zx changed, writing \"%s\"\n",
+		start, end - 1, board->nv_ram_save_path);
+
+	if (writefile_async(board->nv_ram_save_path, shadow, size)) {
+		log_err("failed to write file \"%s\"\n",
+			board->nv_ram_save_path);
+	}
+}
+
+static void board_cleanup_nvram_writeback(struct board *board)
+{
+	if (!board->nv_ram_shadow)
+		return;
+
+	writefile_async_stop();
+	free(board->nv_ram_shadow);
+	free(board->nv_ram_save_path);
+	board->nv_ram_shadow = NULL;
+	board->nv_ram_save_path = NULL;
+}
+
 static int board_init_nvram(struct board *board, size_t size)
 {
 	char *save_file, *romdir_save_file, *file;
@@ -1337,6 +1429,8 @@ static int board_init_nvram(struct board *board, size_t size)
 	}
 	board->save_file_size = 0;
 
+	board_init_nvram_writeback(board, file);
+
 	rc = 0;
 
 cleanup:
@@ -1555,6 +1649,9 @@ static void board_cleanup_nvram(struct board *board)
 	if (!board->nv_ram_data)
 		return;
 
+	/* Let any periodic write finish before the final one */
+	board_cleanup_nvram_writeback(board);
+
 	/* If the board defines a pre-save hook, that hook needs to
 	   make sure that nv_ram_data points to valid data as it
 	   should appear on disk, with save_file_size set
@@ -1609,8 +1706,8 @@ static void board_cleanup_nvram(struct board *board)
 	/* printf("file: %s size: %zu data: %p\n", */
 	/*        file, board->save_file_size, board->nv_ram_data); */
 
-	if (writefile(file, board->nv_ram_data,
-		      board->save_file_size)) {
+	if (writefile_atomic(file, board->nv_ram_data,
+			     board->save_file_size)) {
 		log_err("failed to write file \"%s\"\n",
 			file);
 	}
@@ -2193,6 +2290,24 @@ void board_cleanup(struct board *board)
 		free(buffer);
 	}
 
+	if (board->sync_stats_frames) {
+		struct board_sync_stats *stats;
+		double frames;
+
+		stats = &board->total_sync_stats;
+		frames = board->sync_stats_frames;
+
+		log_dbg("Board: %u PRG syncs wrote %u page table entries "
+			"(%.1f per frame)\n", stats->prg_syncs,
+			stats->prg_pages, stats->prg_pages / frames);
+		log_dbg("Board: %u CHR syncs wrote %u pattern table pages "
+			"(%.1f per frame)\n", stats->chr_syncs,
+			stats->chr_pages, stats->chr_pages / frames);
+		log_dbg("Board: %u nametable syncs remapped %u nametables "
+			"(%.1f per frame)\n", stats->nmt_syncs,
+			stats->nmt_pages, stats->nmt_pages / frames);
+	}
+
 	board_write_ips_save(board, board->modified_ranges);
 	free_range_list(&board->modified_ranges);
 	board_cleanup_ram_chips(board);
@@ -2222,6 +2337,29 @@ void board_end_frame(struct board *board, uint32_t cycles)
 
 	if (board->emu->m2_timer)
 		m2_timer_end_frame(board->emu->m2_timer, cycles);
+
+	board->last_sync_stats = board->sync_stats;
+	board->total_sync_stats.prg_syncs += board->sync_stats.prg_syncs;
+	board->total_sync_stats.prg_pages += board->sync_stats.prg_pages;
+	board->total_sync_stats.chr_syncs += board->sync_stats.chr_syncs;
+	board->total_sync_stats.chr_pages += board->sync_stats.chr_pages;
+	board->total_sync_stats.nmt_syncs += board->sync_stats.nmt_syncs;
+	board->total_sync_stats.nmt_pages += board->sync_stats.nmt_pages;
+	board->sync_stats_frames++;
+	memset(&board->sync_stats, 0, sizeof(board->sync_stats));
+
+	board_nvram_writeback(board);
+}
+
+void board_get_sync_stats(struct board *board,
+			  struct board_sync_stats *frame,
+			  struct board_sync_stats *total)
+{
+	if (frame)
+		*frame = board->last_sync_stats;
+
+	if (total)
+		*total = board->total_sync_stats;
 }
 
 void board_set_ppu_mirroring(struct board *board, int type)
@@ -2297,152 +2435,216 @@ uint8_t board_get_dip_switches(struct board * board)
 	return board->dip_switches;
 }
 
-void board_prg_sync(struct board *board)
+/* Works out where a PRG slot points, without touching the CPU's
+   page tables.  The slot is mapped as chunks of m->size bytes of
+   m->data (or unmapped, if data is NULL or the chunks are smaller
+   than a page) repeated from m->address over m->pages.
+*/
+static void board_resolve_prg_bank(struct board *board, struct bank *b,
+				   struct bank_mapping *m)
 {
-	int i;
-	struct bank *b;
-	int prg_entries;
+	unsigned and;
+	unsigned or;
+	uint32_t addr, end;
+	int bank;
+	uint8_t *data;
+	size_t data_size;
+	int type, perms;
+	size_t size;
+	int num_banks;
 
-	prg_entries = sizeof(board->prg_banks) /
-	    sizeof(board->prg_banks[0]);
+	memset(m, 0, sizeof(*m));
 
-	for (i = 0; i < prg_entries; i++) {
-		unsigned and;
-		unsigned or;
-		int bank;
-		uint8_t *data;
-		size_t data_size;
-		int type, perms;
-		int addr;
-		size_t size;
-		int num_banks;
+	if (b->size == 0)
+		return;
 
-		b = &board->prg_banks[i];
-		if (b->size == 0)
-			continue;
+	data = NULL;
+	data_size = 0;
+	perms = 0;
+	bank = 0;
+
+	and = board->prg_and;
+	or = board->prg_or;
+	if ((b->type != MAP_TYPE_ROM) &&
+	    (b->type != MAP_TYPE_BIOS)) {
+		and = board->wram_and;
+		or = board->wram_or;
+	}
+
+	or &= (~and);
+
+	type = b->type;
+	perms = b->perms;
+
+	if (type == MAP_TYPE_AUTO) {
+		if (board->wram[0].data)
+			type = MAP_TYPE_RAM0;
+		else
+			type = MAP_TYPE_NONE;
+	}
 
+	switch (type) {
+	case MAP_TYPE_ROM:
+		data = board->prg_rom.data;
+		data_size = board->prg_rom.size;
+		perms &= MAP_PERM_READ;
+		break;
+	case MAP_TYPE_RAM0:
+		data = board->wram[0].data;
+		data_size = board->wram[0].size;
+		break;
+	case MAP_TYPE_RAM1:
+		data = board->wram[1].data;
+		data_size = board->wram[1].size;
+		break;
+	case MAP_TYPE_NONE:
 		data = NULL;
-		data_size = 0;
-		perms = 0;
-		bank = 0;
-
-		and = board->prg_and;
-		or = board->prg_or;
-		if ((b->type != MAP_TYPE_ROM) &&
-		    (b->type != MAP_TYPE_BIOS)) {
-			and = board->wram_and;
-			or = board->wram_or;
-		}
+		data_size = b->size;
+		break;
+	case MAP_TYPE_MAPPER_RAM:
+		data = board->mapper_ram.data;
+		data_size = board->mapper_ram.size;
+		break;
+	case MAP_TYPE_BIOS:
+		data = board->bios.data;
+		data_size = board->bios.size;
+		perms &= MAP_PERM_READ;
+		break;
+	default:
+		log_err("board_prg_sync: invalid type %d\n",
+			type);
+		type = MAP_TYPE_NONE;
+		break;
+	}
 
-		or &= (~and);
+	bank = b->bank;
+	num_banks = data_size / b->size;
 
-		type = b->type;
-		perms = b->perms;
+	if (bank >= 0) {
+		if (num_banks <= 1)
+			bank = 0;
+	} else {
+		if (num_banks <= 1)
+			bank = -1;
+		else
+			bank = -(-bank % num_banks);
+	}
 
-		if (type == MAP_TYPE_AUTO) {
-			if (board->wram[0].data)
-				type = MAP_TYPE_RAM0;
-			else
-				type = MAP_TYPE_NONE;
-		}
+	if ((bank < 0) && !(data_size % b->size))
+		bank += num_banks;
 
-		switch (type) {
-		case MAP_TYPE_ROM:
-			data = board->prg_rom.data;
-			data_size = board->prg_rom.size;
-			perms &= MAP_PERM_READ;
-			break;
-		case MAP_TYPE_RAM0:
-			data = board->wram[0].data;
-			data_size = board->wram[0].size;
-			break;
-		case MAP_TYPE_RAM1:
-			data = board->wram[1].data;
-			data_size = board->wram[1].size;
-			break;
-		case MAP_TYPE_NONE:
-			data = NULL;
-			data_size = b->size;
-			break;
-		case MAP_TYPE_MAPPER_RAM:
-			data = board->mapper_ram.data;
-			data_size = board->mapper_ram.size;
-			break;
-		case MAP_TYPE_BIOS:
-			data = board->bios.data;
-			data_size = board->bios.size;
-			perms &= MAP_PERM_READ;
-			break;
-		default:
-			log_err("board_prg_sync: invalid type %d\n",
-				type);
-			type = MAP_TYPE_NONE;
-			break;
-		}
+	/* Applying prg_and and prg_or doesn't really
+	 * work if we're using negative bank numbers
+	 * (only happens if data_size is not a multiple
+	 * of bank size).
+	 */
+	if (bank >= 0) {
+		bank = ((bank & and) | or) >> b->shift;
+		if (num_banks)
+			bank %= num_banks;
+	}
 
-		bank = b->bank;
-		num_banks = data_size / b->size;
+	if (data) {
+		int offset;
 
-		if (bank >= 0) {
-			if (num_banks <= 1)
-				bank = 0;
+		offset = (int)bank * b->size;
+		if (offset < 0) {
+			data += (data_size + offset);
 		} else {
-			if (num_banks <= 1)
-				bank = -1;
-			else
-				bank = -(-bank % num_banks);
+			data += offset;
 		}
+	} else {
+		data_size = b->size;
+	}
 
-		if ((bank < 0) && !(data_size % b->size))
-			bank += num_banks;
-
-		/* Applying prg_and and prg_or doesn't really
-		 * work if we're using negative bank numbers
-		 * (only happens if data_size is not a multiple
-		 * of bank size).
-		 */
-		if (bank >= 0) {
-			bank = ((bank & and) | or) >> b->shift;
-			if (num_banks)
-				bank %= num_banks;
-		}
+	size = (b->size <= data_size) ? b->size : data_size;
+	if (!size)
+		return;
 
-		if (data) {
-			int offset;
+	m->size = size;
+	m->address = b->address;
+	m->perms = perms;
 
-			offset = (int)bank * b->size;
-			if (offset < 0) {
-				data += (data_size + offset);
-			} else {
-				data += offset;
-			}
-		} else {
-			data_size = b->size;
-		}
+	/* Each sub-page chunk unmaps its whole page */
+	if (size >= CPU_PAGE_SIZE)
+		m->data = data;
 
+	end = b->address + (b->size + size - 1) / size * size;
+	for (addr = b->address & ~(CPU_PAGE_SIZE - 1); addr < end;
+	     addr += CPU_PAGE_SIZE) {
+		m->pages |= (uint64_t)1 << (addr >> CPU_PAGE_SHIFT);
+	}
+}
 
-		/*
-		printf("%x: mapping %x to %x, bank=%x bankfu=%x, size=%x, perms=%x\n",
-	               type, data, b->address, b->bank, bank, b->size, perms); 
-		*/
- 
-		size = (b->size <= data_size) ? b->size : data_size;
+/* Resolves every PRG slot, then rewrites only the CPU pages covered
+   (before or after) by a slot whose mapping changed.  Slots are
+   still applied in order over those pages, so where slots overlap the
+   later one wins, same as rewriting everything.
+*/
+void board_prg_sync(struct board *board)
+{
+	int i;
+	int prg_entries;
+	uint64_t dirty;
 
-		for (addr = b->address;
-		     size && addr < (uint32_t) b->address + b->size;
-		     addr += size) {
-			uint8_t *ptr;
+	prg_entries = sizeof(board->prg_banks) /
+	    sizeof(board->prg_banks[0]);
+
+	board->sync_stats.prg_syncs++;
 
-			ptr = data;
-			if (size < CPU_PAGE_SIZE)
-				ptr = NULL;
+	dirty = 0;
+	for (i = 0; i < prg_entries; i++) {
+		struct bank_mapping m;
+
+		board_resolve_prg_bank(board, &board->prg_banks[i], &m);
 
-			cpu_set_pagetable_entry(board->emu->cpu, addr, size,
-						ptr, perms);
+		if (board->prg_mappings_valid &&
+		    !memcmp(&m, &board->prg_mappings[i], sizeof(m))) {
+			continue;
 		}
 
-//              printf("mapping done\n");
+		dirty |= board->prg_mappings[i].pages | m.pages;
+		memcpy(&board->prg_mappings[i], &m, sizeof(m));
+	}
+
+	board->prg_mappings_valid = 1;
+
+	if (!dirty)
+		return;
 
+	for (i = 0; i < prg_entries; i++) {
+		struct bank_mapping *m;
+		uint64_t pages;
+		int page;
+
+		m = &board->prg_mappings[i];
+		pages = m->pages & dirty;
+
+		while (pages) {
+			uint8_t *ptr;
+			int addr, chunk;
+
+			page = __builtin_ctzll(pages);
+			pages &= pages - 1;
+
+			addr = page << CPU_PAGE_SHIFT;
+
+			ptr = NULL;
+			if (m->data) {
+				chunk = 0;
+				if (addr > m->address)
+					chunk = (addr - m->address) / m->size;
+				/* Offset the chunk's data so that it's
+				   indexed by CPU address, as
+				   cpu_set_pagetable_entry() would */
+				ptr = m->data + addr -
+					(m->address + chunk * m->size);
+			}
+
+			cpu_set_pagetable_entry(board->emu->cpu, addr,
+						CPU_PAGE_SIZE, ptr, m->perms);
+			board->sync_stats.prg_pages++;
+		}
 	}
 }
 
@@ -2452,6 +2654,7 @@ static void board_internal_nmt_sync(struct board *board)
 	uint32_t cycles;
 
 	cycles = cpu_get_cycles(board->emu->cpu);
+	board->sync_stats.nmt_syncs++;
 
 	for (i = 0; i < 4; i++) {
 		uint8_t *data;
@@ -2513,8 +2716,20 @@ static void board_internal_nmt_sync(struct board *board)
 			data += bank * SIZE_1K;
 		}
 
+		if (board->nmt_mappings_valid &&
+		    (board->nmt_mappings[i].data == data) &&
+		    (board->nmt_mappings[i].perms == perms)) {
+			continue;
+		}
+
+		board->nmt_mappings[i].data = data;
+		board->nmt_mappings[i].perms = perms;
+
 		ppu_map_nametable(board->emu->ppu, i, data, perms, cycles);
+		board->sync_stats.nmt_pages++;
 	}
+
+	board->nmt_mappings_valid = 1;
 }
 
 void board_nmt_sync(struct board *board)
@@ -2529,135 +2744,207 @@ void board_nmt_sync(struct board *board)
 	board_internal_nmt_sync(board);
 }
 
-void board_chr_sync(struct board *board, int set)
+/* Works out where a CHR slot points, like board_resolve_prg_bank()
+   does for PRG.  Chunks that ppu_set_pagemap_entry() would ignore
+   (those reaching past the pattern tables) aren't included in
+   m->pages.
+*/
+static void board_resolve_chr_bank(struct board *board, struct bank *b,
+				   struct bank_mapping *m)
 {
-	int i;
-	struct bank *b;
-	uint32_t cycles;
-	int chr_entries;
+	uint32_t and;
+	uint32_t or;
+	uint32_t bank;
+	uint8_t *data;
+	uint32_t data_size;
+	int type, perms;
+	uint32_t addr;
+	size_t size;
+	int num_banks;
 
-	cycles = cpu_get_cycles(board->emu->cpu);
-	chr_entries = sizeof(board->chr_banks0) /
-		sizeof(board->chr_banks0[0]);
+	memset(m, 0, sizeof(*m));
 
-	for (i = 0; i < chr_entries; i++) {
-		uint32_t and;
-		uint32_t or;
-		uint32_t bank;
-		uint8_t *data;
-		uint32_t data_size;
-		int type, perms;
-		int addr;
-		size_t size;
-		int num_banks;
+	if (b->size == 0)
+		return;
 
-		if (set)
-			b = &board->chr_banks1[i];
-		else
-			b = &board->chr_banks0[i];
-		if (b->size == 0)
-			continue;
+	and = board->chr_and;
+	or = board->chr_or;
+
+	data = NULL;
+	data_size = 0;
 
-		and = board->chr_and;
-		or = board->chr_or;
+	type = b->type;
+	perms = b->perms;
 
+	if (type == MAP_TYPE_AUTO) {
+		if (board->chr_rom.data)
+			type = MAP_TYPE_ROM;
+		else if (board->vram[0].data)
+			type = MAP_TYPE_RAM0;
+	}
+
+	switch (type) {
+	case MAP_TYPE_ROM:
+		data = board->chr_rom.data;
+		data_size = board->chr_rom.size;
+		perms &= MAP_PERM_READ;
+		break;
+	case MAP_TYPE_RAM0:
+		data = board->vram[0].data;
+		data_size = board->vram[0].size;
+		break;
+	case MAP_TYPE_RAM1:
+		data = board->vram[1].data;
+		data_size = board->vram[1].size;
+		break;
+	case MAP_TYPE_CIRAM:
+		data = board->ciram.data;
+		data_size = board->ciram.size;
+		break;
+	case MAP_TYPE_NONE:
 		data = NULL;
-		data_size = 0;
+		data_size = b->size;
+		break;
+	default:
+		log_err("board_chr_sync: invalid type %d\n",
+			type);
+		type = MAP_TYPE_NONE;
+		break;
+	}
 
-		type = b->type;
-		perms = b->perms;
+	bank = b->bank;
+	num_banks = data_size / b->size;
 
-		if (type == MAP_TYPE_AUTO) {
-			if (board->chr_rom.data)
-				type = MAP_TYPE_ROM;
-			else if (board->vram[0].data)
-				type = MAP_TYPE_RAM0;
-		}
+	if (bank >= 0) {
+		if (num_banks <= 1)
+			bank = 0;
+	} else {
+		if (num_banks <= 1)
+			bank = -1;
+		else
+			bank = -(-bank % num_banks);
+	}
 
-		switch (type) {
-		case MAP_TYPE_ROM:
-			data = board->chr_rom.data;
-			data_size = board->chr_rom.size;
-			perms &= MAP_PERM_READ;
-			break;
-		case MAP_TYPE_RAM0:
-			data = board->vram[0].data;
-			data_size = board->vram[0].size;
-			break;
-		case MAP_TYPE_RAM1:
-			data = board->vram[1].data;
-			data_size = board->vram[1].size;
-			break;
-		case MAP_TYPE_CIRAM:
-			data = board->ciram.data;
-			data_size = board->ciram.size;
-			break;
-		case MAP_TYPE_NONE:
-			data = NULL;
-			data_size = b->size;
-			break;
-		default:
-			log_err("board_chr_sync: invalid type %d\n",
-				type);
-			type = MAP_TYPE_NONE;
-			break;
-		}
+	if ((bank < 0) && !(data_size % b->size))
+		bank += num_banks;
+
+	/* Applying chr_and and chr_or doesn't really
+	 * work if we're using negative bank numbers
+	 * (only happens if data_size is not a multiple
+	 * of bank size).
+	 */
+	if (bank >= 0) {
+		bank = ((b->bank & and) | or) >> b->shift;
+		if (num_banks)
+			bank %= num_banks;
+	}
 
-		bank = b->bank;
-		num_banks = data_size / b->size;
+	if (data) {
+		int offset;
 
-		if (bank >= 0) {
-			if (num_banks <= 1)
-				bank = 0;
+		offset = (int)bank * b->size;
+		if (offset < 0) {
+			data += (data_size + offset);
 		} else {
-			if (num_banks <= 1)
-				bank = -1;
-			else
-				bank = -(-bank % num_banks);
+			data += offset;
 		}
+	}
+
+	size = (b->size <= data_size) ? b->size : data_size;
+	if (!size)
+		return;
+
+	m->size = size;
+	m->address = b->address;
+	m->perms = perms;
+
+	/* Each sub-page chunk unmaps its whole page */
+	if (size >= SIZE_1K)
+		m->data = data;
+
+	for (addr = b->address; addr < (uint32_t)b->address + b->size;
+	     addr += size) {
+		uint32_t page_addr, end;
+
+		if ((addr & 0x3fff) + size > 0x2000)
+			continue;
 
-		if ((bank < 0) && !(data_size % b->size))
-			bank += num_banks;
-
-		/* Applying chr_and and chr_or doesn't really
-		 * work if we're using negative bank numbers
-		 * (only happens if data_size is not a multiple
-		 * of bank size).
-		 */
-		if (bank >= 0) {
-			bank = ((b->bank & and) | or) >> b->shift;
-			if (num_banks)
-				bank %= num_banks;
+		/* A sub-page chunk only unmaps the page it starts in */
+		end = addr + (size < SIZE_1K ? 1 : size);
+		for (page_addr = addr & ~(SIZE_1K - 1); page_addr < end;
+		     page_addr += SIZE_1K) {
+			m->pages |= (uint64_t)1 << (page_addr >> 10);
 		}
+	}
+}
 
-		if (data) {
-			int offset;
+/* Same approach as board_prg_sync(): only pages covered by a slot
+   whose mapping changed are passed on to the PPU. */
+void board_chr_sync(struct board *board, int set)
+{
+	int i;
+	uint32_t cycles;
+	int chr_entries;
+	struct bank *banks;
+	struct bank_mapping *mappings;
+	uint64_t dirty;
 
-			offset = (int)bank * b->size;
-			if (offset < 0) {
-				data += (data_size + offset);
-			} else {
-				data += offset;
-			}
+	chr_entries = sizeof(board->chr_banks0) /
+		sizeof(board->chr_banks0[0]);
+
+	banks = set ? board->chr_banks1 : board->chr_banks0;
+	mappings = board->chr_mappings[set ? 1 : 0];
+
+	board->sync_stats.chr_syncs++;
+
+	dirty = 0;
+	for (i = 0; i < chr_entries; i++) {
+		struct bank_mapping m;
+
+		board_resolve_chr_bank(board, &banks[i], &m);
+
+		if (board->chr_mappings_valid[set ? 1 : 0] &&
+		    !memcmp(&m, &mappings[i], sizeof(m))) {
+			continue;
 		}
 
-		size = (b->size <= data_size) ? b->size : data_size;
+		dirty |= mappings[i].pages | m.pages;
+		memcpy(&mappings[i], &m, sizeof(m));
+	}
 
-		/* printf("mapping %x to %x, size=%x, perms=%x size=%x type=%d\n", */
-		/*        data, b->address, b->size, perms, size, type); */
+	board->chr_mappings_valid[set ? 1 : 0] = 1;
 
-		for (addr = b->address;
-		     size && addr < (uint32_t) b->address + b->size;
-		     addr += size) {
-			uint8_t *ptr;
+	if (!dirty)
+		return;
 
-			ptr = data;
-			if (size < SIZE_1K)
-				ptr = NULL;
+	cycles = cpu_get_cycles(board->emu->cpu);
 
-			ppu_set_pagemap_entry(board->emu->ppu, set, addr, size,
-					      ptr, perms, cycles);
+	for (i = 0; i < chr_entries; i++) {
+		struct bank_mapping *m;
+		uint64_t pages;
 
+		m = &mappings[i];
+		pages = m->pages & dirty;
+
+		while (pages) {
+			uint8_t *ptr;
+			int addr, chunk;
+
+			addr = __builtin_ctzll(pages) << 10;
+			pages &= pages - 1;
+
+			ptr = NULL;
+			if (m->data) {
+				chunk = 0;
+				if (addr > m->address)
+					chunk = (addr - m->address) / m->size;
+				ptr = m->data + addr -
+					(m->address + chunk * m->size);
+			}
+
+			ppu_set_pagemap_entry(board->emu->ppu, set, addr,
+					      SIZE_1K, ptr, m->perms, cycles);
+			board->sync_stats.chr_pages++;
 		}
 	}
 }
@@ -2736,6 +3023,13 @@ void board_get_mapper_ram(struct board *board, uint8_t **ramptr,
 	*sizeptr = board->mapper_ram.size;
 }
 
+void board_get_wram(struct board *board, uint8_t **ramptr,
+		    size_t *sizeptr)
+{
+	*ramptr = board->wram[0].data;
+	*sizeptr = board->wram[0].size;
+}
+
 CPU_WRITE_HANDLER(simple_prg_write_handler)
 {
 	struct board *board = emu->board;
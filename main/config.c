@@ -212,6 +212,14 @@ static const char *valid_raw_pcm_filters[] = {
 	"never", "playback", "always"
 };
 
+static const char *valid_audio_filter_names[] = {
+	"Match system type", "None", "NES", "Famicom",
+};
+
+static const char *valid_audio_filters[] = {
+	"auto", "none", "nes", "famicom"
+};
+
 static const char *valid_four_player_names[] = {
 	"Auto", "None", "NES (Four Score/Satellite)", "Famicom",
 };
@@ -423,6 +431,7 @@ struct config_parameter rom_config_parameters[] = {
 			   valid_rom_system_type_names),
 	CONFIG_BOOLEAN(swap_a_b, 0),
 	CONFIG_BOOLEAN(swap_start_select, 0),
+	CONFIG_BOOLEAN(scanline_renderer_unsafe, 0),
 	CONFIG_STRING_LIST(default_port1_device, "auto",
 			   valid_port1_devices, port1_device_names),
 	CONFIG_STRING_LIST(default_port2_device, "auto",
@@ -507,6 +516,9 @@ struct config_parameter config_parameters[] = {
 			   valid_loglevels,
 			   valid_loglevel_names),
 	CONFIG_BOOLEAN(scanline_renderer_enabled, 1),
+	CONFIG_BOOLEAN(scanline_renderer_auto, 0),
+	CONFIG_BOOLEAN(a12_timer_fast_irq, 1),
+	CONFIG_STRING(state_export_name, NULL),
 	CONFIG_BOOLEAN(fps_display_enabled, 0),
 	CONFIG_INTEGER(window_scaling_factor, 1, 1, 8),
 	CONFIG_BOOLEAN(fullscreen, 0),
@@ -568,7 +580,12 @@ struct config_parameter config_parameters[] = {
 			   valid_default_overclock_mode_names),
 	CONFIG_INTEGER_LIST(sample_rate, 48000, valid_sample_rates),
 	CONFIG_INTEGER(audio_buffer_size, 2048, 1024, 8192), /* FIXME min? max? */
+	CONFIG_INTEGER(audio_latency_target, 0, 0, 1000), /* ms, 0 = auto */
+	CONFIG_BOOLEAN(expansion_audio_thread, 0),
 	CONFIG_BOOLEAN(dynamic_rate_adjustment_enabled, 1),
+	CONFIG_INTEGER(audio_resampler_rate, 0, 0, 384000), /* Hz, 0 = off */
+	CONFIG_STRING_LIST(audio_filter, "none", valid_audio_filters,
+		valid_audio_filter_names),
 	CONFIG_BOOLEAN(force_stereo, 0),
 	CONFIG_INTEGER(master_volume, 100, 0, 200),
 	CONFIG_INTEGER(apu_pulse0_volume, 100, 0, 100),
@@ -576,6 +593,7 @@ struct config_parameter config_parameters[] = {
 	CONFIG_INTEGER(apu_triangle_volume, 100, 0, 100),
 	CONFIG_INTEGER(apu_noise_volume, 100, 0, 100),
 	CONFIG_INTEGER(apu_dmc_volume, 100, 0, 100),
+	CONFIG_BOOLEAN(apu_synthesis_enabled, 1),
 	CONFIG_INTEGER(vrc6_pulse0_volume, 100, 0, 100),
 	CONFIG_INTEGER(vrc6_pulse1_volume, 100, 0, 100),
 	CONFIG_INTEGER(vrc6_sawtooth_volume, 100, 0, 100),
@@ -735,6 +753,7 @@ struct config_parameter config_parameters[] = {
 		.min.svalue = 0,
 		.max.svalue = 100,
 	},
+	CONFIG_BOOLEAN(namco163_mixed_output, 1),
 	CONFIG_INTEGER(fds_volume, 100, 0, 100),
 	CONFIG_BOOLEAN(swap_pulse_duty_cycles, 0),
 	CONFIG_STRING_LIST(raw_pcm_filter, "never", valid_raw_pcm_filters,
@@ -755,6 +774,7 @@ struct config_parameter config_parameters[] = {
 	CONFIG_BOOLEAN(skip_maincfg, 0),
 	CONFIG_BOOLEAN(skip_romcfg, 0),
 	CONFIG_BOOLEAN(nvram_uses_memmap, 1),
+	CONFIG_INTEGER(nvram_writeback_interval, 30, 0, 3600),
 	CONFIG_BOOLEAN(autopatch_enabled, 1),
 
 	CONFIG_STRING_LIST(scaling_mode, "nearest_then_linear",
@@ -762,8 +782,6 @@ struct config_parameter config_parameters[] = {
 			   valid_scaling_mode_names),
 
 	CONFIG_FLOAT(dynamic_rate_adjustment_max, 0.0055, 0, 0.010),
-	CONFIG_FLOAT(dynamic_rate_adjustment_low_watermark, 0.5, 0.0, 3.0),
-	CONFIG_FLOAT(dynamic_rate_adjustment_buffer_range, 1.2, 1.0, 3.0),
 
 	CONFIG_BOOLEAN(save_uses_romdir, 0),
 	CONFIG_BOOLEAN(config_uses_romdir, 0),
@@ -849,6 +867,7 @@ struct binding_item default_bindings[] = {
 
 	{ .name = "Keyboard F2", .value = "TOGGLE_FULLSCREEN" },
 	{ .name = "Keyboard F3", .value = "TOGGLE_FPS" },
+	{ .name = "Keyboard F10", .value = "TOGGLE_AUDIO_STATS" },
 	{ .name = "Keyboard F4", .value = "QUIT" },
 	{ .name = "Keyboard F5", .value = "STATE_SAVE_SELECTED" },
 	{ .name = "Keyboard F6", .value = "FDS_SELECT" },
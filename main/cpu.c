@@ -41,6 +41,9 @@
 
 #define IRQ_FLAG(x) (1 << (x))
 
+#define IRQ_HASH_BASIS 0x811c9dc5
+#define IRQ_HASH_PRIME 0x01000193
+
 enum {
 	DMC_DMA_STEP_NONE,
 	DMC_DMA_STEP_RDY,
@@ -85,6 +88,8 @@ struct cpu_state {
 	int is_opcode_fetch;
 	int opcode;
 	int opcode_addr;
+	uint32_t irq_hash;
+	uint32_t frame_irq_hash;
 
 	cpu_read_handler_t *read_handlers[CPU_MEM_SIZE];
 	cpu_write_handler_t *write_handlers[CPU_MEM_SIZE];
@@ -1059,6 +1064,9 @@ static inline void update_interrupt_status(struct cpu_state *cpu)
 			if (!cpu->polled_interrupts) {
 				cpu->interrupts |= IRQ_FLAG(i);
 				cpu->interrupt_times[i] = ~0;
+				cpu->irq_hash = (cpu->irq_hash ^
+						 ((cpu->cycles << 4) | i)) *
+					IRQ_HASH_PRIME;
 			} else {
 				/* The previous instruction already
 				   polled for interrupts, so don't do
@@ -1343,6 +1351,8 @@ void cpu_reset(struct cpu_state *cpu, int hard)
 		cpu->step_cycles = 0;
 		cpu->board_run_timestamp = ~0;
 		cpu->resetting = 0;
+		cpu->irq_hash = IRQ_HASH_BASIS;
+		cpu->frame_irq_hash = IRQ_HASH_BASIS;
 		memset(cpu->interrupt_times, 0xff,
 		       sizeof(cpu->interrupt_times));
 	}
@@ -2432,6 +2442,9 @@ void cpu_end_frame(struct cpu_state *cpu, uint32_t frame_cycles)
 	recalc_cycle_operation_timestamp(cpu);
 
 	cpu->cycles -= frame_cycles;
+
+	cpu->frame_irq_hash = cpu->irq_hash;
+	cpu->irq_hash = IRQ_HASH_BASIS;
 }
 
 int cpu_get_pc(struct cpu_state *cpu)
@@ -2454,6 +2467,25 @@ int cpu_get_stack_pointer(struct cpu_state *cpu)
 	return cpu->S;
 }
 
+void cpu_get_registers(struct cpu_state *cpu, int *pc, int *a, int *x,
+		       int *y, int *s, int *p)
+{
+	*pc = cpu->PC;
+	*a = cpu->A;
+	*x = cpu->X;
+	*y = cpu->Y;
+	*s = cpu->S;
+	*p = cpu->P;
+}
+
+/* Hash of the (timestamp, interrupt) pairs latched by the interrupt
+   detectors during the last completed frame.
+*/
+uint32_t cpu_get_frame_irq_hash(struct cpu_state *cpu)
+{
+	return cpu->frame_irq_hash;
+}
+
 void cpu_set_dmc_dma_timestamp(struct cpu_state *cpu, uint32_t cycles, int addr,
 			   int immediate)
 {
@@ -29,6 +29,8 @@
 #include "file_io.h"
 #include "video.h"
 #include "fds.h"
+#include "state_export.h"
+#include "exp_audio.h"
 
 #define NS_PER_SEC 1000000000L
 
@@ -715,6 +717,8 @@ int emu_load_rom(struct emu *emu, char *filename, int patch_count,
 
 void emu_deinit(struct emu *emu)
 {
+	state_export_cleanup(emu);
+
 	if (emu->board)
 		board_cleanup(emu->board);
 
@@ -790,6 +794,8 @@ int emu_apply_config(struct emu *emu)
 	if (!emu->loaded)
 		return 0;
 
+	exp_audio_sync(emu);
+
 	rc |= cpu_apply_config(emu->cpu);
 	rc |= ppu_apply_config(emu->ppu);
 	rc |= apu_apply_config(emu->apu);
@@ -806,6 +812,8 @@ int emu_reset(struct emu *emu, int hard)
 	if (!emu->loaded)
 		return 1;
 
+	exp_audio_sync(emu);
+
 	emu->resetting = 1;
 	emu->overclocking = 0;
 
@@ -862,6 +870,10 @@ int emu_run_frame(struct emu *emu)
 	apu_end_frame(emu->apu, cycles);
 	board_end_frame(emu->board, cycles);
 	io_end_frame(emu->io, cycles);
+	exp_audio_end_frame(emu, cycles);
+
+	if (emu->state_export)
+		state_export_update(emu);
 
 	return cycles;
 }
@@ -922,6 +934,49 @@ void emu_toggle_cheats(struct emu *emu)
 	osdprintf("Cheats %s", enabled ? "enabled" : "disabled");
 }
 
+void emu_set_frame_hash_enabled(struct emu *emu, int enabled)
+{
+	if (!emu->loaded)
+		return;
+
+	ppu_set_frame_hash_enabled(emu->ppu, enabled);
+}
+
+uint64_t emu_get_frame_hash(struct emu *emu)
+{
+	if (!emu->loaded)
+		return 0;
+
+	return ppu_get_frame_hash(emu->ppu);
+}
+
+uint32_t emu_get_frame_irq_hash(struct emu *emu)
+{
+	if (!emu->loaded)
+		return 0;
+
+	return cpu_get_frame_irq_hash(emu->cpu);
+}
+
+void emu_get_cpu_registers(struct emu *emu, int *pc, int *a, int *x,
+			   int *y, int *s, int *p)
+{
+	if (!emu->loaded) {
+		*pc = *a = *x = *y = *s = *p = 0;
+		return;
+	}
+
+	cpu_get_registers(emu->cpu, pc, a, x, y, s, p);
+}
+
+uint64_t emu_get_scanline_hash(struct emu *emu, int scanline)
+{
+	if (!emu->loaded)
+		return 0;
+
+	return ppu_get_scanline_hash(emu->ppu, scanline);
+}
+
 void emu_pause(struct emu *emu, int pause)
 {
 	if (emu->loaded) {
@@ -1115,6 +1170,8 @@ int emu_save_state(struct emu *emu, const char *filename)
 	if (!state)
 		return -1;
 
+	exp_audio_sync(emu);
+
 	cpu_save_state(emu->cpu, state);
 	ppu_save_state(emu->ppu, state);
 	apu_save_state(emu->apu, state);
@@ -1144,6 +1201,8 @@ int emu_load_state(struct emu *emu, const char *filename)
 	if (save_state_read(state, filename) < 0)
 		return -1;
 
+	exp_audio_sync(emu);
+
 	/* CPU state must be loaded first */
 	cpu_load_state(emu->cpu, state);
 	ppu_load_state(emu->ppu, state);
@@ -1370,6 +1429,8 @@ static int emu_load_rom_common(struct emu *emu, struct rom *rom,
 	emu->loaded = 1;
 	video_show_cursor(emu->paused);
 
+	state_export_init(emu);
+
 	io_set_auto_four_player_mode(emu->io, rom->info.four_player_mode);
 	for (i = 0; i < 5; i++) {
 		io_set_auto_device(emu->io, i, rom->info.auto_device_id[i]);
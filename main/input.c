@@ -28,6 +28,7 @@
 #endif
 
 #include "video.h"
+#include "audio.h"
 #include "input.h"
 #include "file_io.h"
 
@@ -96,6 +97,7 @@ struct emu_action_id_map emu_action_id_map[] = {
 	EMU_ACTION_ID_MAP(TOGGLE_FULLSCREEN, VIDEO, "Full-Screen Mode Toggle"),
 	EMU_ACTION_ID_MAP(TOGGLE_MENUBAR, EMULATOR, "Menubar Toggle"),
 	EMU_ACTION_ID_MAP(TOGGLE_FPS, EMULATOR, "FPS Display Toggle"),
+	EMU_ACTION_ID_MAP(TOGGLE_AUDIO_STATS, EMULATOR, "Audio Stats Display Toggle"),
 	EMU_ACTION_ID_MAP(TOGGLE_SPRITE_LIMIT, PPU, "Sprite Limit Toggle"),
 	EMU_ACTION_ID_MAP(TOGGLE_SPRITES, PPU, "Sprite Display Toggle"),
 	EMU_ACTION_ID_MAP(TOGGLE_BG, PPU, "Background Display Toggle"),
@@ -1254,6 +1256,10 @@ static int misc_buttons(void *data, uint32_t pressed, uint32_t button)
 		if (pressed)
 			video_toggle_fps(-1);
 		break;
+	case ACTION_TOGGLE_AUDIO_STATS:
+		if (pressed)
+			audio_toggle_stats(-1);
+		break;
 	case ACTION_TOGGLE_SCANLINE_RENDERER:
 		if (pressed)
 			emu_toggle_scanline_renderer(emu);
@@ -1411,6 +1417,7 @@ static struct input_event_handler misc_handlers[] = {
 	{ ACTION_SAVE_SCREENSHOT,  misc_buttons },
 	{ ACTION_TOGGLE_FULLSCREEN,  misc_buttons },
 	{ ACTION_TOGGLE_FPS,  misc_buttons },
+	{ ACTION_TOGGLE_AUDIO_STATS,  misc_buttons },
 	{ ACTION_TOGGLE_MENUBAR,  misc_buttons },
 	{ ACTION_TOGGLE_SPRITE_LIMIT,  misc_buttons },
 	{ ACTION_TOGGLE_SPRITES,  misc_buttons },
@@ -35,6 +35,17 @@
 #define PAGEMAP_ENTRIES 16
 #define PAGE_SIZE 1024
 
+/* Number of frames the automatic renderer selection keeps using the
+   cycle renderer after the scanline renderer drew a line with the
+   wrong state.  When a ROM is unloaded after running at least
+   AUTO_RENDERER_PERSIST_FRAMES frames, and at least
+   AUTO_RENDERER_PERSIST_PERCENT percent of them had such an update,
+   the ROM is remembered as needing the cycle renderer.
+*/
+#define AUTO_RENDERER_HOLD_FRAMES 60
+#define AUTO_RENDERER_PERSIST_FRAMES 600
+#define AUTO_RENDERER_PERSIST_PERCENT 10
+
 #define DECAY_COUNTER_START_NTSC 36
 #define DECAY_COUNTER_START_PAL 30
 
@@ -48,6 +59,10 @@
 #define PIXEL_BG_PRIORITY 0x80
 #define PIXEL_SPRITE_ZERO 0x40
 
+/* FNV-1a parameters used for frame and scanline hashes */
+#define FRAME_HASH_BASIS 0xcbf29ce484222325ULL
+#define FRAME_HASH_PRIME 0x100000001b3ULL
+
 /* States for sprite evaluation state machine */
 #define SPRITE_EVAL_STOPPED 0
 #define SPRITE_EVAL_SCANLINE_CHECK 1
@@ -334,6 +349,22 @@ struct ppu_state {
 	int decay_counter_start;
 	int use_scanline_renderer;
 
+	/* Automatic renderer selection.  scanline_renderer_active is
+	   what ppu_run() actually uses for the current frame.
+	*/
+	int scanline_renderer_auto;
+	int scanline_renderer_active;
+	int scanline_renderer_unsafe;
+	int midline_update;
+	int in_read_hook;
+	int run_target;
+	int whole_scanline_start;
+	int whole_scanline_end;
+	int cycle_renderer_hold;
+	unsigned int scanline_renderer_frames;
+	unsigned int cycle_renderer_frames;
+	unsigned int midline_update_frames;
+
 	uint8_t *read_pagemap0[PAGEMAP_ENTRIES];
 	uint8_t *write_pagemap0[PAGEMAP_ENTRIES];
 	uint8_t *read_pagemap1[PAGEMAP_ENTRIES];
@@ -366,6 +397,15 @@ struct ppu_state {
 
 	int wrote_2006;
 	int sprite_overflow_flag;
+
+	/* Hashes of the completed scanlines and of the last completed
+	   frame.  frame_hash_accum holds the partial hash of the frame
+	   currently being rendered.
+	*/
+	int frame_hash_enabled;
+	uint64_t frame_hash;
+	uint64_t frame_hash_accum;
+	uint64_t scanline_hash[240];
 };
 
 static struct state_item ppu_state_items[] = {
@@ -444,9 +484,46 @@ static uint8_t power_up_palette[] = {
 //#define read_mem(x) (read_pagemap[(x) >> PPU_PAGE_SHIFT][(x) & PPU_PAGE_MASK])
 static void (*ppu_read_hook) (struct board *, int);
 
+/* One bit per 8-byte group of PPU addresses (one plane of one tile
+   for pattern fetches).  The read hook is only called for fetches
+   whose bit is set, so boards that care about a few addresses don't
+   pay for a call on every fetch. */
+static uint8_t ppu_read_hook_triggers[0x4000 >> 6];
+
+static INLINE int read_hook_triggered(uint16_t addr) ALWAYS_INLINE;
+static INLINE int read_hook_triggered(uint16_t addr)
+{
+	addr &= 0x3fff;
+
+	return ppu_read_hook_triggers[addr >> 6] & (1 << (addr >> 3 & 7));
+}
+
+#define call_read_hook(ppu, addr) do {				\
+		if (ppu_read_hook && read_hook_triggered(addr)) {	\
+			(ppu)->in_read_hook = 1;			\
+			ppu_read_hook((ppu)->emu->board, addr);		\
+			(ppu)->in_read_hook = 0;			\
+		}							\
+	} while (0)
+
 void ppu_set_read_hook(void (*hook) (struct board *, int))
 {
 	ppu_read_hook = hook;
+	memset(ppu_read_hook_triggers, 0xff, sizeof(ppu_read_hook_triggers));
+}
+
+void ppu_set_read_hook_triggers(void (*hook) (struct board *, int),
+				const int *triggers)
+{
+	int addr;
+
+	ppu_read_hook = hook;
+	memset(ppu_read_hook_triggers, 0, sizeof(ppu_read_hook_triggers));
+
+	for (; *triggers >= 0; triggers++) {
+		addr = *triggers & 0x3fff;
+		ppu_read_hook_triggers[addr >> 6] |= 1 << (addr >> 3 & 7);
+	}
 }
 
 void ppu_enable_a12_timer(struct ppu_state *ppu, int enabled)
@@ -454,6 +531,29 @@ void ppu_enable_a12_timer(struct ppu_state *ppu, int enabled)
 	ppu->a12_timer_enabled = enabled;
 }
 
+/* Record that PPU state changed inside a scanline that
+   do_whole_scanline() has already drawn.  Must be called after
+   catching up with ppu_run(), so that run_target is the time of the
+   change.
+
+   Changes anywhere else are drawn correctly by the scanline renderer:
+   ppu_run() only draws whole lines that end before the time it was
+   asked to catch up to, so a line containing a write goes through
+   do_partial_scanline().  Changes made by a read hook (MMC2/MMC4 style
+   latches) don't count either; they happen at the fetch that
+   triggered them, in both renderers.
+*/
+static INLINE void check_midline_update(struct ppu_state *ppu)
+{
+	if (ppu->in_read_hook)
+		return;
+
+	if (ppu->run_target >= ppu->whole_scanline_start &&
+	    ppu->run_target < ppu->whole_scanline_end) {
+		ppu->midline_update = 1;
+	}
+}
+
 static INLINE void sprite_read(struct ppu_state *ppu) ALWAYS_INLINE;
 static INLINE void sprite_read(struct ppu_state *ppu)
 {
@@ -479,8 +579,7 @@ static INLINE uint8_t read_nmt(struct ppu_state *ppu, uint16_t addr)
 	if (ppu->read_bg_pagemap[page])
 		data = ppu->read_bg_pagemap[page][offset];
 
-	if (ppu_read_hook)
-		ppu_read_hook(ppu->emu->board, addr);
+	call_read_hook(ppu, addr);
 
 	return data;
 }
@@ -503,8 +602,7 @@ static INLINE uint8_t read_bg(struct ppu_state *ppu, uint16_t addr)
 	if (ppu->read_bg_pagemap[page])
 		data = ppu->read_bg_pagemap[page][offset];
 
-	if (ppu_read_hook)
-		ppu_read_hook(ppu->emu->board, addr);
+	call_read_hook(ppu, addr);
 
 	return data;
 }
@@ -527,8 +625,7 @@ static INLINE uint8_t read_spr(struct ppu_state *ppu, uint16_t addr)
 	if (ppu->read_spr_pagemap[page])
 		data = ppu->read_spr_pagemap[page][offset];
 
-	if (ppu_read_hook)
-		ppu_read_hook(ppu->emu->board, addr);
+	call_read_hook(ppu, addr);
 
 	return data;
 }
@@ -554,6 +651,11 @@ uint8_t *ppu_get_oam_ptr(struct ppu_state *ppu)
 	return ppu->oam;
 }
 
+uint8_t *ppu_get_palette_ptr(struct ppu_state *ppu)
+{
+	return ppu->palette;
+}
+
 void ppu_set_reset_connected(struct ppu_state *ppu, int connected)
 {
 	ppu->reset_connected = connected;
@@ -567,6 +669,8 @@ int ppu_get_reset_connected(struct ppu_state *ppu)
 void ppu_use_exram(struct ppu_state *ppu, int mode, uint32_t cycles)
 {
 	ppu_run(ppu, cycles);
+	if (mode != ppu->exram_mode)
+		check_midline_update(ppu);
 	ppu->exram_mode = mode;
 }
 
@@ -576,7 +680,14 @@ void ppu_map_nametable(struct ppu_state *ppu, int nametable, uint8_t * data,
 	if (nametable < 0 || nametable > 3)
 		return;
 
+	/* Nothing to catch up on if the mapping isn't changing */
+	if (!((rw & 1) && (ppu->read_pagemap0[8 + nametable] != data)) &&
+	    !((rw & 2) && (ppu->write_pagemap0[8 + nametable] != data))) {
+		return;
+	}
+
 	ppu_run(ppu, cycles);
+	check_midline_update(ppu);
 
 	if (rw & 1) {
 		ppu->read_pagemap0[8 + nametable] = data;
@@ -600,6 +711,11 @@ void ppu_select_bg_pagemap(struct ppu_state *ppu, int map, uint32_t cycles)
 
 	ppu_run(ppu, cycles);
 
+	if (ppu->read_bg_pagemap != (map ? ppu->read_pagemap1 :
+				     ppu->read_pagemap0)) {
+		check_midline_update(ppu);
+	}
+
 	if (map) {
 		ppu->read_bg_pagemap = ppu->read_pagemap1;
 		ppu->write_bg_pagemap = ppu->write_pagemap1;
@@ -616,6 +732,11 @@ void ppu_select_spr_pagemap(struct ppu_state *ppu, int map, uint32_t cycles)
 
 	ppu_run(ppu, cycles);
 
+	if (ppu->read_spr_pagemap != (map ? ppu->read_pagemap1 :
+				      ppu->read_pagemap0)) {
+		check_midline_update(ppu);
+	}
+
 	if (map) {
 		ppu->read_spr_pagemap = ppu->read_pagemap1;
 		ppu->write_spr_pagemap = ppu->write_pagemap1;
@@ -671,6 +792,7 @@ void ppu_set_pagemap_entry(struct ppu_state *ppu, int map, int addr,
 			old = r_ptr[page];
 			if (old != new) {
 				ppu_run(ppu, cycles);
+				check_midline_update(ppu);
 				r_ptr[page] = new;
 			}
 		}
@@ -678,6 +800,7 @@ void ppu_set_pagemap_entry(struct ppu_state *ppu, int map, int addr,
 			old = w_ptr[page];
 			if (old != new) {
 				ppu_run(ppu, cycles);
+				check_midline_update(ppu);
 				w_ptr[page] = new;
 			}
 		}
@@ -800,6 +923,63 @@ void ppu_set_type(struct ppu_state *ppu, int type)
 
 }
 
+static void update_active_renderer(struct ppu_state *ppu)
+{
+	if (!ppu->scanline_renderer_auto) {
+		ppu->scanline_renderer_active = ppu->use_scanline_renderer;
+		return;
+	}
+
+	ppu->scanline_renderer_active = ppu->use_scanline_renderer &&
+		!ppu->cycle_renderer_hold && !ppu->scanline_renderer_unsafe;
+}
+
+/* Pick the renderer for the next frame.  In automatic mode the
+   scanline renderer is used unless it recently drew a line with the
+   wrong state, or this ROM has been seen doing so often enough before.
+   Only called once per frame, from ppu_end_frame().
+*/
+static void select_renderer(struct ppu_state *ppu)
+{
+	if (ppu->scanline_renderer_auto) {
+		if (ppu->midline_update) {
+			ppu->midline_update_frames++;
+			ppu->cycle_renderer_hold = AUTO_RENDERER_HOLD_FRAMES;
+		} else if (ppu->cycle_renderer_hold) {
+			ppu->cycle_renderer_hold--;
+		}
+	}
+
+	ppu->midline_update = 0;
+	update_active_renderer(ppu);
+}
+
+/* Remember the cycle renderer for this ROM if enough of this
+   session's frames needed it.  Called when the ROM is unloaded. */
+static void persist_renderer_choice(struct ppu_state *ppu)
+{
+	unsigned int frames;
+
+	if (!ppu->scanline_renderer_auto || ppu->scanline_renderer_unsafe ||
+	    !ppu->emu->loaded) {
+		return;
+	}
+
+	frames = ppu->scanline_renderer_frames + ppu->cycle_renderer_frames;
+	if (frames < AUTO_RENDERER_PERSIST_FRAMES)
+		return;
+
+	if ((uint64_t)ppu->midline_update_frames * 100 <
+	    (uint64_t)frames * AUTO_RENDERER_PERSIST_PERCENT) {
+		return;
+	}
+
+	log_info("PPU: remembering cycle renderer for this ROM\n");
+	ppu->scanline_renderer_unsafe = 1;
+	ppu->emu->config->scanline_renderer_unsafe = 1;
+	config_save_rom_config(ppu->emu->config);
+}
+
 int ppu_init(struct emu *emu)
 {
 	uint16_t addr;
@@ -823,10 +1003,11 @@ int ppu_init(struct emu *emu)
 		ppu->write_pagemap1[i] = NULL;
 	}
 
-	ppu_read_hook = NULL;
+	ppu_set_read_hook(NULL);
 
 	/* Defaults */
 	ppu->use_scanline_renderer = 1;
+	ppu->scanline_renderer_active = 1;
 	ppu->reset_connected = 1;
 	ppu->no_sprite_limit = 0;
 	ppu->allow_sprite_hiding = 0;
@@ -880,6 +1061,16 @@ int ppu_init(struct emu *emu)
 
 void ppu_cleanup(struct ppu_state *ppu)
 {
+	if (ppu->scanline_renderer_auto) {
+		log_info("PPU: %u frames with scanline renderer, "
+			 "%u with cycle renderer, %u with mid-scanline "
+			 "updates\n", ppu->scanline_renderer_frames,
+			 ppu->cycle_renderer_frames,
+			 ppu->midline_update_frames);
+	}
+
+	persist_renderer_choice(ppu);
+
 	ppu->emu->ppu = NULL;
 	free(ppu);
 }
@@ -903,6 +1094,11 @@ int ppu_apply_config(struct ppu_state *ppu)
 	
 	ppu->use_scanline_renderer =
 		ppu->emu->config->scanline_renderer_enabled;
+	ppu->scanline_renderer_auto =
+		ppu->emu->config->scanline_renderer_auto;
+	ppu->scanline_renderer_unsafe =
+		ppu->emu->config->scanline_renderer_unsafe;
+	update_active_renderer(ppu);
 
 	ppu->translated_palette = ppu->palette;
 	ppu->do_palette_lookup = 0;
@@ -995,6 +1191,8 @@ void ppu_reset(struct ppu_state *ppu, int hard)
 		   should still end at the same time it normally would.
 		*/
 		ppu->cycles = 0;
+		ppu->whole_scanline_start = 0;
+		ppu->whole_scanline_end = 0;
 		ppu->frame_cycles = (241 + ppu->post_render_scanlines +
 				     ppu->vblank_scanlines -
 				     (ppu->scanline + 1)) * 341 -
@@ -1059,6 +1257,8 @@ void ppu_reset(struct ppu_state *ppu, int hard)
 	ppu->ctrl_reg = 0;
 	ppu->rendering = 0;
 	ppu->cycles = 0;
+	ppu->whole_scanline_start = 0;
+	ppu->whole_scanline_end = 0;
 	ppu->scanline = 0;
 	ppu->scanline_cycle = 1;
 	ppu->left_tile_latch = 0;
@@ -1106,6 +1306,17 @@ uint32_t ppu_end_frame(struct ppu_state *ppu, uint32_t cycles)
 	else if (ppu->io_latch_decay < 0)
 		ppu->io_latch_decay = -1;
 
+	if (ppu->scanline_renderer_active)
+		ppu->scanline_renderer_frames++;
+	else
+		ppu->cycle_renderer_frames++;
+
+	select_renderer(ppu);
+
+	/* ppu->cycles is now relative to the new frame */
+	ppu->whole_scanline_start = 0;
+	ppu->whole_scanline_end = 0;
+
 	tmp = ppu->frame_cycles * ppu->ppu_clock_divider;
 	ppu->frame_cycles = (241 + ppu->post_render_scanlines +
 			     ppu->vblank_scanlines) * 341;
@@ -1785,8 +1996,7 @@ static INLINE uint8_t do_bg_tile_fetch(struct ppu_state *ppu)
 	if (ptr)
 		data = ptr[offset | index | fine_y_scroll];
 
-	if (ppu_read_hook)
-		ppu_read_hook(ppu->emu->board, ppu->address_bus);
+	call_read_hook(ppu, ppu->address_bus);
 
 	return data;
 }
@@ -1819,6 +2029,32 @@ static INLINE void sprite_zero_overwrite(struct ppu_state *ppu)
 	}
 }
 
+static void update_frame_hash(struct ppu_state *ppu)
+{
+	uint32_t *pixels;
+	uint64_t hash;
+	int i;
+
+	/* Each pixel is a 9-bit palette index, so hash two at a time */
+	pixels = ppu->pixel_buf + ppu->scanline * 256;
+	hash = FRAME_HASH_BASIS;
+	for (i = 0; i < 256; i += 2) {
+		hash ^= pixels[i] | ((uint64_t)pixels[i + 1] << 32);
+		hash *= FRAME_HASH_PRIME;
+	}
+
+	ppu->scanline_hash[ppu->scanline] = hash;
+
+	if (ppu->scanline == 0)
+		ppu->frame_hash_accum = FRAME_HASH_BASIS;
+
+	ppu->frame_hash_accum ^= hash;
+	ppu->frame_hash_accum *= FRAME_HASH_PRIME;
+
+	if (ppu->scanline == 239)
+		ppu->frame_hash = ppu->frame_hash_accum;
+}
+
 static int do_disabled_scanline(struct ppu_state *ppu, int cycles)
 {
 	int needed;
@@ -2305,6 +2541,172 @@ static INLINE void sprite_eval_scanline(struct ppu_state *ppu)
 	}
 }
 
+static INLINE int render_bg_tile(struct ppu_state *ppu, int left, int right,
+				 int attr, int x_coord) ALWAYS_INLINE;
+static INLINE int render_bg_tile(struct ppu_state *ppu, int left, int right,
+				 int attr, int x_coord)
+{
+	int even, odd;
+	int pixel;
+	int i;
+
+	if (x_coord > 255)
+		return x_coord;
+
+	attr = (attr & 3) << 2;
+
+	even = left & 0x55;
+	even |= (right << 1) & 0xaa;
+
+	odd = (left >> 1) & 0x55;
+	odd |= right & 0xaa;
+
+	for (i = 0; i < 8 && x_coord < 256; i += 2) {
+		pixel = attr | ((odd & 0xc0) >> 6);
+		plot_pixel(ppu, pixel, x_coord);
+		x_coord++;
+		if (x_coord > 255)
+			break;
+
+		pixel = attr | ((even & 0xc0) >> 6);
+		plot_pixel(ppu, pixel, x_coord);
+		x_coord++;
+		even <<= 2;
+		odd <<= 2;
+	}
+
+	return x_coord;
+}
+
+/* Background fetch and render loop for cycles 1-256 of a visible
+   scanline when MMC5 extended attributes or split screen mode may be
+   in use.  This produces the same results as running the generic
+   fetch helpers for each tile, but the split screen row, fine scroll
+   and CHR bank are worked out once for the whole line and each tile
+   column only needs to decide which of the three sources (split
+   screen, extended attributes or normal nametable) it comes from.
+*/
+static void render_mmc5_bg_tiles(struct ppu_state *ppu, int x_coord)
+{
+	uint8_t *split_chr;
+	int split_row, split_fine_y;
+	int split_start, split_end;
+	int exattr;
+	int column;
+	uint16_t bg_table;
+
+	bg_table = bg_pattern_table_address();
+	exattr = (ppu->exram_mode == EXRAM_MODE_EXATTR);
+
+	split_start = 42;
+	split_end = -1;
+	split_chr = NULL;
+	split_row = 0;
+	split_fine_y = 0;
+
+	if (ppu->split_screen_enabled) {
+		split_start = ppu->split_screen_start;
+		split_end = ppu->split_screen_end;
+
+		split_fine_y = (ppu->scanline + ppu->split_screen_scroll) & 0x07;
+		split_row = ((ppu->scanline + ppu->split_screen_scroll) / 8) &
+			0x1f;
+
+		/* See finish_nametable_fetch() */
+		if (ppu->split_screen_scroll < 240 && split_row > 29)
+			split_row = 0;
+
+		if (ppu->chr_rom) {
+			split_chr = ppu->chr_rom +
+				((ppu->split_screen_bank << 12) %
+				 ppu->chr_rom_size);
+		}
+	}
+
+	ppu->scanline_cycle = 1;
+	for (column = 2; column < 34; column++) {
+		uint8_t *ptr, *chr;
+		uint16_t addr;
+		int left, right, attr;
+		int fine_y;
+		int split;
+
+		split = (column >= split_start) && (column <= split_end);
+		chr = NULL;
+
+		if (split) {
+			ppu->nmt_latch =
+				ppu->exram[((split_row << 5) | column) & 0x3ff];
+
+			addr = get_attrtable_entry_addr(ppu);
+			attr = ppu->exram[addr & PPU_PAGE_MASK];
+			attr >>= ((ppu->scroll_address & 0x02) |
+				  (ppu->scroll_address >> 4 & 0x04));
+
+			chr = split_chr;
+			fine_y = split_fine_y;
+		} else {
+			addr = get_nametable_entry_addr(ppu);
+			ptr = ppu->read_bg_pagemap[addr >> PPU_PAGE_SHIFT];
+			ppu->nmt_latch = ptr ? ptr[addr & PPU_PAGE_MASK] : 0;
+
+			if (exattr) {
+				int value;
+
+				value = ppu->exram[ppu->scroll_address & 0x3ff];
+				attr = value >> 6;
+
+				if (ppu->chr_rom) {
+					chr = ppu->chr_rom +
+						(((value & 0x3f) << 12) %
+						 ppu->chr_rom_size);
+				}
+			} else {
+				addr = get_attrtable_entry_addr(ppu);
+				ptr = ppu->read_bg_pagemap[addr >>
+							   PPU_PAGE_SHIFT];
+				attr = ptr ? ptr[addr & PPU_PAGE_MASK] : 0xff;
+				attr >>= ((ppu->scroll_address & 0x02) |
+					  (ppu->scroll_address >> 4 & 0x04));
+			}
+
+			fine_y = ppu->scroll_address >> 12;
+		}
+
+		addr = ppu->nmt_latch << 4 | ppu->scroll_address >> 12 |
+			bg_table;
+
+		if (split || exattr) {
+			/* Split screen and extended attribute tiles
+			   come straight from CHR ROM, bypassing the
+			   pagemap. */
+			left = chr ? chr[(addr & 0xff8) | fine_y] : 0xff;
+			call_read_hook(ppu, addr);
+
+			right = chr ? chr[((addr + 8) & 0xff8) | fine_y] :
+				0xff;
+		} else {
+			ptr = ppu->read_bg_pagemap[addr >> PPU_PAGE_SHIFT];
+			left = ptr ? ptr[addr & PPU_PAGE_MASK] : 0xff;
+			call_read_hook(ppu, addr);
+
+			ptr = ppu->read_bg_pagemap[(addr + 8) >>
+						   PPU_PAGE_SHIFT];
+			right = ptr ? ptr[(addr + 8) & PPU_PAGE_MASK] : 0xff;
+		}
+
+		call_read_hook(ppu, addr + 8);
+
+		update_address_bus(addr + 8);
+
+		ppu->scanline_cycle += 8;
+
+		increment_x_scroll(ppu);
+
+		x_coord = render_bg_tile(ppu, left, right, attr, x_coord);
+	}
+}
+
 static int do_whole_scanline(struct ppu_state *ppu)
 {
 	int x_coord, i;
@@ -2331,52 +2733,31 @@ static int do_whole_scanline(struct ppu_state *ppu)
 		i++;
 	}
 
-	ppu->scanline_cycle = 1;
-	while (ppu->scanline_cycle < 257) {
-		int left, right, attr;
-		int even, odd;
-		int pixel;
-		int i;
-
-		start_nametable_fetch(ppu);
-		finish_nametable_fetch(ppu);
-
-		start_attribute_fetch(ppu);
-		attr = do_attribute_fetch(ppu);
-		attr = (attr & 3) << 2;
-
-		start_left_bg_tile_fetch();
-		left = do_bg_tile_fetch(ppu);
-
-		start_right_bg_tile_fetch();
-		right = do_bg_tile_fetch(ppu);
-
+	if (ppu->exram_mode < EXRAM_MODE_WRAM) {
+		render_mmc5_bg_tiles(ppu, x_coord);
+	} else {
+		ppu->scanline_cycle = 1;
+		while (ppu->scanline_cycle < 257) {
+			int left, right, attr;
 
-		ppu->scanline_cycle += 8;
+			start_nametable_fetch(ppu);
+			finish_nametable_fetch(ppu);
 
-		increment_x_scroll(ppu);
+			start_attribute_fetch(ppu);
+			attr = do_attribute_fetch(ppu);
 
-		if (x_coord > 255)
-			continue;
+			start_left_bg_tile_fetch();
+			left = do_bg_tile_fetch(ppu);
 
-		even = left & 0x55;
-		even |= (right << 1) & 0xaa;
+			start_right_bg_tile_fetch();
+			right = do_bg_tile_fetch(ppu);
 
-		odd = (left >> 1) & 0x55;
-		odd |= right & 0xaa;
+			ppu->scanline_cycle += 8;
 
-		for (i = 0; i < 8 && x_coord < 256; i += 2) {
-			pixel = attr | ((odd & 0xc0) >> 6);
-			plot_pixel(ppu, pixel, x_coord);
-			x_coord++;
-			if (x_coord > 255)
-				break;
+			increment_x_scroll(ppu);
 
-			pixel = attr | ((even & 0xc0) >> 6);
-			plot_pixel(ppu, pixel, x_coord);
-			x_coord++;
-			even <<= 2;
-			odd <<= 2;
+			x_coord = render_bg_tile(ppu, left, right, attr,
+						 x_coord);
 		}
 	}
 
@@ -2453,6 +2834,7 @@ int ppu_run(struct ppu_state *ppu, int cycles)
 
 	ppu->catching_up = 1;
 	cycles /= ppu->ppu_clock_divider;
+	ppu->run_target = cycles;
 
 	return_if_done();
 
@@ -2473,19 +2855,26 @@ int ppu_run(struct ppu_state *ppu, int cycles)
 			}
 
 			if (!RENDERING_ENABLED()) {
-				do_disabled_scanline(ppu, cycles);
-				if (ppu->cycles >= cycles)
+				if (do_disabled_scanline(ppu, cycles) &&
+				    (ppu->cycles >= cycles)) {
 					goto end;
-			} else if (ppu->use_scanline_renderer &&
+				}
+			} else if (ppu->scanline_renderer_active &&
 				   ppu->scanline >= 0 &&
 				   ppu->scanline_cycle == 0 &&
 				   ((cycles - ppu->cycles) >= 341)) {
+				if (ppu->cycles != ppu->whole_scanline_end)
+					ppu->whole_scanline_start = ppu->cycles;
 				do_whole_scanline(ppu);
+				ppu->whole_scanline_end = ppu->cycles;
 			} else if (do_partial_scanline(ppu, cycles)) {
 				if (ppu->cycles >= cycles)
 					goto end;
 			}
 
+			if (ppu->frame_hash_enabled && ppu->scanline >= 0)
+				update_frame_hash(ppu);
+
 			ppu->scanline++;
 			ppu->scanline_cycle = 0;
 
@@ -2635,6 +3024,7 @@ CPU_WRITE_HANDLER(ppu_ctrl_reg_write_handler)
 		return;
 
 	ppu_run(ppu, cycles);
+	check_midline_update(ppu);
 
 	ppu_status = ppu->status_reg;
 	ppu->scroll_address_latch = (ppu->scroll_address_latch &
@@ -2690,6 +3080,7 @@ CPU_WRITE_HANDLER(ppu_mask_reg_write_handler)
 		return;
 
 	ppu_run(ppu, cycles + ppu->ppu_clock_divider);
+	check_midline_update(ppu);
 
 	old_rendering_state = RENDERING_ENABLED();
 
@@ -2835,6 +3226,7 @@ CPU_WRITE_HANDLER(ppu_oam_data_reg_write_handler)
 	uint8_t mask;
 	struct ppu_state *ppu = emu->ppu;
 	ppu_run(ppu, cycles);
+	check_midline_update(ppu);
 
 	mask = 0xff;
 	if (!(ppu->mask_reg & (MASK_REG_BG_ENABLED | MASK_REG_SPRITES_ENABLED))
@@ -2859,6 +3251,7 @@ static CPU_WRITE_HANDLER(write_scroll_reg)
 		return;
 
 	ppu_run(ppu, cycles);
+	check_midline_update(ppu);
 
 	ppu->io_latch = value;
 	ppu->io_latch_decay = ppu->decay_counter_start;
@@ -2892,6 +3285,7 @@ static CPU_WRITE_HANDLER(write_address_reg)
 		return;
 
 	ppu_run(ppu, cycles);
+	check_midline_update(ppu);
 
 	ppu->io_latch = value;
 	ppu->io_latch_decay = ppu->decay_counter_start;
@@ -3040,6 +3434,7 @@ static CPU_WRITE_HANDLER(write_data_reg)
 	struct ppu_state *ppu = emu->ppu;
 
 	ppu_run(ppu, cycles);
+	check_midline_update(ppu);
 
 	address = ppu->scroll_address & 0x3fff;
 	increment_scroll_address(ppu);
@@ -3133,6 +3528,7 @@ void ppu_set_split_screen(struct ppu_state *ppu, int enabled, int right_side,
 			  int startstop, uint32_t cycles)
 {
 	ppu_run(ppu, cycles);
+	check_midline_update(ppu);
 	ppu->split_screen_enabled = enabled;
 	if (right_side) {
 		ppu->split_screen_start = startstop;
@@ -3147,6 +3543,7 @@ void ppu_set_split_screen_scroll(struct ppu_state *ppu, int value,
 				 uint32_t cycles)
 {
 	ppu_run(ppu, cycles);
+	check_midline_update(ppu);
 	ppu->split_screen_scroll = value;
 }
 
@@ -3154,6 +3551,7 @@ void ppu_set_split_screen_bank(struct ppu_state *ppu, int value,
 			       uint32_t cycles)
 {
 	ppu_run(ppu, cycles);
+	check_midline_update(ppu);
 	ppu->split_screen_bank = value;
 }
 
@@ -3193,8 +3591,49 @@ void ppu_set_scanline_renderer(struct ppu_state *ppu, int enabled)
 		enabled = !ppu->use_scanline_renderer;
 
 	ppu->use_scanline_renderer = enabled;
-	osdprintf("Scanline renderer %sabled",
-		  ppu->use_scanline_renderer ? "en" : "dis");
+	update_active_renderer(ppu);
+
+	if (ppu->scanline_renderer_auto) {
+		osdprintf("Scanline renderer %sabled (auto: %u scanline, "
+			  "%u cycle frames)",
+			  ppu->use_scanline_renderer ? "en" : "dis",
+			  ppu->scanline_renderer_frames,
+			  ppu->cycle_renderer_frames);
+	} else {
+		osdprintf("Scanline renderer %sabled",
+			  ppu->use_scanline_renderer ? "en" : "dis");
+	}
+}
+
+void ppu_get_renderer_stats(struct ppu_state *ppu,
+			    unsigned int *scanline_frames,
+			    unsigned int *cycle_frames,
+			    unsigned int *midline_update_frames)
+{
+	*scanline_frames = ppu->scanline_renderer_frames;
+	*cycle_frames = ppu->cycle_renderer_frames;
+	*midline_update_frames = ppu->midline_update_frames;
+}
+
+void ppu_set_frame_hash_enabled(struct ppu_state *ppu, int enabled)
+{
+	ppu->frame_hash_enabled = enabled;
+	ppu->frame_hash = 0;
+	ppu->frame_hash_accum = FRAME_HASH_BASIS;
+	memset(ppu->scanline_hash, 0, sizeof(ppu->scanline_hash));
+}
+
+uint64_t ppu_get_frame_hash(struct ppu_state *ppu)
+{
+	return ppu->frame_hash;
+}
+
+uint64_t ppu_get_scanline_hash(struct ppu_state *ppu, int scanline)
+{
+	if (scanline < 0 || scanline > 239)
+		return 0;
+
+	return ppu->scanline_hash[scanline];
 }
 
 int ppu_save_state(struct ppu_state *ppu, struct save_state *state)
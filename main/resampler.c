@@ -0,0 +1,361 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "resampler.h"
+
+/* SSE2 dot product, selected at runtime.  It sums in the same order
+   as the scalar version, so both give exactly the same output. */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+	!defined(RESAMPLER_NO_SIMD)
+#define RESAMPLER_SIMD 1
+#include <immintrin.h>
+#else
+#define RESAMPLER_SIMD 0
+#endif
+
+/* Taps per phase (a multiple of 4) and number of phases; output
+   between two phases is interpolated linearly. */
+#define TAPS 96
+#define PHASES 128
+
+/* Kaiser window shape; about 70 dB of stopband attenuation */
+#define KAISER_BETA 7.0
+
+/* Cutoff as a fraction of the output Nyquist frequency.  The -6 dB
+   point sits a bit below Nyquist so that what does alias folds back
+   above 20 kHz. */
+#define CUTOFF 0.95
+
+/* Input is buffered in blocks of this many samples on top of what
+   the filter needs */
+#define INPUT_BLOCK 4096
+
+struct resampler {
+	/* (PHASES + 1) rows of TAPS coefficients; row PHASES is the
+	   next sample's row 0, for interpolating past the last phase */
+	float *coeffs;
+
+	float *input;
+	int input_count;
+	int input_size;
+
+	/* Position of the next output sample in input, and the
+	   distance between output samples */
+	double position;
+	double step;
+
+	int16_t *output;
+	int output_start;
+	int output_count;
+	int output_size;
+
+	float (*dot)(const float *a, const float *b);
+};
+
+static float dot_scalar(const float *a, const float *b)
+{
+	float acc[4] = { 0, 0, 0, 0 };
+	int i, j;
+
+	for (i = 0; i < TAPS; i += 4) {
+		for (j = 0; j < 4; j++)
+			acc[j] += a[i + j] * b[i + j];
+	}
+
+	return (acc[0] + acc[2]) + (acc[1] + acc[3]);
+}
+
+#if RESAMPLER_SIMD
+__attribute__((target("sse2")))
+static float dot_sse2(const float *a, const float *b)
+{
+	__m128 acc, tmp;
+	int i;
+
+	acc = _mm_setzero_ps();
+	for (i = 0; i < TAPS; i += 4) {
+		acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(a + i),
+						 _mm_loadu_ps(b + i)));
+	}
+
+	/* (acc0 + acc2) + (acc1 + acc3) */
+	tmp = _mm_movehl_ps(acc, acc);
+	acc = _mm_add_ps(acc, tmp);
+	tmp = _mm_shuffle_ps(acc, acc, _MM_SHUFFLE(1, 1, 1, 1));
+	acc = _mm_add_ss(acc, tmp);
+
+	return _mm_cvtss_f32(acc);
+}
+#endif
+
+/* Zeroth-order modified Bessel function of the first kind */
+static double bessel_i0(double x)
+{
+	double sum, term;
+	int k;
+
+	sum = 1;
+	term = 1;
+	for (k = 1; k < 50; k++) {
+		term *= (x / (2 * k)) * (x / (2 * k));
+		sum += term;
+		if (term < sum * 1e-12)
+			break;
+	}
+
+	return sum;
+}
+
+static void design_filter(struct resampler *resampler, double input_rate,
+			  double output_rate)
+{
+	double cutoff;
+	double norm;
+	int phase;
+	int k;
+
+	/* In cycles per input sample */
+	cutoff = 0.5 * CUTOFF;
+	if (output_rate < input_rate)
+		cutoff *= output_rate / input_rate;
+
+	norm = bessel_i0(KAISER_BETA);
+
+	for (phase = 0; phase <= PHASES; phase++) {
+		float *row = resampler->coeffs + phase * TAPS;
+		double sum;
+
+		sum = 0;
+		for (k = 0; k < TAPS; k++) {
+			double x, w, h, r;
+
+			/* Distance from the output sample to this tap */
+			x = k - (TAPS / 2 - 1) - (double)phase / PHASES;
+
+			h = 2 * cutoff;
+			if (x != 0)
+				h = sin(2 * M_PI * cutoff * x) / (M_PI * x);
+
+			r = x / (TAPS / 2);
+			w = 0;
+			if (r > -1 && r < 1)
+				w = bessel_i0(KAISER_BETA * sqrt(1 - r * r)) / norm;
+
+			row[k] = h * w;
+			sum += h * w;
+		}
+
+		/* Unity gain at DC for every phase */
+		for (k = 0; k < TAPS; k++)
+			row[k] /= sum;
+	}
+}
+
+struct resampler *resampler_new(double input_rate, double output_rate,
+				int output_size)
+{
+	struct resampler *resampler;
+
+	resampler = malloc(sizeof(*resampler));
+	if (!resampler)
+		return NULL;
+
+	memset(resampler, 0, sizeof(*resampler));
+
+	resampler->input_size = TAPS + INPUT_BLOCK;
+	resampler->output_size = output_size;
+	resampler->coeffs = malloc((PHASES + 1) * TAPS *
+				   sizeof(*resampler->coeffs));
+	resampler->input = malloc(resampler->input_size *
+				  sizeof(*resampler->input));
+	resampler->output = malloc(output_size * sizeof(*resampler->output));
+
+	if (!resampler->coeffs || !resampler->input || !resampler->output) {
+		resampler_delete(resampler);
+		return NULL;
+	}
+
+	design_filter(resampler, input_rate, output_rate);
+	resampler_set_rates(resampler, input_rate, output_rate);
+
+	/* Start with the first input sample at the center of the
+	   filter */
+	memset(resampler->input, 0, (TAPS / 2 - 1) * sizeof(*resampler->input));
+	resampler->input_count = TAPS / 2 - 1;
+	resampler->position = TAPS / 2 - 1;
+
+	resampler->dot = dot_scalar;
+#if RESAMPLER_SIMD
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("sse2"))
+		resampler->dot = dot_sse2;
+#endif
+
+	return resampler;
+}
+
+void resampler_delete(struct resampler *resampler)
+{
+	if (!resampler)
+		return;
+
+	free(resampler->coeffs);
+	free(resampler->input);
+	free(resampler->output);
+	free(resampler);
+}
+
+void resampler_set_rates(struct resampler *resampler, double input_rate,
+			 double output_rate)
+{
+	resampler->step = input_rate / output_rate;
+}
+
+int resampler_input_space(struct resampler *resampler)
+{
+	return resampler->input_size - resampler->input_count;
+}
+
+/* Produces as much output as the buffered input allows (and the
+   output buffer has room for), then drops input that's no longer
+   needed. */
+static void resample(struct resampler *resampler)
+{
+	int16_t *out;
+	double position;
+	int end;
+	int count;
+	int drop;
+
+	if (resampler->output_start) {
+		memmove(resampler->output,
+			resampler->output + resampler->output_start,
+			resampler->output_count * sizeof(*resampler->output));
+		resampler->output_start = 0;
+	}
+
+	out = resampler->output + resampler->output_count;
+	count = resampler->output_size - resampler->output_count;
+	position = resampler->position;
+
+	/* The last input sample the filter may reach */
+	end = resampler->input_count - TAPS / 2;
+
+	while (count && (int)position < end) {
+		const float *in, *row;
+		double frac;
+		float a, b;
+		int index;
+		int sample;
+
+		index = (int)position;
+		frac = (position - index) * PHASES;
+		row = resampler->coeffs + (int)frac * TAPS;
+		frac -= (int)frac;
+
+		in = resampler->input + index - (TAPS / 2 - 1);
+		a = resampler->dot(in, row);
+		b = resampler->dot(in, row + TAPS);
+
+		sample = lrint(a + (b - a) * frac);
+		if (sample > 32767)
+			sample = 32767;
+		else if (sample < -32768)
+			sample = -32768;
+
+		*out++ = sample;
+		count--;
+		position += resampler->step;
+	}
+
+	resampler->output_count = out - resampler->output;
+
+	drop = (int)position - (TAPS / 2 - 1);
+	if (drop > resampler->input_count)
+		drop = resampler->input_count;
+
+	if (drop > 0) {
+		memmove(resampler->input, resampler->input + drop,
+			(resampler->input_count - drop) *
+			sizeof(*resampler->input));
+		resampler->input_count -= drop;
+		position -= drop;
+	}
+
+	resampler->position = position;
+}
+
+/* Returns the number of samples accepted, which is less than count
+   only if the input buffer is full (because the output buffer is). */
+int resampler_write(struct resampler *resampler, const int16_t *samples,
+		    int count)
+{
+	int space;
+	int i;
+
+	space = resampler_input_space(resampler);
+	if (count > space)
+		count = space;
+
+	for (i = 0; i < count; i++)
+		resampler->input[resampler->input_count + i] = samples[i];
+
+	resampler->input_count += count;
+	resample(resampler);
+
+	return count;
+}
+
+int resampler_samples_avail(struct resampler *resampler)
+{
+	return resampler->output_count;
+}
+
+/* Like blip_read_samples(): with stereo set, every other sample of
+   out is written */
+int resampler_read_samples(struct resampler *resampler, int16_t *out,
+			   int count, int stereo)
+{
+	const int16_t *in;
+	int step;
+	int i;
+
+	if (count > resampler->output_count)
+		count = resampler->output_count;
+
+	in = resampler->output + resampler->output_start;
+	step = stereo ? 2 : 1;
+
+	for (i = 0; i < count; i++)
+		out[i * step] = in[i];
+
+	resampler->output_start += count;
+	resampler->output_count -= count;
+
+	/* Room may have opened up for input that's waiting */
+	if (resampler->input_count >= TAPS)
+		resample(resampler);
+
+	return count;
+}
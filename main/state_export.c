@@ -0,0 +1,242 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <errno.h>
+#if defined __unix__ || defined __APPLE__
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "emu.h"
+#include "state_export.h"
+
+#define EXPORT_ALIGN(x) (((x) + 63) & ~63)
+#define EXPORT_RAM_SIZE SIZE_2K
+#define EXPORT_WRAM_SIZE SIZE_64K
+#define EXPORT_OAM_SIZE 256
+#define EXPORT_PALETTE_SIZE 32
+#define EXPORT_PIXEL_SIZE (256 * 240 * sizeof(uint32_t))
+
+struct state_export {
+	struct state_export_header *header;
+	uint8_t *base;
+	size_t size;
+	char *name;
+	uint64_t frame;
+};
+
+#if defined __unix__ || defined __APPLE__
+
+static void *state_export_map(struct state_export *export, size_t size)
+{
+	void *base;
+	int fd;
+
+	fd = shm_open(export->name, O_RDWR | O_CREAT, 0600);
+	if (fd < 0)
+		return NULL;
+
+	if (ftruncate(fd, size) < 0) {
+		close(fd);
+		shm_unlink(export->name);
+		return NULL;
+	}
+
+	base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (base == MAP_FAILED) {
+		shm_unlink(export->name);
+		return NULL;
+	}
+
+	return base;
+}
+
+static void state_export_unmap(struct state_export *export)
+{
+	munmap(export->base, export->size);
+	shm_unlink(export->name);
+}
+
+#else
+
+static void *state_export_map(struct state_export *export, size_t size)
+{
+	errno = ENOSYS;
+	return NULL;
+}
+
+static void state_export_unmap(struct state_export *export)
+{
+}
+
+#endif
+
+int state_export_init(struct emu *emu)
+{
+	struct state_export *export;
+	struct state_export_header *header;
+	const char *name;
+	size_t offset;
+
+	name = emu->config->state_export_name;
+	if (!name || !name[0])
+		return 0;
+
+	export = malloc(sizeof(*export));
+	if (!export)
+		return -1;
+
+	memset(export, 0, sizeof(*export));
+
+	/* POSIX shared memory object names start with a slash */
+	export->name = malloc(strlen(name) + 2);
+	if (!export->name) {
+		free(export);
+		return -1;
+	}
+
+	if (name[0] != '/') {
+		export->name[0] = '/';
+		strcpy(export->name + 1, name);
+	} else {
+		strcpy(export->name, name);
+	}
+
+	offset = EXPORT_ALIGN(sizeof(*header));
+	offset += EXPORT_ALIGN(EXPORT_RAM_SIZE);
+	offset += EXPORT_ALIGN(EXPORT_WRAM_SIZE);
+	offset += EXPORT_ALIGN(EXPORT_OAM_SIZE);
+	offset += EXPORT_ALIGN(EXPORT_PALETTE_SIZE);
+	offset += EXPORT_ALIGN(EXPORT_PIXEL_SIZE);
+	export->size = offset;
+
+	export->base = state_export_map(export, export->size);
+	if (!export->base) {
+		log_err("state_export_init: failed to create %s: %s\n",
+			export->name, strerror(errno));
+		free(export->name);
+		free(export);
+		return -1;
+	}
+
+	memset(export->base, 0, export->size);
+
+	header = (struct state_export_header *)export->base;
+	export->header = header;
+
+	offset = EXPORT_ALIGN(sizeof(*header));
+	header->header_size = sizeof(*header);
+	header->total_size = export->size;
+
+	header->ram_offset = offset;
+	header->ram_size = EXPORT_RAM_SIZE;
+	offset += EXPORT_ALIGN(EXPORT_RAM_SIZE);
+
+	header->wram_offset = offset;
+	header->wram_size = 0;
+	offset += EXPORT_ALIGN(EXPORT_WRAM_SIZE);
+
+	header->oam_offset = offset;
+	header->oam_size = EXPORT_OAM_SIZE;
+	offset += EXPORT_ALIGN(EXPORT_OAM_SIZE);
+
+	header->palette_offset = offset;
+	header->palette_size = EXPORT_PALETTE_SIZE;
+	offset += EXPORT_ALIGN(EXPORT_PALETTE_SIZE);
+
+	header->pixel_offset = offset;
+	header->pixel_size = EXPORT_PIXEL_SIZE;
+
+	header->version = STATE_EXPORT_VERSION;
+	__atomic_store_n(&header->magic, STATE_EXPORT_MAGIC,
+			 __ATOMIC_RELEASE);
+
+	emu->state_export = export;
+
+	log_info("Exporting emulator state to shared memory object %s\n",
+		 export->name);
+
+	return 0;
+}
+
+void state_export_cleanup(struct emu *emu)
+{
+	struct state_export *export;
+
+	export = emu->state_export;
+	if (!export)
+		return;
+
+	__atomic_store_n(&export->header->sequence,
+			 export->header->sequence + 1, __ATOMIC_RELAXED);
+	export->header->loaded = 0;
+	__atomic_store_n(&export->header->sequence,
+			 export->header->sequence + 1, __ATOMIC_RELEASE);
+
+	state_export_unmap(export);
+	free(export->name);
+	free(export);
+	emu->state_export = NULL;
+}
+
+/* Called at the end of each emulated frame.  The blocks are copied
+   rather than aliased: the video code converts the PPU's pixel buffer
+   in place before display, and OAM and palette RAM live inside the
+   PPU state.  At ~250KB per frame the copy is negligible next to
+   emulating the frame.
+*/
+void state_export_update(struct emu *emu)
+{
+	struct state_export *export;
+	struct state_export_header *header;
+	uint8_t *wram;
+	size_t wram_size;
+	uint32_t seq;
+
+	export = emu->state_export;
+	header = export->header;
+
+	board_get_wram(emu->board, &wram, &wram_size);
+	if (wram_size > EXPORT_WRAM_SIZE)
+		wram_size = EXPORT_WRAM_SIZE;
+
+	seq = header->sequence;
+	__atomic_store_n(&header->sequence, seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+
+	memcpy(export->base + header->ram_offset, emu->ram,
+	       EXPORT_RAM_SIZE);
+	if (wram)
+		memcpy(export->base + header->wram_offset, wram, wram_size);
+	header->wram_size = wram ? wram_size : 0;
+	memcpy(export->base + header->oam_offset,
+	       ppu_get_oam_ptr(emu->ppu), EXPORT_OAM_SIZE);
+	memcpy(export->base + header->palette_offset,
+	       ppu_get_palette_ptr(emu->ppu), EXPORT_PALETTE_SIZE);
+	memcpy(export->base + header->pixel_offset,
+	       ppu_get_pixel_buffer(emu->ppu), EXPORT_PIXEL_SIZE);
+	header->frame = ++export->frame;
+	header->loaded = 1;
+
+	__atomic_store_n(&header->sequence, seq + 2, __ATOMIC_RELEASE);
+}
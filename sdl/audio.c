@@ -19,11 +19,14 @@
 
 #include <SDL.h>
 #include <SDL_thread.h>
+#include <SDL_atomic.h>
 
 #include "emu.h"
+#include "audio.h"
 #include "blip_buf.h"
+#include "resampler.h"
+#include "audio_filter.h"
 
-int old_diff;
 static double sample_rate;
 static int sdl_audio_buffer_size;
 static int dynamic_rate_enabled;
@@ -38,29 +41,154 @@ static int samples_per_frame;
 static int samples_per_nes_frame;
 static int samples_per_display_frame;
 static int samples_per_larger_frame;
-static int samples_available;
 static int sample_reserve;
 static int channels;
 static int playing;
-static int counter;
-static int last_counter;
-static int old_samples;
-static int frame_count;
-static int high_target; 
-static int low_target;
 static double adjusted_sample_rate;
-static double min_adjusted_sample_rate;
-static double max_adjusted_sample_rate;
-static double safe_min_adjusted_sample_rate;
-static double safe_max_adjusted_sample_rate;
-static int previous_difference;
-static double prev_adjustment;
+
+/* With audio_resampler_rate set, blip synthesizes at that rate and
+   the resampler takes it the rest of the way to the device rate.
+   Rate control then only changes the resampler's step. */
+static struct resampler *resampler;
+static double blip_rate;
+
+/* Output filters, chosen by audio_filter (or, for "auto", by the
+   system type the filters were last set up for). */
+static struct audio_filter output_filter;
+static struct audio_filter stem_filters[AUDIO_STEM_COUNT];
+static enum system_type filter_system_type;
 static double nes_framerate;
 
-static int dynamic_rate_adjustment_delay;
+/* Closed-loop rate control.  The ring fill level seen by the callback
+   is compared against the fill that gives the configured latency, and
+   a PI controller nudges the resampling ratio to hold it there.  The
+   gains are per second of buffered audio; with these the loop is
+   critically damped and settles in well under a minute without
+   audible pitch changes.
+*/
+#define RATE_CONTROL_KP        0.2
+#define RATE_CONTROL_KI        0.01
+#define RATE_CONTROL_SMOOTHING 0.5	/* seconds */
+
+static int device_samples;
+static int target_fill;
+static double rate_control_max;
+static double filtered_error;
+static double error_integral;
+static double rate_ratio;
+
+/* Written by the callback every time it runs: the fill level it found
+   in the ring (before consuming anything), the running sum of those
+   levels and the lowest level since the producer last asked for a
+   reset.
+*/
+static SDL_atomic_t callback_count;
+static SDL_atomic_t callback_fill_sum;
+static SDL_atomic_t callback_fill_min;
+static SDL_atomic_t callback_fill_min_reset;
+static int last_callback_count;
+static int last_callback_fill_sum;
+
+/* Producer-side statistics, in milliseconds */
+static double latency;
+static double latency_min;
+static double latency_max;
+static double latency_sum;
+static int latency_count;
+static double rate_ratio_min;
+static double rate_ratio_max;
+
+static int stats_display;
+static int stats_display_timer;
+
+/* When deferred expansion audio is in use, blip is kept one frame
+   behind the emulator: the frame that just finished stays open (and
+   new deltas are offset past it) until the worker's deltas for it
+   have been added.
+*/
+static int frame_delay_enabled;
+static uint32_t frame_delay_cycles;
+
+/* Gains applied to each chip's deltas and to the stems, in
+   blip_unity_gain units.  Worked out again at the end of each frame
+   and whenever muting changes. */
+static int chip_gains[AUDIO_CHIP_COUNT];
+static int stem_gain;
+
+/* Offline rendering: no device is opened and each frame's samples
+   are handed to render_output as soon as the frame ends. */
+static void (*render_output)(const int16_t *samples, int count, void *data);
+static void *render_data;
+static int16_t *render_buffer;
+
+/* Stem capture, also offline only: every sound source gets its own
+   buffer, fed with levels rather than deltas so that sources don't
+   need to track what they last reported. */
+static void (*stem_output)(int stem, const int16_t *samples, int count,
+			   void *data);
+static void *stem_data;
+static blip_buffer_t *stem_blips[AUDIO_STEM_COUNT];
+static int stem_levels[AUDIO_STEM_COUNT];
+
+static const char *stem_names[AUDIO_STEM_COUNT] = {
+	[AUDIO_STEM_PULSE0] = "pulse1",
+	[AUDIO_STEM_PULSE1] = "pulse2",
+	[AUDIO_STEM_TRIANGLE] = "triangle",
+	[AUDIO_STEM_NOISE] = "noise",
+	[AUDIO_STEM_DMC] = "dmc",
+	[AUDIO_STEM_VRC6_PULSE0] = "vrc6_pulse1",
+	[AUDIO_STEM_VRC6_PULSE1] = "vrc6_pulse2",
+	[AUDIO_STEM_VRC6_SAWTOOTH] = "vrc6_sawtooth",
+	[AUDIO_STEM_VRC7 + 0] = "vrc7_1",
+	[AUDIO_STEM_VRC7 + 1] = "vrc7_2",
+	[AUDIO_STEM_VRC7 + 2] = "vrc7_3",
+	[AUDIO_STEM_VRC7 + 3] = "vrc7_4",
+	[AUDIO_STEM_VRC7 + 4] = "vrc7_5",
+	[AUDIO_STEM_VRC7 + 5] = "vrc7_6",
+	[AUDIO_STEM_NAMCO163 + 0] = "n163_1",
+	[AUDIO_STEM_NAMCO163 + 1] = "n163_2",
+	[AUDIO_STEM_NAMCO163 + 2] = "n163_3",
+	[AUDIO_STEM_NAMCO163 + 3] = "n163_4",
+	[AUDIO_STEM_NAMCO163 + 4] = "n163_5",
+	[AUDIO_STEM_NAMCO163 + 5] = "n163_6",
+	[AUDIO_STEM_NAMCO163 + 6] = "n163_7",
+	[AUDIO_STEM_NAMCO163 + 7] = "n163_8",
+	[AUDIO_STEM_FDS] = "fds",
+	[AUDIO_STEM_MMC5_PULSE0] = "mmc5_pulse1",
+	[AUDIO_STEM_MMC5_PULSE1] = "mmc5_pulse2",
+	[AUDIO_STEM_MMC5_PCM] = "mmc5_pcm",
+	[AUDIO_STEM_SUNSOFT5B + 0] = "5b_a",
+	[AUDIO_STEM_SUNSOFT5B + 1] = "5b_b",
+	[AUDIO_STEM_SUNSOFT5B + 2] = "5b_c",
+};
 
-static SDL_mutex *audiobuf_lock;
-static SDL_cond *audiobuf_cond;
+/* Worker thread for deferred expansion audio; one job at a time */
+static SDL_Thread *worker_thread;
+static SDL_sem *worker_start_sem;
+static SDL_sem *worker_done_sem;
+static void (*worker_func)(void *);
+static void *worker_data;
+static int worker_busy;
+static int worker_quit;
+
+/* Rendered samples are passed to the audio callback through a
+   single-producer/single-consumer ring.  The emulation thread is the
+   only one that advances ring_write and the callback the only one that
+   advances ring_read, so neither side needs a lock and the callback
+   never waits.  Positions count sample frames (one sample per channel)
+   and are allowed to wrap; ring_size is a power of two.
+*/
+static int16_t *ring;
+static int ring_size;
+static SDL_atomic_t ring_read;
+static SDL_atomic_t ring_write;
+static SDL_atomic_t ring_underruns;
+static int reported_underruns;
+
+/* Set while the producer is waiting for space; the callback posts
+   ring_space_sem after consuming samples if so. */
+static SDL_atomic_t producer_waiting;
+static SDL_sem *ring_space_sem;
 
 extern struct emu *emu;
 
@@ -69,20 +197,393 @@ struct audio_state {
 };
 
 static void audio_callback(void* unused, uint8_t* out, int byte_count);
+static void update_gains(void);
 extern void update_clock(int);
 
-void audio_add_delta(struct audio_state *audio, unsigned time, int delta)
+/* Output-rate samples ready to be played */
+static int samples_avail(void)
+{
+	if (resampler)
+		return resampler_samples_avail(resampler);
+
+	return blip_samples_avail(blip);
+}
+
+static enum audio_filter_type filter_type(struct emu *emu)
+{
+	const char *name;
+
+	name = emu->config->audio_filter;
+
+	if (strcasecmp(name, "none") == 0)
+		return AUDIO_FILTER_NONE;
+	else if (strcasecmp(name, "nes") == 0)
+		return AUDIO_FILTER_NES;
+	else if (strcasecmp(name, "famicom") == 0)
+		return AUDIO_FILTER_FAMICOM;
+
+	switch (emu->system_type) {
+	case EMU_SYSTEM_TYPE_FAMICOM:
+	case EMU_SYSTEM_TYPE_FAMICOM_RGB:
+		return AUDIO_FILTER_FAMICOM;
+	default:
+		return AUDIO_FILTER_NES;
+	}
+}
+
+static void setup_filters(struct emu *emu)
 {
+	enum audio_filter_type type;
+	int i;
+
+	type = filter_type(emu);
+	filter_system_type = emu->system_type;
+
+	audio_filter_init(&output_filter, type, sample_rate);
+	for (i = 0; i < AUDIO_STEM_COUNT; i++)
+		audio_filter_init(&stem_filters[i], type, sample_rate);
+}
+
+static int read_samples(int16_t *out, int count, int stereo)
+{
+	if (emu->system_type != filter_system_type)
+		setup_filters(emu);
+
+	if (resampler)
+		count = resampler_read_samples(resampler, out, count, stereo);
+	else
+		count = blip_read_samples(blip, out, count, stereo);
+
+	audio_filter_run(&output_filter, out, count, stereo);
+
+	return count;
+}
+
+/* Moves what blip has into the resampler, as far as it has room */
+static void run_resampler(void)
+{
+	int16_t buf[1024];
+	int count, space;
+
+	while ((count = blip_samples_avail(blip)) > 0) {
+		space = resampler_input_space(resampler);
+		if (count > space)
+			count = space;
+		if (count > 1024)
+			count = 1024;
+		if (!count)
+			break;
+
+		count = blip_read_samples(blip, buf, count, 0);
+		resampler_write(resampler, buf, count);
+	}
+}
+
+/* Creates blip (and the resampler, if blip runs at an internal rate)
+   for size samples of output at sample_rate. */
+static int create_blip(struct emu *emu, int size)
+{
+	blip_rate = sample_rate;
+	if (emu->config->audio_resampler_rate &&
+	    emu->config->audio_resampler_rate != (int)sample_rate) {
+		blip_rate = emu->config->audio_resampler_rate;
+	}
+
+	blip = blip_new(size * blip_rate / sample_rate);
 	if (!blip)
-		return;
+		return 1;
+
+	blip_set_rates(blip, emu->current_clock_rate, blip_rate);
+	update_gains();
 
-	SDL_LockMutex(audiobuf_lock);
+	if (blip_rate != sample_rate) {
+		resampler = resampler_new(blip_rate, sample_rate, size);
+		if (!resampler) {
+			blip_delete(blip);
+			blip = NULL;
+			return 1;
+		}
+
+		log_dbg("Resampling from %.0f Hz\n", blip_rate);
+	}
+
+	setup_filters(emu);
+
+	return 0;
+}
+
+static int ring_fill(void)
+{
+	return (unsigned)SDL_AtomicGet(&ring_write) -
+		(unsigned)SDL_AtomicGet(&ring_read);
+}
+
+/* Moves up to count samples from blip into the ring.  Returns the
+   number actually moved, which is less than count only if the ring is
+   full.  Called only from the emulation thread.
+*/
+static int ring_push(int count)
+{
+	int write, pos, first, space;
+
+	write = SDL_AtomicGet(&ring_write);
+	space = ring_size - ring_fill();
+	if (count > space)
+		count = space;
+
+	if (count <= 0)
+		return 0;
+
+	pos = write & (ring_size - 1);
+	first = ring_size - pos;
+	if (first > count)
+		first = count;
+
+	read_samples(ring + pos * channels, first, channels >> 1);
+	if (count > first)
+		read_samples(ring, count - first, channels >> 1);
+
+	/* Publish the samples only after they've been written */
+	SDL_AtomicSet(&ring_write, write + count);
+
+	return count;
+}
+
+/* A chip's own volume, for chips that have one; the others have per
+   channel volumes, which they apply themselves. */
+static int chip_volume(int chip)
+{
+	switch (chip) {
+	case AUDIO_CHIP_FDS:
+		return emu->config->fds_volume;
+	default:
+		return 100;
+	}
+}
+
+static void update_gains(void)
+{
+	int64_t master;
+	int chip;
+
+	/* Deltas are added unscaled until muting is first set */
 	if (audio_muted > 0)
-		delta = 0;
+		master = 0;
 	else if (!audio_muted)
-		delta = (delta * emu->config->master_volume) / 100;
-	blip_add_delta(blip, time, delta);
-	SDL_UnlockMutex(audiobuf_lock);
+		master = emu->config->master_volume;
+	else
+		master = 100;
+
+	stem_gain = master * blip_unity_gain / 100;
+
+	for (chip = 0; chip < AUDIO_CHIP_COUNT; chip++) {
+		chip_gains[chip] = master * chip_volume(chip) *
+			blip_unity_gain / (100 * 100);
+	}
+}
+
+/* Rounds the same way as blip_add_deltas() */
+static int scale_delta(int gain, int delta)
+{
+	if (gain == blip_unity_gain)
+		return delta;
+
+	return ((int64_t)delta * gain) >> 16;
+}
+
+static void set_stem(int stem, unsigned time, int amplitude)
+{
+	int delta;
+
+	if (stem < 0 || stem >= AUDIO_STEM_COUNT || !stem_blips[stem])
+		return;
+
+	delta = amplitude - stem_levels[stem];
+	if (!delta)
+		return;
+
+	stem_levels[stem] = amplitude;
+	blip_add_delta(stem_blips[stem], time, scale_delta(stem_gain, delta));
+}
+
+/* Stems follow the same timing rules as audio_add_delta() and
+   audio_add_delayed_delta(). */
+void audio_set_stem(struct audio_state *audio, int stem, unsigned time,
+		    int amplitude)
+{
+	set_stem(stem, time + frame_delay_cycles, amplitude);
+}
+
+void audio_set_delayed_stem(struct audio_state *audio, int stem,
+			    unsigned time, int amplitude)
+{
+	set_stem(stem, time, amplitude);
+}
+
+const char *audio_stem_name(int stem)
+{
+	if (stem < 0 || stem >= AUDIO_STEM_COUNT)
+		return NULL;
+
+	return stem_names[stem];
+}
+
+void audio_add_delta(struct audio_state *audio, int chip, unsigned time,
+		     int delta)
+{
+	if (!blip)
+		return;
+
+	blip_add_delta(blip, time + frame_delay_cycles,
+		       scale_delta(chip_gains[chip], delta));
+}
+
+/* Adds a batch of one chip's deltas to the previous frame, which is
+   still open while the frame delay is enabled. */
+void audio_add_delayed_deltas(struct audio_state *audio, int chip,
+			      const uint32_t *times, const int *deltas,
+			      int count)
+{
+	if (!blip)
+		return;
+
+	blip_add_deltas(blip, times, deltas, count, chip_gains[chip]);
+}
+
+static void end_blip_frames(uint32_t cycles)
+{
+	int i;
+
+	blip_end_frame(blip, cycles);
+	update_gains();
+
+	if (resampler)
+		run_resampler();
+
+	if (!emu->audio_stems)
+		return;
+
+	for (i = 0; i < AUDIO_STEM_COUNT; i++)
+		blip_end_frame(stem_blips[i], cycles);
+}
+
+void audio_set_frame_delay(struct audio_state *audio, int enabled)
+{
+	/* Close the pending frame; its samples go to the reserve */
+	if (!enabled && frame_delay_cycles && blip) {
+		int old_samples = samples_avail();
+		end_blip_frames(frame_delay_cycles);
+		sample_reserve += samples_avail() - old_samples;
+	}
+
+	frame_delay_enabled = enabled;
+	frame_delay_cycles = 0;
+}
+
+static int audio_worker_main(void *unused)
+{
+	while (1) {
+		SDL_SemWait(worker_start_sem);
+		if (worker_quit)
+			break;
+
+		worker_func(worker_data);
+		SDL_SemPost(worker_done_sem);
+	}
+
+	return 0;
+}
+
+void audio_worker_wait(void)
+{
+	if (!worker_busy)
+		return;
+
+	SDL_SemWait(worker_done_sem);
+	worker_busy = 0;
+}
+
+void audio_worker_submit(void (*func)(void *), void *data)
+{
+	if (!worker_thread) {
+		worker_start_sem = SDL_CreateSemaphore(0);
+		worker_done_sem = SDL_CreateSemaphore(0);
+		worker_quit = 0;
+		if (worker_start_sem && worker_done_sem) {
+			worker_thread = SDL_CreateThread(audio_worker_main,
+							 "audio worker",
+							 NULL);
+		}
+
+		if (!worker_thread) {
+			log_warn("failed to start audio worker thread: %s\n",
+				 SDL_GetError());
+		}
+	}
+
+	/* Without a thread, just do the work now */
+	if (!worker_thread) {
+		func(data);
+		return;
+	}
+
+	audio_worker_wait();
+	worker_func = func;
+	worker_data = data;
+	worker_busy = 1;
+	SDL_SemPost(worker_start_sem);
+}
+
+void audio_worker_stop(void)
+{
+	if (!worker_thread)
+		return;
+
+	audio_worker_wait();
+	worker_quit = 1;
+	SDL_SemPost(worker_start_sem);
+	SDL_WaitThread(worker_thread, NULL);
+	SDL_DestroySemaphore(worker_start_sem);
+	SDL_DestroySemaphore(worker_done_sem);
+	worker_thread = NULL;
+	worker_start_sem = NULL;
+	worker_done_sem = NULL;
+}
+
+static int render_setup(struct emu *emu)
+{
+	sample_rate = emu->config->sample_rate;
+	channels = 1;
+
+	/* Frames are read out as soon as they end, so a couple of
+	   frames' worth (plus the expansion audio delay) is plenty. */
+	samples_per_larger_frame = sample_rate / emu->user_framerate + 1;
+	audio_buffer_size = 4 * samples_per_larger_frame;
+
+	if (create_blip(emu, audio_buffer_size))
+		return 1;
+
+	render_buffer = malloc(audio_buffer_size * sizeof(*render_buffer));
+	if (!render_buffer)
+		return 1;
+
+	if (stem_output) {
+		int i;
+
+		for (i = 0; i < AUDIO_STEM_COUNT; i++) {
+			stem_blips[i] = blip_new(audio_buffer_size);
+			if (!stem_blips[i])
+				return 1;
+
+			blip_set_rates(stem_blips[i],
+				       emu->current_clock_rate, sample_rate);
+			stem_levels[i] = 0;
+		}
+
+		emu->audio_stems = 1;
+	}
+
+	return 0;
 }
 
 static int audio_setup(struct emu *emu)
@@ -90,15 +591,16 @@ static int audio_setup(struct emu *emu)
 	SDL_AudioSpec wanted, returned;
 	const char *driver_name;
 	int flags;
+	int min_fill;
 
 	if (!emu_loaded(emu))
 		return 0;
 
-	if (!audiobuf_lock)
-		audiobuf_lock = SDL_CreateMutex();
+	if (render_output)
+		return render_setup(emu);
 
-	if (!audiobuf_cond)
-		audiobuf_cond = SDL_CreateCond();
+	if (!ring_space_sem)
+		ring_space_sem = SDL_CreateSemaphore(0);
 
 	sample_rate = emu->config->sample_rate;
 	sdl_audio_buffer_size = emu->config->audio_buffer_size;
@@ -166,61 +668,75 @@ static int audio_setup(struct emu *emu)
 
 	sample_rate = returned.freq;
 	adjusted_sample_rate = returned.freq;
-	max_adjusted_sample_rate = sample_rate *
-	    (1.0 + emu->config->dynamic_rate_adjustment_max);
-	min_adjusted_sample_rate = sample_rate * 
-	    (1.0 - emu->config->dynamic_rate_adjustment_max);
-	safe_max_adjusted_sample_rate = sample_rate *
-	    (1.0 + 0.005);
-	safe_min_adjusted_sample_rate = sample_rate * 
-	    (1.0 - 0.005);
 	channels = returned.channels;
+	device_samples = returned.samples;
 
 	if (channels < 1 || channels > 2) {
 		log_err("Unsupported number of channels %d\n", channels);
 		return 1;
 	}
 
+	/* The callback takes device_samples at a time, so the ring
+	   has to hold at least that much when it runs, plus a frame
+	   to absorb jitter in when frames are produced.  Latency is
+	   what's in the ring plus what the device is playing.
+	*/
+	min_fill = device_samples + samples_per_larger_frame;
+	if (emu->config->audio_latency_target) {
+		target_fill = emu->config->audio_latency_target *
+			sample_rate / 1000 - device_samples;
+		if (target_fill < min_fill) {
+			log_warn("audio_latency_target %d ms is too low for "
+				 "a %d sample buffer; using %d ms\n",
+				 emu->config->audio_latency_target,
+				 device_samples,
+				 (int)((min_fill + device_samples) * 1000 /
+				       sample_rate));
+			target_fill = min_fill;
+		}
+	} else {
+		target_fill = min_fill + samples_per_larger_frame;
+	}
+
 	/* Allocate a bit more storage than requested to handle larger
 	   frames due to A) dynamic sample rate adjustment and B)
 	   frames that go past the desired frame length due to DMA or
 	   instruction length of the last executed instruction.
 	*/
-	/* printf("returned: %d, samples %d\n", returned.samples, samples_per_nes_frame); */
 	audio_buffer_size = (2 * (returned.samples /
 				  samples_per_larger_frame + 1) + 1)* samples_per_larger_frame;
-	
+	if (audio_buffer_size < target_fill + 2 * samples_per_larger_frame)
+		audio_buffer_size = target_fill + 2 * samples_per_larger_frame;
+
+	/* Room for the frame held open by the expansion audio delay,
+	   which may be enabled after the buffer is created. */
+	audio_buffer_size += samples_per_larger_frame;
 
-	blip = blip_new(audio_buffer_size * 1.03);
-	if ( blip == NULL )
+	if (create_blip(emu, audio_buffer_size * 1.03))
 		return 1;
 
-	log_dbg("sample_rate: %f\n", sample_rate);
-	blip_set_rates(blip, emu->current_clock_rate, sample_rate);
+	/* The ring only needs to hold audio_buffer_size samples, plus
+	   a couple of frames of slack for long frames. */
+	ring_size = 1;
+	while (ring_size < audio_buffer_size + 2 * samples_per_larger_frame)
+		ring_size <<= 1;
+
+	ring = malloc(ring_size * channels * sizeof(*ring));
+	if (!ring) {
+		blip_delete(blip);
+		blip = NULL;
+		resampler_delete(resampler);
+		resampler = NULL;
+		return 1;
+	}
 
-	low_target = sdl_audio_buffer_size % samples_per_frame;
-	low_target = low_target +
-		(emu->config->dynamic_rate_adjustment_low_watermark *
-		 samples_per_frame);
-	high_target = low_target +
-		(emu->config->dynamic_rate_adjustment_buffer_range *
-		 samples_per_frame);
+	log_dbg("sample_rate: %f\n", sample_rate);
+	log_dbg("audio latency target: %.1f ms\n",
+		(target_fill + device_samples) * 1000 / sample_rate);
 
-        dynamic_rate_enabled =
+	dynamic_rate_enabled =
 		emu->config->dynamic_rate_adjustment_enabled;
-	if (blip && dynamic_rate_enabled) {
-               frame_count = 0;
-               adjusted_sample_rate = sample_rate;
-               max_adjusted_sample_rate = sample_rate *
-                   (1.0 + emu->config->dynamic_rate_adjustment_max);
-               min_adjusted_sample_rate = sample_rate *
-                   (1.0 - emu->config->dynamic_rate_adjustment_max);
-               last_counter = 0;
-               previous_difference = 0;
-               old_samples = 0;
-               counter = 0;
-       }
-	
+	rate_control_max = emu->config->dynamic_rate_adjustment_max;
 
 	return 0;
 }
@@ -243,21 +759,83 @@ int audio_init(struct emu *emu)
 	sample_rate = 0;
 	sdl_audio_buffer_size = 0;
 	blip = NULL;
-	dynamic_rate_adjustment_delay = -1;
-	samples_available = 0;
 	sample_reserve = 0;
+	resampler = NULL;
+	frame_delay_cycles = 0;
+	ring = NULL;
+	ring_size = 0;
+	SDL_AtomicSet(&ring_read, 0);
+	SDL_AtomicSet(&ring_write, 0);
+	SDL_AtomicSet(&ring_underruns, 0);
+	SDL_AtomicSet(&producer_waiting, 0);
+	reported_underruns = 0;
+
+	SDL_AtomicSet(&callback_count, 0);
+	SDL_AtomicSet(&callback_fill_sum, 0);
+	SDL_AtomicSet(&callback_fill_min, 0);
+	SDL_AtomicSet(&callback_fill_min_reset, 1);
+	last_callback_count = 0;
+	last_callback_fill_sum = 0;
+	filtered_error = 0;
+	error_integral = 0;
+	rate_ratio = 0;
+	rate_ratio_min = 0;
+	rate_ratio_max = 0;
+	latency = 0;
+	latency_min = 0;
+	latency_max = 0;
+	latency_sum = 0;
+	latency_count = 0;
+	device_samples = 0;
+	target_fill = 0;
 	return 0;
 }
 
+static void audio_dump_stats(void)
+{
+	int underruns;
+
+	if (!latency_count)
+		return;
+
+	underruns = SDL_AtomicGet(&ring_underruns);
+
+	log_dbg("Audio latency: target %.1f ms, average %.1f ms, "
+		"min %.1f ms, max %.1f ms\n",
+		(target_fill + device_samples) * 1000 / sample_rate,
+		latency_sum / latency_count, latency_min, latency_max);
+	log_dbg("Audio rate adjustment: %+.3f%% to %+.3f%%, "
+		"%d callbacks, %d underruns\n",
+		rate_ratio_min * 100, rate_ratio_max * 100,
+		SDL_AtomicGet(&callback_count), underruns);
+}
+
 int audio_cleanup(struct audio_state *audio)
 {
+	int i;
+
+	audio->emu->audio_stems = 0;
 	audio->emu->audio = NULL;
 	free(audio);
 
-	SDL_PauseAudioDevice(sdl_audio_device, 1 );
-	SDL_CloseAudioDevice(sdl_audio_device);
+	if (sdl_audio_device >= 0) {
+		SDL_PauseAudioDevice(sdl_audio_device, 1 );
+		SDL_CloseAudioDevice(sdl_audio_device);
+	}
+	audio_dump_stats();
 	playing = 0;
 	blip_delete( blip );
+	resampler_delete(resampler);
+	resampler = NULL;
+	free(render_buffer);
+	render_buffer = NULL;
+	for (i = 0; i < AUDIO_STEM_COUNT; i++) {
+		blip_delete(stem_blips[i]);
+		stem_blips[i] = NULL;
+	}
+	free(ring);
+	ring = NULL;
+	ring_size = 0;
 	sdl_audio_device = -1;
 	dynamic_rate_enabled = 0;
 	force_stereo = 0;
@@ -273,7 +851,7 @@ int audio_apply_config(struct audio_state *audio)
 	struct emu *emu;
 	emu = audio->emu;
 
-	if (sdl_audio_device >= 0) {
+	if (sdl_audio_device >= 0 || render_buffer) {
 		/* FIXME flush existing audio data */
 		audio_cleanup(emu->audio);
 	}
@@ -283,36 +861,52 @@ int audio_apply_config(struct audio_state *audio)
 	return 0;
 }
 
+/* Runs on the SDL audio thread.  Only reads from the ring and never
+   blocks; underruns are counted here and reported by the producer.
+*/
 static void audio_callback(void* unused, uint8_t* out, int byte_count)
 {
 	int samples_requested, samples;
-	int actual_samples_available;
+	int read, pos, first;
+	int frame_bytes;
 
-	SDL_LockMutex(audiobuf_lock);
-	samples_requested = byte_count / (2 * channels);
-	actual_samples_available = blip_samples_avail(blip);
+	frame_bytes = 2 * channels;
+	samples_requested = byte_count / frame_bytes;
 
-//	printf("consume\n");
+	read = SDL_AtomicGet(&ring_read);
+	samples = (unsigned)SDL_AtomicGet(&ring_write) - (unsigned)read;
 
-	samples = samples_requested;
-	if (samples_available < samples_requested) {
-		log_dbg("%d samples requested, only %d buffered: %d\n",
-			samples_requested, samples_available, previous_difference);
-		samples = samples_available;
-		memset(out, 0, byte_count);
+	SDL_AtomicAdd(&callback_fill_sum, samples);
+	if (SDL_AtomicCAS(&callback_fill_min_reset, 1, 0) ||
+	    samples < SDL_AtomicGet(&callback_fill_min)) {
+		SDL_AtomicSet(&callback_fill_min, samples);
 	}
+	SDL_AtomicAdd(&callback_count, 1);
 
-	samples_available -= samples;
-
-	blip_read_samples(blip, (short *)out, samples, channels >> 1);
+	if (samples < samples_requested) {
+		SDL_AtomicAdd(&ring_underruns, 1);
+		memset(out + samples * frame_bytes, 0,
+		       byte_count - samples * frame_bytes);
+	} else {
+		samples = samples_requested;
+	}
 
-	SDL_UnlockMutex(audiobuf_lock);
+	pos = read & (ring_size - 1);
+	first = ring_size - pos;
+	if (first > samples)
+		first = samples;
 
-	if (audio_buffer_size - (actual_samples_available -
-				 (byte_count / 2)) >
-	    samples_per_larger_frame * 2) {
-		SDL_CondBroadcast(audiobuf_cond);
+	memcpy(out, ring + pos * channels, first * frame_bytes);
+	if (samples > first) {
+		memcpy(out + first * frame_bytes, ring,
+		       (samples - first) * frame_bytes);
 	}
+
+	/* Hand the space back to the producer once the copy is done */
+	SDL_AtomicSet(&ring_read, read + samples);
+
+	if (SDL_AtomicGet(&producer_waiting))
+		SDL_SemPost(ring_space_sem);
 }
 
 void audio_pause(int paused)
@@ -331,73 +925,258 @@ int audio_buffer_check(void)
 	if (!playing)
 		return 1;
 
-	SDL_LockMutex(audiobuf_lock);
-	samples = samples_available + sample_reserve;
+	samples = ring_fill() + sample_reserve;
 
 	buffer_remaining = audio_buffer_size - samples;
 	rc = 1;
 
-	/* FIXME HACK ALERT!
-	   The following code *seems* to work, but I
-	   can't make any guarantees at the moment.
-
-	   If we have less than two frames' worth of samples, don't
-	   delay at all.  This is to avoid buffer underruns.
-
-	   To avoid overruns, if there is less than one frame's
-	   samples buffer_remaining to be filled, then wait for the audio
-	   consumer thread to use at least one frames' worth of audio.
+	/* The producer blocks only when the ring can't take another
+	   frame of audio, until the callback has consumed enough to
+	   make room.  Otherwise it returns straight away.
 	 */
 	if (buffer_remaining < samples_per_nes_frame) {
+		/* Only the producer blocks.  The flag is set before
+		   re-checking the fill level so a callback that runs in
+		   between is guaranteed to post the semaphore; the timeout
+		   covers the device being paused with a full ring.
+		*/
+		SDL_AtomicSet(&producer_waiting, 1);
 		while (buffer_remaining < samples_per_nes_frame) {
-			SDL_CondWait(audiobuf_cond, audiobuf_lock);
-			samples = samples_available + sample_reserve;
+			samples = ring_fill() + sample_reserve;
 			buffer_remaining = audio_buffer_size - samples;
+			if (buffer_remaining >= samples_per_nes_frame)
+				break;
+
+			SDL_SemWaitTimeout(ring_space_sem, 10);
 		}
-		SDL_UnlockMutex(audiobuf_lock);
+		SDL_AtomicSet(&producer_waiting, 0);
+		while (SDL_SemTryWait(ring_space_sem) == 0)
+			;
+
 		update_clock(1);
 		return 1;
 	}
 
+	/* With rate control the fill level is held at the target and
+	   frames are never skipped.  Without it, fall back to skipping
+	   the next frame when the buffer is running low to stuff more
+	   audio data into it before the callback runs again. */
+	if (dynamic_rate_enabled)
+		return rc;
+
 	skip_watermark = (sdl_audio_buffer_size % samples_per_frame) / 2;
-	/* Audio buffer is running low; skip the next frame to stuff more
-	   audio data into the buffer before the callback runs again. */
-	if (samples_available < skip_watermark) {
+	samples = ring_fill();
+	if (samples < skip_watermark) {
 		rc = 0;
-		dynamic_rate_adjustment_delay = 10;
-		log_dbg("skipping: %d < %d\n", samples_available, skip_watermark);
+		log_dbg("skipping: %d < %d\n", samples, skip_watermark);
 	}
 
-	SDL_UnlockMutex(audiobuf_lock);
-
 	return rc;
 }
 
-void audio_fill_buffer(struct audio_state *audio, uint32_t cycles)
+/* Takes the callback measurements made since the last call, updates
+   the latency statistics and, if enabled, runs one step of the rate
+   controller.
+*/
+static void update_rate_control(void)
 {
-//	double level;
-	int samples;
-	int do_adjust;
-	double adjustment;
-	int difference;
+	int count, delta_count;
+	unsigned int fill_sum;
+	double average, error, dt, alpha;
+	double integral, ratio;
+
+	count = SDL_AtomicGet(&callback_count);
+	delta_count = count - last_callback_count;
+	if (delta_count <= 0)
+		return;
 
-	difference = 0;
-	adjustment = 0;
+	fill_sum = SDL_AtomicGet(&callback_fill_sum);
+	average = (double)(fill_sum - (unsigned int)last_callback_fill_sum) /
+		delta_count;
+	last_callback_count = count;
+	last_callback_fill_sum = fill_sum;
+
+	/* Samples still waiting in blip will be played too */
+	average += sample_reserve;
+
+	latency = (average + device_samples) * 1000 / sample_rate;
+	if (!latency_count || latency < latency_min)
+		latency_min = latency;
+	if (!latency_count || latency > latency_max)
+		latency_max = latency;
+	latency_sum += latency;
+	latency_count++;
+
+	if (!dynamic_rate_enabled)
+		return;
+
+	/* Error in seconds of audio, over the time these callbacks
+	   covered */
+	error = (average - target_fill) / sample_rate;
+	dt = (double)delta_count * device_samples / sample_rate;
+
+	alpha = dt / (RATE_CONTROL_SMOOTHING + dt);
+	filtered_error += alpha * (error - filtered_error);
+
+	integral = error_integral + filtered_error * dt;
+	ratio = -(RATE_CONTROL_KP * filtered_error +
+		  RATE_CONTROL_KI * integral);
+
+	/* Only integrate while unsaturated so the controller doesn't
+	   wind up during long stalls. */
+	if (ratio > rate_control_max)
+		ratio = rate_control_max;
+	else if (ratio < -rate_control_max)
+		ratio = -rate_control_max;
+	else
+		error_integral = integral;
+
+	rate_ratio = ratio;
+	if (rate_ratio < rate_ratio_min)
+		rate_ratio_min = rate_ratio;
+	if (rate_ratio > rate_ratio_max)
+		rate_ratio_max = rate_ratio;
+
+	adjusted_sample_rate = sample_rate * (1.0 + rate_ratio);
+	if (resampler) {
+		resampler_set_rates(resampler, blip_rate,
+				    adjusted_sample_rate);
+	} else {
+		blip_set_rates(blip, emu->current_clock_rate,
+			       adjusted_sample_rate);
+	}
+	samples_per_frame = adjusted_sample_rate / emu->current_framerate;
+}
+
+void audio_show_stats(void)
+{
+	int min_fill;
+
+	if (!blip || !playing) {
+		osdprintf("Audio not playing");
+		return;
+	}
+
+	/* Lowest fill since the last time stats were shown */
+	min_fill = SDL_AtomicGet(&callback_fill_min);
+	SDL_AtomicSet(&callback_fill_min_reset, 1);
+
+	osdprintf("Audio latency %.1f ms (target %.1f), "
+		  "min buffer %.1f ms, rate %+.3f%%, %d underruns",
+		  latency, (target_fill + device_samples) * 1000 / sample_rate,
+		  min_fill * 1000 / sample_rate, rate_ratio * 100,
+		  SDL_AtomicGet(&ring_underruns));
+}
+
+void audio_toggle_stats(int enabled)
+{
+	if (enabled < 0)
+		enabled = !stats_display;
+
+	stats_display = enabled;
+	stats_display_timer = 0;
+
+	if (!stats_display)
+		osdprintf("Audio stats off");
+}
+
+/* Sends samples to a callback instead of an audio device; takes effect
+   the next time the audio config is applied. */
+void audio_set_render_output(void (*output)(const int16_t *samples,
+					    int count, void *data),
+			     void *data)
+{
+	render_output = output;
+	render_data = data;
+}
+
+/* Like audio_set_render_output(), but for each sound source on its
+   own.  Only used while rendering. */
+void audio_set_stem_output(void (*output)(int stem, const int16_t *samples,
+					  int count, void *data),
+			   void *data)
+{
+	stem_output = output;
+	stem_data = data;
+}
+
+static void end_frame(uint32_t cycles)
+{
+	if (frame_delay_enabled) {
+		/* End the previous frame now that all of its deltas
+		   are in; this one stays open. */
+		if (frame_delay_cycles)
+			end_blip_frames(frame_delay_cycles);
+		frame_delay_cycles = cycles;
+	} else {
+		end_blip_frames(cycles);
+	}
+}
+
+static void render_frame(uint32_t cycles)
+{
+	int count;
+	int i;
+
+	if (!cycles)
+		return;
+
+	end_frame(cycles);
+
+	while ((count = samples_avail()) > 0) {
+		if (count > audio_buffer_size)
+			count = audio_buffer_size;
+
+		count = read_samples(render_buffer, count, 0);
+		render_output(render_buffer, count, render_data);
+
+		/* Anything left waiting for room in the resampler */
+		if (resampler)
+			run_resampler();
+	}
+
+	if (!emu->audio_stems)
+		return;
+
+	for (i = 0; i < AUDIO_STEM_COUNT; i++) {
+		while ((count = blip_samples_avail(stem_blips[i])) > 0) {
+			if (count > audio_buffer_size)
+				count = audio_buffer_size;
+
+			count = blip_read_samples(stem_blips[i], render_buffer,
+						  count, 0);
+			audio_filter_run(&stem_filters[i], render_buffer,
+					 count, 0);
+			stem_output(i, render_buffer, count, stem_data);
+		}
+	}
+}
+
+void audio_fill_buffer(struct audio_state *audio, uint32_t cycles)
+{
+	int underruns;
 
 	if (!blip)
 		return;
 
-//	printf("produce\n");
+	if (render_output) {
+		render_frame(cycles);
+		return;
+	}
+
+	underruns = SDL_AtomicGet(&ring_underruns);
+	if (underruns != reported_underruns) {
+		log_dbg("audio underrun (%d total), latency %.1f ms\n",
+			underruns, latency);
+		reported_underruns = underruns;
+	}
 
-	counter++;
-	samples = samples_available;
-	SDL_LockMutex(audiobuf_lock);
 	if (cycles) {
 		int old_samples, new_samples, sample_count;
 		int tmp;
-		old_samples = blip_samples_avail(blip);
-		blip_end_frame(blip, cycles);
-		new_samples = blip_samples_avail(blip);
+		old_samples = samples_avail();
+		end_frame(cycles);
+		new_samples = samples_avail();
 		sample_count = new_samples - old_samples;
 		tmp = sample_count;
 		if (emu->frame_timer_reload) {
@@ -414,8 +1193,8 @@ void audio_fill_buffer(struct audio_state *audio, uint32_t cycles)
 				}
 			}
 		}
-		samples_available += tmp;
-//		printf("adding %d samples %f (%d) (%d s %d)\n", tmp, adjusted_sample_rate, samples_per_display_frame, sample_count, samples_per_nes_frame);
+		/* Anything that doesn't fit stays in blip as reserve */
+		tmp = ring_push(tmp);
 		sample_reserve += sample_count - tmp;
 	} else {
 		if (emu->frame_timer_reload) {
@@ -424,138 +1203,42 @@ void audio_fill_buffer(struct audio_state *audio, uint32_t cycles)
 				/* 	samples_available += samples_per_display_frame; */
 				/* 	sample_reserve -= samples_per_display_frame; */
 				/* } else { */
-//					printf("here: %d %d\n", sample_reserve, emu->frame_timer_reload);
-					samples_available += sample_reserve;
-					sample_reserve = 0;
+					sample_reserve -= ring_push(sample_reserve);
 				/* } */
 			} else {
-				samples_available += sample_reserve;
-				sample_reserve = 0;
+				sample_reserve -= ring_push(sample_reserve);
 			}
 		}
 	}
-//	level = (double)samples / audio_buffer_size;
-	do_adjust = 0;
 
+	/* Hold playback until the ring has reached the target fill so
+	   the controller starts from the right place instead of
+	   underrunning for the first few callbacks. */
 	if (!playing) {
-//		if (samples >= sdl_audio_buffer_size) {
+		if (ring_fill() >= target_fill) {
 			playing = 1;
 			SDL_PauseAudioDevice(sdl_audio_device, 0);
-//		}
-	} else if (dynamic_rate_enabled && (samples < old_samples) &&
-		   (dynamic_rate_adjustment_delay < 0)) {
-		if (samples < low_target)
-			difference = samples - low_target;
-		else if (samples > high_target)
-			difference = samples - high_target;
-		else
-			difference = 0;
-
-		if (difference) {
-			do_adjust = 1;
-
-			adjustment = (double)difference / counter;
-			adjustment *= emu->current_framerate;
-			adjustment *= -1.2;
-
-			/* Limit this adjustment to +/- 0.1% */
-			if (adjustment > sample_rate * 0.001) {
-				adjustment = sample_rate * 0.001;
-			} else if (adjustment < sample_rate * -0.001) {
-				adjustment = sample_rate * -0.001;
-			}
-
-			if (!previous_difference) {
-				/* Don't make any adjustments the first time through; just keep
-				   track of the difference for the next pass.
-				*/
-				do_adjust = 0;
-				previous_difference = difference;
-			} else if (((difference > 0) && (previous_difference < 0)) ||
-				   ((difference < 0) && (previous_difference > 0))) {
-				/* we've switched direction from the last time we adjusted, so
-				   update the count to indicate the number of frames that we've
-				   run in this direction.
-				*/
-				last_counter = counter;
-				counter = 0;
-				/* printf("here\n"); */
-			} else if (((difference < 0) && ((difference < previous_difference))) ||
-							 ((previous_difference == 0) && (
-								 (difference == 0))) ||
-				   ((difference > 0) && (difference > previous_difference))) {
-				/* we're going the same direction as the previous difference, and
-				   it appears we're moving away from the target.
-				*/
-//				last_counter = counter;
-			} else {
-				do_adjust = 0;
-			}
-
-
-			if (do_adjust) {
-				/* Save difference so we can remember the direction
-				   we adjusted in */
-				old_diff = previous_difference;
-				previous_difference = difference;
-				prev_adjustment = adjustment;
-			}
-
 		}
-	} else if (dynamic_rate_enabled && (samples < old_samples) &&
-		   (dynamic_rate_adjustment_delay >= 0)) {
-		adjustment = sample_rate * 0.001;
-		do_adjust = 1;
-	} else if (dynamic_rate_enabled) {
-	}
-		frame_count++;
-
-	if (do_adjust) {
-		/* Limit resampled_rate to sample_rate +/- 0.05%.
-		   This should prevent huge adjustments that would
-		   result in audible pitch changes.
-		*/
-		adjusted_sample_rate += adjustment;
-		if (adjusted_sample_rate > max_adjusted_sample_rate)
-			adjusted_sample_rate = max_adjusted_sample_rate;
-		else if (adjusted_sample_rate < min_adjusted_sample_rate)
-			adjusted_sample_rate = min_adjusted_sample_rate;
-
-		if (adjusted_sample_rate > safe_max_adjusted_sample_rate) {
-			log_dbg("Adjustment exceeded safe limits: %f > %f\n",
-				adjusted_sample_rate, safe_max_adjusted_sample_rate);
-		} else if (adjusted_sample_rate < safe_min_adjusted_sample_rate) {
-			log_dbg("Adjustment exceeded safe limits: %f < %f\n",
-				adjusted_sample_rate, safe_min_adjusted_sample_rate);
-		}
-
-		/* printf("%d: new_rate: %f, prev: %d diff: %d low: %d high: %d level: %d\n", */
-		/*        frame_count, adjusted_sample_rate, old_diff, difference, low_target, */
-		/*        high_target, samples); */
-		/* printf("last_counter: %d, counter: %d\n", last_counter, counter); */
-		blip_set_rates(blip, emu->current_clock_rate, adjusted_sample_rate);
-		samples_per_frame = adjusted_sample_rate / emu->current_framerate;
-		low_target = (sdl_audio_buffer_size % samples_per_frame) / 2;
-		low_target += emu->config->dynamic_rate_adjustment_low_watermark *
-			samples_per_frame;
-		high_target = emu->config->dynamic_rate_adjustment_buffer_range *
-			samples_per_frame + low_target;
-
+		return;
 	}
 
-	if (dynamic_rate_adjustment_delay >= 0)
-		dynamic_rate_adjustment_delay--;
+	update_rate_control();
 
-	old_samples = samples;
-
-	SDL_UnlockMutex(audiobuf_lock);
+	if (stats_display) {
+		stats_display_timer--;
+		if (stats_display_timer <= 0) {
+			audio_show_stats();
+			stats_display_timer = nes_framerate;
+		}
+	}
 }
 
 void audio_mute(int muted)
 {
-	SDL_LockMutex(audiobuf_lock);
 	audio_muted = !!muted;
-	SDL_UnlockMutex(audiobuf_lock);
+
+	if (emu)
+		update_gains();
 }
 
 void audio_reset(struct audio_state *audio)
@@ -18,6 +18,7 @@
 */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #if _WIN32
@@ -25,6 +26,7 @@
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
 #include <direct.h>
+#include <io.h>
 #include <errno.h>
 #define mkdir(path, mode) _mkdir(path)
 #else
@@ -196,6 +198,188 @@ int writefile(const char *name, uint8_t *buf, uint32_t size)
 	return 0;
 }
 
+/* Write file "name" without ever leaving a partially-written copy
+   behind: the data goes to "name.tmp" first, which is flushed to disk
+   and then renamed over the original.  Errors are only logged, since
+   this may be called from the writer thread. */
+int writefile_atomic(const char *name, const uint8_t *buf, uint32_t size)
+{
+	FILE *file;
+	char *tmp;
+	size_t len;
+	int rc;
+
+	if (create_directory(name, 1, 1))
+		return -1;
+
+	len = strlen(name) + 5;
+	tmp = malloc(len);
+	if (!tmp)
+		return -1;
+
+	snprintf(tmp, len, "%s.tmp", name);
+
+	file = fopen(tmp, "wb");
+	if (!file) {
+		log_err("%s: %s\n", tmp, strerror(errno));
+		free(tmp);
+		return -1;
+	}
+
+	rc = 0;
+	if (size && (fwrite(buf, size, 1, file) < 1))
+		rc = 1;
+
+	if (fflush(file))
+		rc = 1;
+
+#if _WIN32
+	if (!rc && _commit(_fileno(file)))
+		rc = 1;
+#else
+	if (!rc && fsync(fileno(file)))
+		rc = 1;
+#endif
+
+	if (fclose(file))
+		rc = 1;
+
+	if (rc) {
+		log_err("%s: %s\n", tmp, strerror(errno));
+		remove(tmp);
+		free(tmp);
+		return rc;
+	}
+
+#if _WIN32
+	if (!MoveFileEx(tmp, name, MOVEFILE_REPLACE_EXISTING |
+			MOVEFILE_WRITE_THROUGH)) {
+		rc = 1;
+	}
+#else
+	if (rename(tmp, name))
+		rc = 1;
+#endif
+
+	if (rc) {
+		log_err("failed to rename %s to %s\n", tmp, name);
+		remove(tmp);
+	}
+
+	free(tmp);
+
+	return rc;
+}
+
+/* Background writer for writefile_async().  Only one write is ever
+   in flight; submitting another waits for the previous one. */
+static SDL_Thread *writer_thread;
+static SDL_sem *writer_start_sem;
+static SDL_sem *writer_done_sem;
+static char *writer_name;
+static uint8_t *writer_buf;
+static uint32_t writer_size;
+static int writer_busy;
+static int writer_quit;
+
+static int writer_main(void *unused)
+{
+	while (1) {
+		SDL_SemWait(writer_start_sem);
+		if (writer_quit)
+			break;
+
+		if (writefile_atomic(writer_name, writer_buf, writer_size)) {
+			log_err("failed to write file \"%s\"\n",
+				writer_name);
+		}
+
+		SDL_SemPost(writer_done_sem);
+	}
+
+	return 0;
+}
+
+void writefile_async_wait(void)
+{
+	if (!writer_busy)
+		return;
+
+	SDL_SemWait(writer_done_sem);
+	writer_busy = 0;
+}
+
+/* Write a copy of "buf" to "name" on the writer thread.  The caller
+   may reuse buf as soon as this returns. */
+int writefile_async(const char *name, const uint8_t *buf, uint32_t size)
+{
+	char *name_copy;
+	uint8_t *buf_copy;
+
+	if (!writer_thread) {
+		writer_start_sem = SDL_CreateSemaphore(0);
+		writer_done_sem = SDL_CreateSemaphore(0);
+		writer_quit = 0;
+		if (writer_start_sem && writer_done_sem) {
+			writer_thread = SDL_CreateThread(writer_main,
+							 "file writer",
+							 NULL);
+		}
+
+		if (!writer_thread) {
+			log_warn("failed to start file writer thread: %s\n",
+				 SDL_GetError());
+		}
+	}
+
+	/* Without a thread, just do the write now */
+	if (!writer_thread)
+		return writefile_atomic(name, buf, size);
+
+	name_copy = strdup(name);
+	buf_copy = malloc(size ? size : 1);
+	if (!name_copy || !buf_copy) {
+		free(name_copy);
+		free(buf_copy);
+		return -1;
+	}
+
+	memcpy(buf_copy, buf, size);
+
+	writefile_async_wait();
+	free(writer_name);
+	free(writer_buf);
+	writer_name = name_copy;
+	writer_buf = buf_copy;
+	writer_size = size;
+	writer_busy = 1;
+	SDL_SemPost(writer_start_sem);
+
+	return 0;
+}
+
+void writefile_async_stop(void)
+{
+	if (!writer_thread)
+		return;
+
+	writefile_async_wait();
+	writer_quit = 1;
+	SDL_SemPost(writer_start_sem);
+	SDL_WaitThread(writer_thread, NULL);
+	SDL_DestroySemaphore(writer_start_sem);
+	SDL_DestroySemaphore(writer_done_sem);
+	writer_thread = NULL;
+	writer_start_sem = NULL;
+	writer_done_sem = NULL;
+
+	free(writer_name);
+	free(writer_buf);
+	writer_name = NULL;
+	writer_buf = NULL;
+	writer_size = 0;
+}
+
 int process_file(const char *filename, void *data,
 		 void (*callback)(char *, int, void *),
                  int skip_comments,
@@ -1068,8 +1068,7 @@ static void configuration_setup_audio(GtkWidget *dialog, struct config *config)
 	GtkWidget *tmp;
 	GtkWidget *tmpbox;
 	GtkWidget *max_sample_rate_adjustment;
-	GtkWidget *adjustment_low_watermark;
-	GtkWidget *adjustment_buffer_range;
+	GtkWidget *spin_latency_target;
 	
 	dialog_box = gtk_dialog_get_content_area(GTK_DIALOG(dialog));
 	dialog_v_box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 8);
@@ -1126,21 +1125,12 @@ static void configuration_setup_audio(GtkWidget *dialog, struct config *config)
 
 	tmpbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 8);
 	gtk_box_pack_start(GTK_BOX(dialog_v_box), tmpbox, FALSE, FALSE, 0);
-	tmp = gtk_label_new_with_mnemonic("D_ynamic rate adjustment low watermark (frames):");
-	adjustment_low_watermark = config_double_spinbutton(dialog, config, 0.01,
-	                                             "dynamic_rate_adjustment_low_watermark");
-	gtk_label_set_mnemonic_widget(GTK_LABEL(tmp), adjustment_low_watermark);
+	tmp = gtk_label_new_with_mnemonic("_Latency target (ms, 0 for automatic):");
+	spin_latency_target = config_int_spinbutton(dialog, config,
+						    "audio_latency_target");
+	gtk_label_set_mnemonic_widget(GTK_LABEL(tmp), spin_latency_target);
 	gtk_box_pack_start(GTK_BOX(tmpbox), tmp, FALSE, FALSE, 8);
-	gtk_box_pack_start(GTK_BOX(tmpbox), adjustment_low_watermark, FALSE, FALSE, 8);
-
-	tmpbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 8);
-	gtk_box_pack_start(GTK_BOX(dialog_v_box), tmpbox, FALSE, FALSE, 0);
-	tmp = gtk_label_new_with_mnemonic("Dy_namic rate adjustment buffer range (frames):");
-	adjustment_buffer_range = config_double_spinbutton(dialog, config, 0.01,
-	                                             "dynamic_rate_adjustment_buffer_range");
-	gtk_label_set_mnemonic_widget(GTK_LABEL(tmp), adjustment_buffer_range);
-	gtk_box_pack_start(GTK_BOX(tmpbox), tmp,  FALSE, FALSE, 8);
-	gtk_box_pack_start(GTK_BOX(tmpbox), adjustment_buffer_range, FALSE, FALSE, 8);
+	gtk_box_pack_start(GTK_BOX(tmpbox), spin_latency_target, FALSE, FALSE, 8);
 
 }
 
@@ -24,6 +24,7 @@
 #include <errno.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <inttypes.h>
 #include <unistd.h>
 #include <getopt.h>
 #if GUI_ENABLED
@@ -58,6 +59,8 @@
 #include "emu.h"
 #include "video.h"
 #include "audio.h"
+#include "nsf_render.h"
+#include "stems.h"
 
 #define NS_PER_SEC 1000000000L
 
@@ -69,6 +72,15 @@ static int passed_duration = 0;
 static int test_duration = -1;
 static const char *frame_dumpfile;
 static const char *rom_dumpfile;
+static const char *frame_hash_logfile;
+static FILE *frame_hash_log;
+static int frame_hash_count;
+static const char *stems_pattern;
+static struct stems *stems;
+static struct nsf_render_options nsf_render_options = {
+	.length = 180,
+	.silence = 3,
+};
 
 #if _WIN32
 static int portable = -1;
@@ -161,7 +173,14 @@ static struct option long_options[] = {
 	{ "regression-test", no_argument, &testing, 1},
 	{ "frame-dumpfile", required_argument, 0, 'D'},
 	{ "rom-dumpfile", required_argument, 0, 'F'},
+	{ "frame-hash-log", required_argument, 0, 'H'},
 	{ "test-duration", required_argument, &passed_duration, 1 },
+	{ "nsf-render", required_argument, 0, 'W'},
+	{ "nsf-tracks", required_argument, 0, 'K'},
+	{ "nsf-length", required_argument, 0, 'L'},
+	{ "nsf-silence", required_argument, 0, 'S'},
+	{ "jobs", required_argument, 0, 'J'},
+	{ "stems", required_argument, 0, 'M'},
 #if _WIN32
 	{ "portable", no_argument, &portable, 1 },
 	{ "no-portable", no_argument, &portable, 0 },
@@ -515,16 +534,32 @@ static int main_loop(struct emu *emu)
 		}
 
 		cycles = emu_run_frame(emu);
+		if (frame_hash_log) {
+			int pc, a, x, y, s, p;
+
+			/* frame, framebuffer hash, CPU registers and a
+			   hash of the IRQ/NMI timestamps seen during the
+			   frame.
+			*/
+			emu_get_cpu_registers(emu, &pc, &a, &x, &y, &s, &p);
+			fprintf(frame_hash_log, "%d %016" PRIx64
+				" %04x %02x %02x %02x %02x %02x %08x\n",
+				frame_hash_count++, emu_get_frame_hash(emu),
+				pc, a, x, y, s, p,
+				emu_get_frame_irq_hash(emu));
+		}
+
 		if (testing && test_duration > 0) {
 			test_duration--;
 			if (!test_duration) {
-				video_save_screenshot(frame_dumpfile);
+				if (frame_dumpfile)
+					video_save_screenshot(frame_dumpfile);
 				running = 0;
 				continue;
 			}
 		}
 
-		if (!testing)
+		if (!testing || stems)
 			audio_fill_buffer(emu->audio, cycles);
 
 		if (display_fps) {
@@ -631,6 +666,15 @@ void help(const char *name, int brief)
 	printf("      --no-romcfg\tdisable loading of ROM-specific config file\n");
 	printf("  -t, --track\t\tspecify first track to play (NSF)\n");
 	printf("  -T, --trace\t\tdisplay CPU trace on STDOUT\n");
+	printf("      --nsf-render=file\trender NSF tracks to a WAV or raw PCM file\n"
+	       "\t\t\t(\"%%d\" in the name is replaced by the track number)\n");
+	printf("      --nsf-tracks=list\ttracks to render, e.g. \"1,3,5-8\" (default all)\n");
+	printf("      --nsf-length=secs\tmaximum length of each rendered track\n");
+	printf("      --nsf-silence=secs\tend a rendered track after this much silence\n"
+	       "\t\t\t(0 to disable)\n");
+	printf("      --jobs=N\t\tnumber of tracks to render in parallel\n");
+	printf("      --stems=file\twrite each sound source to its own file when\n"
+	       "\t\t\trendering (\"%%s\" in the name is replaced by the source)\n");
 	printf("  -w, --window\t\tstart in windowed mode\n");
 	printf("      --help\t\tdisplay this help and exit\n");
 	printf("      --version\t\tdisplay version information and exit\n");
@@ -667,6 +711,30 @@ int parse_command_line(struct cheat_state *cheats,
 		case 'D':
 			frame_dumpfile = optarg;
 			break;
+		case 'H':
+			frame_hash_logfile = optarg;
+			break;
+		case 'W':
+			/* Rendering needs neither a window nor an
+			   audio device */
+			nsf_render_options.output = optarg;
+			testing = 1;
+			break;
+		case 'K':
+			nsf_render_options.tracks = optarg;
+			break;
+		case 'L':
+			nsf_render_options.length = atoi(optarg);
+			break;
+		case 'S':
+			nsf_render_options.silence = atoi(optarg);
+			break;
+		case 'J':
+			nsf_render_options.jobs = atoi(optarg);
+			break;
+		case 'M':
+			stems_pattern = optarg;
+			break;
 		case 'C':
 			print_config = 1;
 			break;
@@ -826,6 +894,31 @@ int main(int argc, char **argv)
 		return 0;
 	}
 
+	if (nsf_render_options.output) {
+		nsf_render_options.stems = stems_pattern;
+		rc = nsf_render(emu, argv[optind], &nsf_render_options);
+		emu_cleanup(emu);
+		config_shutdown();
+		return rc ? 1 : 0;
+	}
+
+	if (stems_pattern) {
+		if (!testing) {
+			log_err("--stems requires --regression-test or "
+				"--nsf-render\n");
+			return 1;
+		}
+
+		/* Rendered along with the emulation; the mix goes in
+		   with the stems. */
+		stems = stems_open(stems_pattern, config->sample_rate);
+		if (!stems)
+			return 1;
+
+		audio_set_render_output(stems_write_mix, stems);
+		audio_set_stem_output(stems_write, stems);
+	}
+
 #if __unix__
 	screensaver_deactivate_delay = emu->config->screensaver_deactivate_delay;
 #endif
@@ -888,6 +981,17 @@ int main(int argc, char **argv)
 	if (testing)
 		video_init_testing(emu);
 
+	if (testing && frame_hash_logfile) {
+		frame_hash_log = fopen(frame_hash_logfile, "w");
+		if (!frame_hash_log) {
+			log_err("failed to open frame hash log \"%s\": %s\n",
+				frame_hash_logfile, strerror(errno));
+			return 1;
+		}
+
+		emu_set_frame_hash_enabled(emu, 1);
+	}
+
 #if GUI_ENABLED
 	if (!emu_loaded(emu) && gui_enabled)
 		gui_enable_event_timer();
@@ -895,7 +999,17 @@ int main(int argc, char **argv)
 
 	main_loop(emu);
 
+	if (frame_hash_log)
+		fclose(frame_hash_log);
+
 	close_rom(emu);
+
+	if (stems) {
+		audio_set_render_output(NULL, NULL);
+		audio_set_stem_output(NULL, NULL);
+		stems_close(stems);
+	}
+
 	emu_cleanup(emu);
 	if (!testing) {
 		video_shutdown();
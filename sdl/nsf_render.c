@@ -0,0 +1,490 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <stdio.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#if __unix__ || __APPLE__
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+#include "emu.h"
+#include "audio.h"
+#include "video.h"
+#include "nsf.h"
+#include "wav.h"
+#include "stems.h"
+#include "nsf_render.h"
+
+/* Samples below this (about -54 dBFS) count as silence */
+#define SILENCE_THRESHOLD 64
+
+int open_rom(struct emu *emu, char *filename, int patch_count,
+	     char **patchfiles);
+int close_rom(struct emu *emu);
+
+struct render_state {
+	struct wav_file *wav;
+	uint32_t samples;
+	uint32_t max_samples;
+	uint32_t silent_samples;
+	uint32_t max_silent_samples;
+	int heard;
+	int error;
+};
+
+/* Substitutes the track number for the first "%d" in the output
+   path, if there is one. */
+static char *track_path(const char *output, int track)
+{
+	const char *p;
+	char *path;
+	size_t size;
+
+	p = strstr(output, "%d");
+	if (!p)
+		return strdup(output);
+
+	size = strlen(output) + 16;
+	path = malloc(size);
+	if (!path)
+		return NULL;
+
+	snprintf(path, size, "%.*s%d%s", (int)(p - output), output, track,
+		 p + 2);
+
+	return path;
+}
+
+static void render_output(const int16_t *samples, int count, void *data)
+{
+	struct render_state *state = data;
+	int i;
+
+	if (state->samples + count > state->max_samples)
+		count = state->max_samples - state->samples;
+
+	for (i = 0; i < count; i++) {
+		if (samples[i] < SILENCE_THRESHOLD &&
+		    samples[i] > -SILENCE_THRESHOLD) {
+			state->silent_samples++;
+		} else {
+			state->silent_samples = 0;
+			state->heard = 1;
+		}
+	}
+
+	if (wav_write(state->wav, samples, count))
+		state->error = 1;
+
+	state->samples += count;
+}
+
+static int render_track_done(struct render_state *state)
+{
+	if (state->error || state->samples >= state->max_samples)
+		return 1;
+
+	/* Don't cut off a track that takes a moment to start */
+	if (state->max_silent_samples && state->heard &&
+	    state->silent_samples >= state->max_silent_samples) {
+		return 1;
+	}
+
+	return 0;
+}
+
+/* Renders one track from a freshly loaded copy of the file */
+static int render_track(struct emu *emu, char *filename, int track,
+			const char *path, struct nsf_render_options *options)
+{
+	struct render_state state;
+	struct stems *stems;
+	int sample_rate;
+	int rc;
+
+	memset(&state, 0, sizeof(state));
+
+	sample_rate = emu->config->sample_rate;
+	state.max_samples = options->length * sample_rate;
+	state.max_silent_samples = options->silence * sample_rate;
+
+	state.wav = wav_open(path, sample_rate);
+	if (!state.wav)
+		return -1;
+
+	stems = NULL;
+	if (options->stems) {
+		char *pattern;
+
+		pattern = track_path(options->stems, track);
+		if (pattern)
+			stems = stems_open(pattern, sample_rate);
+		free(pattern);
+
+		if (!stems) {
+			wav_close(state.wav);
+			return -1;
+		}
+
+		audio_set_stem_output(stems_write, stems);
+	}
+
+	emu->config->nsf_first_track = track;
+	audio_set_render_output(render_output, &state);
+
+	rc = open_rom(emu, filename, 0, NULL);
+	if (!rc) {
+		while (!render_track_done(&state)) {
+			int cycles;
+
+			cycles = emu_run_frame(emu);
+			audio_fill_buffer(emu->audio, cycles);
+		}
+
+		close_rom(emu);
+	} else {
+		log_err("failed to load \"%s\"\n", filename);
+	}
+
+	audio_set_render_output(NULL, NULL);
+	audio_set_stem_output(NULL, NULL);
+
+	if (stems && stems_close(stems))
+		rc = -1;
+
+	if (wav_close(state.wav) || state.error)
+		rc = -1;
+
+	if (rc)
+		return -1;
+
+	log_info("Track %d: %.1f seconds to \"%s\"\n", track,
+		 (double)state.samples / sample_rate, path);
+
+	return 0;
+}
+
+/* Parses the track list into a bitmap of tracks 1 to count */
+static int parse_tracks(const char *tracks, int count, uint8_t *selected)
+{
+	const char *p;
+
+	if (!tracks || !strcmp(tracks, "all")) {
+		memset(selected + 1, 1, count);
+		return 0;
+	}
+
+	p = tracks;
+	while (*p) {
+		char *end;
+		long first, last;
+
+		first = strtol(p, &end, 10);
+		last = first;
+		if (end == p)
+			return -1;
+
+		if (*end == '-') {
+			p = end + 1;
+			last = strtol(p, &end, 10);
+			if (end == p)
+				return -1;
+		}
+
+		if (first < 1 || last > count || first > last)
+			return -1;
+
+		memset(selected + first, 1, last - first + 1);
+
+		p = end;
+		if (*p == ',')
+			p++;
+		else if (*p)
+			return -1;
+	}
+
+	return 0;
+}
+
+static char *part_path(const char *output, int track)
+{
+	char *path;
+	size_t size;
+
+	size = strlen(output) + 32;
+	path = malloc(size);
+	if (path)
+		snprintf(path, size, "%s.track%d.part", output, track);
+
+	return path;
+}
+
+/* Joins the raw PCM pieces of a concatenated render in track order */
+static int join_parts(struct emu *emu, const char *output, char **parts,
+		      int count)
+{
+	struct wav_file *wav;
+	FILE *part;
+	uint8_t buf[16384];
+	int16_t samples[8192];
+	size_t size;
+	int rc;
+	int i, j;
+
+	wav = wav_open(output, emu->config->sample_rate);
+	if (!wav)
+		return -1;
+
+	rc = 0;
+
+	for (i = 0; i < count && !rc; i++) {
+		part = fopen(parts[i], "rb");
+		if (!part) {
+			rc = -1;
+			break;
+		}
+
+		while ((size = fread(buf, 2, sizeof(samples) / 2, part)) > 0) {
+			for (j = 0; j < size; j++)
+				samples[j] = buf[j * 2] | (buf[j * 2 + 1] << 8);
+
+			if (wav_write(wav, samples, size)) {
+				rc = -1;
+				break;
+			}
+		}
+
+		fclose(part);
+	}
+
+	if (wav_close(wav))
+		rc = -1;
+
+	return rc;
+}
+
+#if __unix__ || __APPLE__
+/* Each track is rendered by its own child process, which gets its own
+   copy of the emulator (the audio frontend and parts of the core are
+   process-wide). */
+static int render_tracks(struct emu *emu, char *filename, int *tracks,
+			 char **paths, int count,
+			 struct nsf_render_options *options)
+{
+	pid_t *pids;
+	int jobs;
+	int running;
+	int failures;
+	int next;
+	int rc;
+	int i;
+
+	jobs = options->jobs;
+	if (jobs <= 0)
+		jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	if (jobs <= 0)
+		jobs = 1;
+
+	pids = calloc(count, sizeof(*pids));
+	if (!pids)
+		return -1;
+
+	/* An ignored SIGCHLD is inherited from whatever started us,
+	   and would make wait() throw away the exit statuses. */
+	signal(SIGCHLD, SIG_DFL);
+
+	running = 0;
+	failures = 0;
+	next = 0;
+
+	while (next < count || running) {
+		int status;
+		pid_t pid;
+
+		while (next < count && running < jobs) {
+			/* Anything still buffered would otherwise be
+			   written again by the child */
+			fflush(NULL);
+			pid = fork();
+			if (pid < 0) {
+				log_err("failed to fork: %s\n",
+					strerror(errno));
+				failures++;
+				next++;
+				continue;
+			} else if (!pid) {
+				rc = render_track(emu, filename, tracks[next],
+						  paths[next], options);
+				/* _exit() skips the parent's atexit
+				   handlers; flush our own output first */
+				fflush(NULL);
+				_exit(rc ? 1 : 0);
+			}
+
+			pids[next++] = pid;
+			running++;
+		}
+
+		if (!running)
+			break;
+
+		pid = wait(&status);
+		if (pid < 0)
+			break;
+
+		for (i = 0; i < count; i++) {
+			if (pids[i] == pid)
+				break;
+		}
+
+		if (i == count)
+			continue;
+
+		running--;
+		if (!WIFEXITED(status) || WEXITSTATUS(status)) {
+			log_err("track %d failed\n", tracks[i]);
+			failures++;
+		}
+	}
+
+	free(pids);
+
+	return failures ? -1 : 0;
+}
+#else
+static int render_tracks(struct emu *emu, char *filename, int *tracks,
+			 char **paths, int count,
+			 struct nsf_render_options *options)
+{
+	int failures;
+	int i;
+
+	failures = 0;
+	for (i = 0; i < count; i++) {
+		if (render_track(emu, filename, tracks[i], paths[i],
+				 options)) {
+			failures++;
+		}
+	}
+
+	return failures ? -1 : 0;
+}
+#endif
+
+int nsf_render(struct emu *emu, char *filename,
+	       struct nsf_render_options *options)
+{
+	uint8_t selected[256];
+	int tracks[255];
+	char *paths[255];
+	int song_count;
+	int separate;
+	int count;
+	int rc;
+	int i;
+
+	/* Never touch save states from a render */
+	emu->config->autoload_state = 0;
+	emu->config->autosave_state = 0;
+
+	if (options->length <= 0) {
+		log_err("track length must be at least one second\n");
+		return -1;
+	}
+
+	video_init_testing(emu);
+
+	if (open_rom(emu, filename, 0, NULL)) {
+		video_shutdown_testing();
+		return -1;
+	}
+
+	song_count = nsf_get_song_count(emu->rom);
+	close_rom(emu);
+
+	if (song_count <= 0) {
+		log_err("\"%s\" is not an NSF file\n", filename);
+		video_shutdown_testing();
+		return -1;
+	}
+
+	memset(selected, 0, sizeof(selected));
+	if (parse_tracks(options->tracks, song_count, selected)) {
+		log_err("invalid track list \"%s\" (file has %d tracks)\n",
+			options->tracks, song_count);
+		video_shutdown_testing();
+		return -1;
+	}
+
+	separate = strstr(options->output, "%d") != NULL;
+
+	count = 0;
+	for (i = 1; i <= song_count; i++) {
+		if (!selected[i])
+			continue;
+
+		tracks[count] = i;
+		count++;
+	}
+
+	if (options->stems && count > 1 && !strstr(options->stems, "%d")) {
+		log_err("stem file names need \"%%d\" when rendering "
+			"more than one track\n");
+		video_shutdown_testing();
+		return -1;
+	}
+
+	/* A single track can be written directly; several tracks
+	   going to one file are rendered to pieces and joined. */
+	rc = 0;
+	for (i = 0; i < count; i++) {
+		if (separate || count == 1)
+			paths[i] = track_path(options->output, tracks[i]);
+		else
+			paths[i] = part_path(options->output, tracks[i]);
+
+		if (!paths[i])
+			rc = -1;
+	}
+
+	if (!rc) {
+		rc = render_tracks(emu, filename, tracks, paths, count,
+				   options);
+	}
+
+	if (!rc && !separate && count > 1)
+		rc = join_parts(emu, options->output, paths, count);
+
+	for (i = 0; i < count; i++) {
+		if (!separate && count > 1 && paths[i])
+			unlink(paths[i]);
+
+		free(paths[i]);
+	}
+
+	video_shutdown_testing();
+
+	return rc;
+}
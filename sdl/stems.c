@@ -0,0 +1,162 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "emu.h"
+#include "audio.h"
+#include "wav.h"
+#include "stems.h"
+
+#define STEM_MIX AUDIO_STEM_COUNT
+
+struct stems {
+	char *pattern;
+	int sample_rate;
+	int error;
+
+	/* Samples written (or owed, for files not yet opened) */
+	uint32_t samples[AUDIO_STEM_COUNT + 1];
+	struct wav_file *files[AUDIO_STEM_COUNT + 1];
+};
+
+static char *stem_path(const char *pattern, const char *name)
+{
+	const char *p;
+	char *path;
+	size_t size;
+
+	size = strlen(pattern) + strlen(name) + 2;
+	path = malloc(size);
+	if (!path)
+		return NULL;
+
+	p = strstr(pattern, "%s");
+	if (p) {
+		snprintf(path, size, "%.*s%s%s", (int)(p - pattern), pattern,
+			 name, p + 2);
+		return path;
+	}
+
+	/* Before the extension, if there is one */
+	p = strrchr(pattern, '.');
+	if (!p || strchr(p, '/'))
+		p = pattern + strlen(pattern);
+
+	snprintf(path, size, "%.*s_%s%s", (int)(p - pattern), pattern, name, p);
+
+	return path;
+}
+
+struct stems *stems_open(const char *pattern, int sample_rate)
+{
+	struct stems *stems;
+
+	stems = malloc(sizeof(*stems));
+	if (!stems)
+		return NULL;
+
+	memset(stems, 0, sizeof(*stems));
+	stems->sample_rate = sample_rate;
+	stems->pattern = strdup(pattern);
+	if (!stems->pattern) {
+		free(stems);
+		return NULL;
+	}
+
+	return stems;
+}
+
+static void write_stem(struct stems *stems, int stem, const char *name,
+		       const int16_t *samples, int count)
+{
+	char *path;
+	int i;
+
+	if (!stems->files[stem]) {
+		/* Nothing to write until the first sound */
+		for (i = 0; i < count; i++) {
+			if (samples[i])
+				break;
+		}
+
+		if (i == count) {
+			stems->samples[stem] += count;
+			return;
+		}
+
+		path = stem_path(stems->pattern, name);
+		if (path)
+			stems->files[stem] = wav_open(path, stems->sample_rate);
+		free(path);
+
+		if (!stems->files[stem]) {
+			stems->error = 1;
+			return;
+		}
+
+		if (wav_write_silence(stems->files[stem], stems->samples[stem]))
+			stems->error = 1;
+	}
+
+	if (wav_write(stems->files[stem], samples, count))
+		stems->error = 1;
+
+	stems->samples[stem] += count;
+}
+
+void stems_write(int stem, const int16_t *samples, int count, void *data)
+{
+	struct stems *stems = data;
+
+	if (stem < 0 || stem >= AUDIO_STEM_COUNT || stems->error)
+		return;
+
+	write_stem(stems, stem, audio_stem_name(stem), samples, count);
+}
+
+void stems_write_mix(const int16_t *samples, int count, void *data)
+{
+	struct stems *stems = data;
+
+	if (stems->error)
+		return;
+
+	write_stem(stems, STEM_MIX, "mix", samples, count);
+}
+
+int stems_close(struct stems *stems)
+{
+	int rc;
+	int i;
+
+	rc = stems->error ? -1 : 0;
+
+	for (i = 0; i <= AUDIO_STEM_COUNT; i++) {
+		if (stems->files[i] && wav_close(stems->files[i]))
+			rc = -1;
+	}
+
+	free(stems->pattern);
+	free(stems);
+
+	return rc;
+}
@@ -0,0 +1,171 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <stdio.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "emu.h"
+#include "wav.h"
+
+#define WAV_HEADER_SIZE 44
+
+struct wav_file {
+	FILE *file;
+	char *path;
+	int sample_rate;
+	int header;
+	int error;
+	uint32_t samples;
+};
+
+static void put_le16(uint8_t *buf, int value)
+{
+	buf[0] = value & 0xff;
+	buf[1] = (value >> 8) & 0xff;
+}
+
+static void put_le32(uint8_t *buf, uint32_t value)
+{
+	put_le16(buf, value & 0xffff);
+	put_le16(buf + 2, value >> 16);
+}
+
+static int write_header(struct wav_file *wav)
+{
+	uint8_t header[WAV_HEADER_SIZE];
+
+	memcpy(header, "RIFF", 4);
+	put_le32(header + 4, WAV_HEADER_SIZE - 8 + wav->samples * 2);
+	memcpy(header + 8, "WAVEfmt ", 8);
+	put_le32(header + 16, 16);
+	put_le16(header + 20, 1);		/* PCM */
+	put_le16(header + 22, 1);		/* mono */
+	put_le32(header + 24, wav->sample_rate);
+	put_le32(header + 28, wav->sample_rate * 2);
+	put_le16(header + 32, 2);
+	put_le16(header + 34, 16);
+	memcpy(header + 36, "data", 4);
+	put_le32(header + 40, wav->samples * 2);
+
+	if (fseek(wav->file, 0, SEEK_SET) ||
+	    fwrite(header, sizeof(header), 1, wav->file) != 1) {
+		return -1;
+	}
+
+	return 0;
+}
+
+struct wav_file *wav_open(const char *path, int sample_rate)
+{
+	struct wav_file *wav;
+	size_t len;
+
+	wav = malloc(sizeof(*wav));
+	if (!wav)
+		return NULL;
+
+	memset(wav, 0, sizeof(*wav));
+	wav->sample_rate = sample_rate;
+
+	len = strlen(path);
+	wav->header = (len >= 4) && !strcasecmp(path + len - 4, ".wav");
+
+	wav->path = strdup(path);
+	wav->file = fopen(path, "wb");
+	if (!wav->path || !wav->file) {
+		log_err("failed to open \"%s\": %s\n", path, strerror(errno));
+		if (wav->file)
+			fclose(wav->file);
+		free(wav->path);
+		free(wav);
+		return NULL;
+	}
+
+	/* The header is written once the length is known */
+	if (wav->header && fseek(wav->file, WAV_HEADER_SIZE, SEEK_SET))
+		wav->error = 1;
+
+	return wav;
+}
+
+int wav_write(struct wav_file *wav, const int16_t *samples, int count)
+{
+	uint8_t buf[2048];
+	int i, j;
+
+	for (i = 0; i < count; i += j) {
+		for (j = 0; (j < (int)sizeof(buf) / 2) && (i + j < count); j++)
+			put_le16(buf + j * 2, samples[i + j]);
+
+		if (fwrite(buf, 2, j, wav->file) != (size_t)j)
+			wav->error = 1;
+	}
+
+	wav->samples += count;
+
+	return wav->error ? -1 : 0;
+}
+
+int wav_write_silence(struct wav_file *wav, uint32_t count)
+{
+	int16_t buf[1024];
+	int size;
+
+	memset(buf, 0, sizeof(buf));
+
+	while (count) {
+		size = sizeof(buf) / sizeof(buf[0]);
+		if (size > count)
+			size = count;
+
+		wav_write(wav, buf, size);
+		count -= size;
+	}
+
+	return wav->error ? -1 : 0;
+}
+
+uint32_t wav_sample_count(struct wav_file *wav)
+{
+	return wav->samples;
+}
+
+int wav_close(struct wav_file *wav)
+{
+	int rc;
+
+	if (wav->header && !wav->error && write_header(wav))
+		wav->error = 1;
+
+	if (fclose(wav->file))
+		wav->error = 1;
+
+	rc = 0;
+	if (wav->error) {
+		log_err("failed to write \"%s\"\n", wav->path);
+		rc = -1;
+	}
+
+	free(wav->path);
+	free(wav);
+
+	return rc;
+}
@@ -0,0 +1,301 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+/* Checks that the SIMD paths in blip_buf produce exactly the same
+   output as the scalar code, then times each path.  Builds blip_buf.c
+   directly so it can switch between implementations.
+
+   The second set of runs times the ways sdl/audio.c can get a
+   multi-chip NSF's deltas into blip: one blip_add_delta() call per
+   delta as each chip produces it, staging them per chip and adding
+   them one at a time at the end of the frame, or staging them and
+   adding each chip's with one blip_add_deltas() call.  All three have
+   to give the same output.
+
+   Build: cc -O2 -I../include -o blip_buf_test blip_buf_test.c
+   Usage: blip_buf_test [seconds of audio]
+*/
+
+#include <time.h>
+
+#include "../main/blip_buf.c"
+
+#define CLOCK_RATE  1789773
+#define SAMPLE_RATE 48000
+#define FRAME_CLOCKS 29781
+#define FRAME_SAMPLES 4096
+
+static const char *level_names[] = { "scalar", "sse2", "avx2" };
+
+enum { ADD_DIRECT, ADD_STAGED, ADD_BATCHED, ADD_COUNT };
+
+static const char *add_names[] = { "direct", "staged", "batched" };
+
+/* Average clocks between deltas for each chip, roughly what a
+   busy multi-chip NSF produces: APU, VRC6, VRC7, N163, FDS, MMC5 and
+   5B */
+static const int chip_spacing[] = { 12, 40, 36, 15, 30, 48, 64 };
+
+#define CHIP_COUNT (sizeof(chip_spacing) / sizeof(chip_spacing[0]))
+#define MAX_EVENTS (FRAME_CLOCKS * 2)
+
+/* One frame's deltas from every chip, in time order */
+struct event {
+	unsigned time;
+	int chip;
+	int delta;
+};
+
+/* Deltas staged per chip, as in sdl/audio.c */
+struct stage {
+	unsigned times[MAX_EVENTS];
+	int deltas[MAX_EVENTS];
+	int count;
+};
+
+static struct event events[MAX_EVENTS];
+static struct stage stages[CHIP_COUNT];
+
+static int make_frame(unsigned int *seed)
+{
+	unsigned next[CHIP_COUNT];
+	int count = 0;
+	int chip;
+
+	for (chip = 0; chip < CHIP_COUNT; chip++)
+		next[chip] = 0;
+
+	while (1) {
+		int first = 0;
+
+		for (chip = 1; chip < CHIP_COUNT; chip++) {
+			if (next[chip] < next[first])
+				first = chip;
+		}
+
+		if (next[first] >= FRAME_CLOCKS)
+			break;
+
+		*seed = *seed * 1103515245 + 12345;
+		events[count].time = next[first];
+		events[count].chip = first;
+		events[count].delta = (int)((*seed >> 8) & 0xfff) - 0x800;
+		count++;
+
+		next[first] += 1 + (*seed >> 20) % (chip_spacing[first] * 2);
+	}
+
+	return count;
+}
+
+static int scale(int delta, int gain)
+{
+	return (int)(((long long)delta * gain) >> gain_bits);
+}
+
+/* Only the time spent getting deltas into blip is counted */
+static unsigned int run_chips(int level, int mode, int frames, short *out,
+			      double *elapsed)
+{
+	struct timespec start, end;
+	unsigned int hash = 2166136261u;
+	unsigned int seed = 12345;
+	int gain = blip_unity_gain * 3 / 4;
+	blip_t *blip;
+	int f;
+
+	*elapsed = 0;
+	blip = blip_new(FRAME_SAMPLES);
+	if (!blip)
+		return 0;
+
+	simd_level = level;
+	blip_set_rates(blip, CLOCK_RATE, SAMPLE_RATE);
+
+	for (f = 0; f < frames; f++) {
+		int count, chip, i;
+
+		count = make_frame(&seed);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		if (mode == ADD_DIRECT) {
+			for (i = 0; i < count; i++) {
+				blip_add_delta(blip, events[i].time,
+					       scale(events[i].delta, gain));
+			}
+		} else {
+			for (i = 0; i < count; i++) {
+				struct stage *stage = &stages[events[i].chip];
+
+				stage->times[stage->count] = events[i].time;
+				stage->deltas[stage->count] = events[i].delta;
+				stage->count++;
+			}
+
+			for (chip = 0; chip < CHIP_COUNT; chip++) {
+				struct stage *stage = &stages[chip];
+
+				if (mode == ADD_BATCHED) {
+					blip_add_deltas(blip, stage->times,
+							stage->deltas,
+							stage->count, gain);
+				} else {
+					for (i = 0; i < stage->count; i++) {
+						blip_add_delta(blip,
+							stage->times[i],
+							scale(stage->deltas[i],
+							      gain));
+					}
+				}
+
+				stage->count = 0;
+			}
+		}
+		clock_gettime(CLOCK_MONOTONIC, &end);
+
+		*elapsed += (end.tv_sec - start.tv_sec) +
+			(end.tv_nsec - start.tv_nsec) / 1e9;
+
+		blip_end_frame(blip, FRAME_CLOCKS);
+		count = blip_read_samples(blip, out, FRAME_SAMPLES, 0);
+
+		for (i = 0; i < count; i++)
+			hash = (hash ^ (unsigned short)out[i]) * 16777619u;
+	}
+
+	blip_delete(blip);
+
+	return hash;
+}
+
+/* Same sequence of deltas and reads for every run */
+static unsigned int run(int level, int frames, int stereo, short *out,
+			 double *elapsed)
+{
+	struct timespec start, end;
+	unsigned int hash = 2166136261u;
+	unsigned int seed = 12345;
+	blip_t *blip;
+	int f;
+
+	*elapsed = 0;
+	blip = blip_new(FRAME_SAMPLES);
+	if (!blip)
+		return 0;
+
+	simd_level = level;
+	blip_set_rates(blip, CLOCK_RATE, SAMPLE_RATE);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (f = 0; f < frames; f++) {
+		unsigned int time = 0;
+		int count, i;
+
+		while (1) {
+			int delta;
+
+			seed = seed * 1103515245 + 12345;
+			time += (seed >> 16) % 64;
+			if (time >= FRAME_CLOCKS)
+				break;
+
+			/* Occasionally large enough to clip */
+			delta = (int)((seed >> 8) & 0xffff) - 0x8000;
+			if (!(seed & 0x1f0000))
+				delta *= 8;
+			blip_add_delta(blip, time, delta);
+		}
+
+		blip_end_frame(blip, FRAME_CLOCKS);
+		count = blip_read_samples(blip, out, FRAME_SAMPLES, stereo);
+
+		for (i = 0; i < count << stereo; i++)
+			hash = (hash ^ (unsigned short)out[i]) * 16777619u;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	*elapsed = (end.tv_sec - start.tv_sec) +
+		(end.tv_nsec - start.tv_nsec) / 1e9;
+
+	blip_delete(blip);
+
+	return hash;
+}
+
+int main(int argc, char **argv)
+{
+	static short out[FRAME_SAMPLES * 2];
+	int seconds = 60;
+	int frames, level, max_level, stereo;
+	int failed = 0;
+
+	if (argc > 1)
+		seconds = atoi(argv[1]);
+
+	frames = seconds * 60;
+
+	/* Detect what the CPU supports */
+	blip_delete(blip_new(1));
+	max_level = simd_level;
+
+	for (stereo = 0; stereo <= 1; stereo++) {
+		unsigned int reference = 0;
+
+		for (level = simd_none; level <= max_level; level++) {
+			unsigned int hash;
+			double elapsed;
+
+			hash = run(level, frames, stereo, out, &elapsed);
+			if (level == simd_none)
+				reference = hash;
+
+			printf("%s %-6s %8.3f ms  %08x %s\n",
+			       stereo ? "stereo" : "mono  ",
+			       level_names[level], elapsed * 1000,
+			       hash, hash == reference ? "ok" : "MISMATCH");
+
+			if (hash != reference)
+				failed = 1;
+		}
+	}
+
+	for (level = simd_none; level <= max_level; level++) {
+		unsigned int reference = 0;
+		int mode;
+
+		for (mode = 0; mode < ADD_COUNT; mode++) {
+			unsigned int hash;
+			double elapsed;
+
+			hash = run_chips(level, mode, frames, out, &elapsed);
+			if (mode == ADD_DIRECT)
+				reference = hash;
+
+			printf("chips  %-6s %-7s %8.3f ms  %08x %s\n",
+			       level_names[level], add_names[mode],
+			       elapsed * 1000, hash,
+			       hash == reference ? "ok" : "MISMATCH");
+
+			if (hash != reference)
+				failed = 1;
+		}
+	}
+
+	return failed;
+}
@@ -0,0 +1,805 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+/* Checks that the incremental board_prg_sync(), board_chr_sync() and
+   nametable sync leave the CPU and PPU page tables exactly as the old
+   full syncs did, which rewrote every slot on every call.  Random
+   boards get random sequences of bank switches (including sub-page
+   chunks, negative banks, prg_and/prg_or and chr_and/chr_or changes);
+   after each one both versions are run against their own copy of the
+   page tables and the copies are compared.  Builds board.c directly
+   so it can call the static nametable sync.
+
+   Banks of 1K or more always start on a 1K boundary, as they do on
+   every board; the old syncs mapped unaligned ones inconsistently.
+
+   Build: cc -O2 -I../include -ffunction-sections -fdata-sections \
+          -Wl,--gc-sections -o board_sync_test board_sync_test.c
+   Usage: board_sync_test [boards]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../main/board.c"
+
+/* Page tables, modelled on the ones in cpu.c and ppu.c.  The stubs
+   below write to whichever copy 'tables' points at. */
+struct page_tables {
+	uint8_t *cpu_read[64];
+	uint8_t *cpu_write[64];
+	uint8_t *ppu_read[2][16];
+	uint8_t *ppu_write[2][16];
+};
+
+static struct page_tables *tables;
+
+void log_message(enum log_priority priority, const char *fmt, ...)
+{
+}
+
+uint32_t cpu_get_cycles(struct cpu_state *cpu)
+{
+	return 0;
+}
+
+/* Same as cpu.c */
+void cpu_set_pagetable_entry(struct cpu_state *cpu, int page,
+			     int size, uint8_t * data, int rw)
+{
+	uint8_t *ptr;
+
+	ptr = data;
+	if (ptr)
+		ptr -= page;
+
+	page >>= CPU_PAGE_SHIFT;
+
+	if (size < CPU_PAGE_SIZE) {
+		size = CPU_PAGE_SIZE;
+		ptr = NULL;
+	}
+
+	while (size) {
+		if (rw & CPU_PAGE_READ)
+			tables->cpu_read[page] = ptr;
+
+		if (rw & CPU_PAGE_WRITE)
+			tables->cpu_write[page] = ptr;
+
+		page++;
+		size -= CPU_PAGE_SIZE;
+	}
+}
+
+/* Same as ppu.c, without catching the PPU up */
+void ppu_set_pagemap_entry(struct ppu_state *ppu, int map, int addr,
+			   int size, uint8_t * data, int rw, uint32_t cycles)
+{
+	int i;
+	int page;
+
+	addr &= 0x3fff;
+
+	if (addr >= 0x3000)
+		addr &= 0x2fff;
+
+	if (addr > 0x2c00)
+		return;
+
+	if (addr + size > 0x2000 + 1)
+		return;
+
+	if (size < SIZE_1K) {
+		size = SIZE_1K;
+		data = NULL;
+	}
+
+	for (i = 0; i * SIZE_1K < size; i++) {
+		uint8_t *new;
+
+		new = data;
+		if (data)
+			new += i * SIZE_1K;
+
+		page = (addr >> 10) + i;
+		if (rw & 1)
+			tables->ppu_read[map][page] = new;
+		if (rw & 2)
+			tables->ppu_write[map][page] = new;
+	}
+}
+
+void ppu_map_nametable(struct ppu_state *ppu, int nametable, uint8_t * data,
+		       int rw, uint32_t cycles)
+{
+	int map;
+
+	if (nametable < 0 || nametable > 3)
+		return;
+
+	for (map = 0; map < 2; map++) {
+		if (rw & 1) {
+			tables->ppu_read[map][8 + nametable] = data;
+			tables->ppu_read[map][12 + nametable] = data;
+		}
+
+		if (rw & 2) {
+			tables->ppu_write[map][8 + nametable] = data;
+			tables->ppu_write[map][12 + nametable] = data;
+		}
+	}
+}
+
+/* The syncs as they were before they tracked which slots changed */
+static void reference_prg_sync(struct board *board)
+{
+	int i;
+	struct bank *b;
+	int prg_entries;
+
+	prg_entries = sizeof(board->prg_banks) /
+	    sizeof(board->prg_banks[0]);
+
+	for (i = 0; i < prg_entries; i++) {
+		unsigned and;
+		unsigned or;
+		int bank;
+		uint8_t *data;
+		size_t data_size;
+		int type, perms;
+		int addr;
+		size_t size;
+		int num_banks;
+
+		b = &board->prg_banks[i];
+		if (b->size == 0)
+			continue;
+
+		data = NULL;
+		data_size = 0;
+		perms = 0;
+		bank = 0;
+
+		and = board->prg_and;
+		or = board->prg_or;
+		if ((b->type != MAP_TYPE_ROM) &&
+		    (b->type != MAP_TYPE_BIOS)) {
+			and = board->wram_and;
+			or = board->wram_or;
+		}
+
+		or &= (~and);
+
+		type = b->type;
+		perms = b->perms;
+
+		if (type == MAP_TYPE_AUTO) {
+			if (board->wram[0].data)
+				type = MAP_TYPE_RAM0;
+			else
+				type = MAP_TYPE_NONE;
+		}
+
+		switch (type) {
+		case MAP_TYPE_ROM:
+			data = board->prg_rom.data;
+			data_size = board->prg_rom.size;
+			perms &= MAP_PERM_READ;
+			break;
+		case MAP_TYPE_RAM0:
+			data = board->wram[0].data;
+			data_size = board->wram[0].size;
+			break;
+		case MAP_TYPE_RAM1:
+			data = board->wram[1].data;
+			data_size = board->wram[1].size;
+			break;
+		case MAP_TYPE_NONE:
+			data = NULL;
+			data_size = b->size;
+			break;
+		case MAP_TYPE_MAPPER_RAM:
+			data = board->mapper_ram.data;
+			data_size = board->mapper_ram.size;
+			break;
+		case MAP_TYPE_BIOS:
+			data = board->bios.data;
+			data_size = board->bios.size;
+			perms &= MAP_PERM_READ;
+			break;
+		default:
+			log_err("board_prg_sync: invalid type %d\n",
+				type);
+			type = MAP_TYPE_NONE;
+			break;
+		}
+
+		bank = b->bank;
+		num_banks = data_size / b->size;
+
+		if (bank >= 0) {
+			if (num_banks <= 1)
+				bank = 0;
+		} else {
+			if (num_banks <= 1)
+				bank = -1;
+			else
+				bank = -(-bank % num_banks);
+		}
+
+		if ((bank < 0) && !(data_size % b->size))
+			bank += num_banks;
+
+		/* Applying prg_and and prg_or doesn't really
+		 * work if we're using negative bank numbers
+		 * (only happens if data_size is not a multiple
+		 * of bank size).
+		 */
+		if (bank >= 0) {
+			bank = ((bank & and) | or) >> b->shift;
+			if (num_banks)
+				bank %= num_banks;
+		}
+
+		if (data) {
+			int offset;
+
+			offset = (int)bank * b->size;
+			if (offset < 0) {
+				data += (data_size + offset);
+			} else {
+				data += offset;
+			}
+		} else {
+			data_size = b->size;
+		}
+
+		size = (b->size <= data_size) ? b->size : data_size;
+
+		for (addr = b->address;
+		     size && addr < (uint32_t) b->address + b->size;
+		     addr += size) {
+			uint8_t *ptr;
+
+			ptr = data;
+			if (size < CPU_PAGE_SIZE)
+				ptr = NULL;
+
+			cpu_set_pagetable_entry(board->emu->cpu, addr, size,
+						ptr, perms);
+		}
+	}
+}
+
+static void reference_nmt_sync(struct board *board)
+{
+	int i;
+	uint32_t cycles;
+
+	cycles = cpu_get_cycles(board->emu->cpu);
+
+	for (i = 0; i < 4; i++) {
+		uint8_t *data;
+		int perms;
+		int data_size;
+		int bank;
+		int count;
+
+		data = NULL;
+		data_size = 0;
+		perms = board->nmt_banks[i].perms;
+		bank = board->nmt_banks[i].bank;
+
+		switch (board->nmt_banks[i].type) {
+		case MAP_TYPE_CIRAM:
+			data = board->ciram.data;
+			data_size = board->ciram.size;
+			perms = MAP_PERM_READ | MAP_PERM_WRITE;
+			break;
+		case MAP_TYPE_ROM:
+			data = board->chr_rom.data;
+			data_size = board->chr_rom.size;
+			perms &= MAP_PERM_READ;
+			break;
+		case MAP_TYPE_RAM0:
+			data = board->vram[0].data;
+			data_size = board->vram[0].size;
+			break;
+		case MAP_TYPE_RAM1:
+			data = board->vram[1].data;
+			data_size = board->vram[1].size;
+			break;
+		case MAP_TYPE_MAPPER_RAM:
+			data = board->mapper_ram.data;
+			data_size = board->mapper_ram.size;
+			/* FIXME should this be readonly? */
+			break;
+		case MAP_TYPE_FILL:
+			data = board->fill_mode_nmt;
+			data_size = SIZE_1K;
+			perms = MAP_PERM_READ;
+			break;
+		case MAP_TYPE_ZERO:
+			data = zero_nmt;
+			data_size = SIZE_1K;
+			perms = MAP_PERM_READ;
+		case MAP_TYPE_NONE:
+			data = NULL;
+			data_size = SIZE_1K;
+			break;
+		}
+
+		count = data_size / SIZE_1K;
+		if (count == 0)
+			data = NULL;
+
+		if (data) {
+			bank %= count ? count : 1;
+			data += bank * SIZE_1K;
+		}
+
+		ppu_map_nametable(board->emu->ppu, i, data, perms, cycles);
+	}
+}
+
+static void reference_chr_sync(struct board *board, int set)
+{
+	int i;
+	struct bank *b;
+	uint32_t cycles;
+	int chr_entries;
+
+	cycles = cpu_get_cycles(board->emu->cpu);
+	chr_entries = sizeof(board->chr_banks0) /
+		sizeof(board->chr_banks0[0]);
+
+	for (i = 0; i < chr_entries; i++) {
+		uint32_t and;
+		uint32_t or;
+		uint32_t bank;
+		uint8_t *data;
+		uint32_t data_size;
+		int type, perms;
+		int addr;
+		size_t size;
+		int num_banks;
+
+		if (set)
+			b = &board->chr_banks1[i];
+		else
+			b = &board->chr_banks0[i];
+		if (b->size == 0)
+			continue;
+
+		and = board->chr_and;
+		or = board->chr_or;
+
+		data = NULL;
+		data_size = 0;
+
+		type = b->type;
+		perms = b->perms;
+
+		if (type == MAP_TYPE_AUTO) {
+			if (board->chr_rom.data)
+				type = MAP_TYPE_ROM;
+			else if (board->vram[0].data)
+				type = MAP_TYPE_RAM0;
+		}
+
+		switch (type) {
+		case MAP_TYPE_ROM:
+			data = board->chr_rom.data;
+			data_size = board->chr_rom.size;
+			perms &= MAP_PERM_READ;
+			break;
+		case MAP_TYPE_RAM0:
+			data = board->vram[0].data;
+			data_size = board->vram[0].size;
+			break;
+		case MAP_TYPE_RAM1:
+			data = board->vram[1].data;
+			data_size = board->vram[1].size;
+			break;
+		case MAP_TYPE_CIRAM:
+			data = board->ciram.data;
+			data_size = board->ciram.size;
+			break;
+		case MAP_TYPE_NONE:
+			data = NULL;
+			data_size = b->size;
+			break;
+		default:
+			log_err("board_chr_sync: invalid type %d\n",
+				type);
+			type = MAP_TYPE_NONE;
+			break;
+		}
+
+		bank = b->bank;
+		num_banks = data_size / b->size;
+
+		if (bank >= 0) {
+			if (num_banks <= 1)
+				bank = 0;
+		} else {
+			if (num_banks <= 1)
+				bank = -1;
+			else
+				bank = -(-bank % num_banks);
+		}
+
+		if ((bank < 0) && !(data_size % b->size))
+			bank += num_banks;
+
+		/* Applying chr_and and chr_or doesn't really
+		 * work if we're using negative bank numbers
+		 * (only happens if data_size is not a multiple
+		 * of bank size).
+		 */
+		if (bank >= 0) {
+			bank = ((b->bank & and) | or) >> b->shift;
+			if (num_banks)
+				bank %= num_banks;
+		}
+
+		if (data) {
+			int offset;
+
+			offset = (int)bank * b->size;
+			if (offset < 0) {
+				data += (data_size + offset);
+			} else {
+				data += offset;
+			}
+		}
+
+		size = (b->size <= data_size) ? b->size : data_size;
+
+		for (addr = b->address;
+		     size && addr < (uint32_t) b->address + b->size;
+		     addr += size) {
+			uint8_t *ptr;
+
+			ptr = data;
+			if (size < SIZE_1K)
+				ptr = NULL;
+
+			ppu_set_pagemap_entry(board->emu->ppu, set, addr, size,
+					      ptr, perms, cycles);
+
+		}
+	}
+}
+
+static uint32_t seed = 12345;
+
+static int random_int(int limit)
+{
+	seed = seed * 1103515245 + 12345;
+
+	return (seed >> 8) % limit;
+}
+
+static int random_bank(void)
+{
+	if (!random_int(8))
+		return -1 - random_int(8);
+
+	return random_int(256);
+}
+
+/* Chip sizes include zero (chip not present) and sizes that aren't
+   a multiple of the bank size */
+static void random_chip(struct chip *chip, const size_t *sizes, int count)
+{
+	free(chip->data);
+
+	chip->size = sizes[random_int(count)];
+	chip->data = chip->size ? malloc(chip->size) : NULL;
+}
+
+static const size_t prg_sizes[] = { 0, SIZE_32K, SIZE_128K, SIZE_512K,
+				    SIZE_32K + SIZE_8K };
+static const size_t ram_sizes[] = { 0, SIZE_2K, SIZE_8K, SIZE_32K };
+static const size_t mapper_ram_sizes[] = { 0, 128, SIZE_1K };
+static const size_t chr_sizes[] = { 0, SIZE_8K, SIZE_128K, SIZE_256K,
+				    SIZE_8K + SIZE_1K };
+static const size_t vram_sizes[] = { 0, SIZE_2K, SIZE_8K };
+
+static const int prg_types[] = {
+	MAP_TYPE_ROM, MAP_TYPE_RAM0, MAP_TYPE_RAM1, MAP_TYPE_NONE,
+	MAP_TYPE_MAPPER_RAM, MAP_TYPE_BIOS, MAP_TYPE_AUTO,
+};
+
+static const int chr_types[] = {
+	MAP_TYPE_ROM, MAP_TYPE_RAM0, MAP_TYPE_RAM1, MAP_TYPE_CIRAM,
+	MAP_TYPE_NONE, MAP_TYPE_AUTO,
+};
+
+static const int nmt_types[] = {
+	MAP_TYPE_CIRAM, MAP_TYPE_ROM, MAP_TYPE_RAM0, MAP_TYPE_RAM1,
+	MAP_TYPE_MAPPER_RAM, MAP_TYPE_FILL, MAP_TYPE_ZERO, MAP_TYPE_NONE,
+};
+
+static void random_prg_bank(struct bank *b)
+{
+	static const size_t sizes[] = { 128, 256, 512, SIZE_1K, SIZE_2K,
+					SIZE_4K, SIZE_8K, SIZE_16K,
+					SIZE_32K };
+	uint32_t align;
+
+	memset(b, 0, sizeof(*b));
+	if (!random_int(4))
+		return;
+
+	b->size = sizes[random_int(ARRAY_SIZE(sizes))];
+
+	/* Size-aligned, or page-aligned for larger banks */
+	align = (random_int(4) || b->size < SIZE_1K) ? b->size : SIZE_1K;
+	b->address = (0x4000 + random_int(0xc000 - b->size + 1)) & ~(align - 1);
+	if (b->address < 0x4000)
+		b->address += align;
+
+	b->bank = random_bank();
+	b->shift = random_int(8) ? 0 : random_int(3);
+	b->perms = random_int(4);
+	b->type = prg_types[random_int(ARRAY_SIZE(prg_types))];
+}
+
+static void random_chr_bank(struct bank *b)
+{
+	static const size_t sizes[] = { 128, 512, SIZE_1K, SIZE_2K,
+					SIZE_4K, SIZE_8K };
+	uint32_t align;
+
+	memset(b, 0, sizeof(*b));
+	if (!random_int(4))
+		return;
+
+	b->size = sizes[random_int(ARRAY_SIZE(sizes))];
+
+	/* Mostly inside the pattern tables, sometimes over the
+	   nametables, where ppu_set_pagemap_entry() ignores it */
+	align = (random_int(4) || b->size < SIZE_1K) ? b->size : SIZE_1K;
+	if (random_int(8))
+		b->address = random_int(0x2000 - b->size + 1);
+	else
+		b->address = 0x2000 + random_int(0x2000 - b->size + 1);
+	b->address &= ~(align - 1);
+
+	b->bank = random_bank();
+	b->shift = random_int(8) ? 0 : random_int(3);
+	b->perms = random_int(4);
+	b->type = chr_types[random_int(ARRAY_SIZE(chr_types))];
+}
+
+static void random_nmt_bank(struct nmt_bank *b)
+{
+	b->bank = random_int(8);
+	b->type = nmt_types[random_int(ARRAY_SIZE(nmt_types))];
+	b->perms = random_int(4);
+}
+
+static unsigned int random_mask(void)
+{
+	switch (random_int(4)) {
+	case 0:
+		return ~0;
+	case 1:
+		return 0;
+	default:
+		return random_int(0x100);
+	}
+}
+
+static void random_board(struct board *board, struct emu *emu)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(board->prg_banks); i++)
+		random_prg_bank(&board->prg_banks[i]);
+
+	for (i = 0; i < ARRAY_SIZE(board->chr_banks0); i++) {
+		random_chr_bank(&board->chr_banks0[i]);
+		random_chr_bank(&board->chr_banks1[i]);
+	}
+
+	for (i = 0; i < 4; i++)
+		random_nmt_bank(&board->nmt_banks[i]);
+
+	board->prg_and = random_int(2) ? ~0 : random_mask();
+	board->prg_or = random_int(2) ? 0 : random_mask();
+	board->wram_and = random_int(2) ? ~0 : random_mask();
+	board->wram_or = random_int(2) ? 0 : random_mask();
+	board->chr_and = random_int(2) ? ~0 : random_mask();
+	board->chr_or = random_int(2) ? 0 : random_mask();
+}
+
+/* One bank switch, or occasionally an outer bank change */
+static void random_change(struct board *board)
+{
+	struct bank *b;
+	int i;
+
+	switch (random_int(8)) {
+	case 0:
+		board->prg_and = random_mask();
+		board->prg_or = random_mask();
+		break;
+	case 1:
+		board->chr_and = random_mask();
+		board->chr_or = random_mask();
+		break;
+	case 2:
+		board->wram_and = random_mask();
+		board->wram_or = random_mask();
+		break;
+	case 3:
+		random_nmt_bank(&board->nmt_banks[random_int(4)]);
+		break;
+	case 4:
+		i = random_int(ARRAY_SIZE(board->chr_banks0));
+		b = random_int(2) ? &board->chr_banks1[i] :
+			&board->chr_banks0[i];
+		if (random_int(4))
+			b->bank = random_bank();
+		else
+			random_chr_bank(b);
+		break;
+	case 5:
+		i = random_int(ARRAY_SIZE(board->prg_banks));
+		b = &board->prg_banks[i];
+		if (random_int(4))
+			b->bank = random_bank();
+		else
+			random_prg_bank(b);
+		break;
+	default:
+		/* Plain bank number changes are by far the most common */
+		if (random_int(2)) {
+			i = random_int(ARRAY_SIZE(board->prg_banks));
+			board->prg_banks[i].bank = random_bank();
+		} else {
+			i = random_int(ARRAY_SIZE(board->chr_banks0));
+			board->chr_banks0[i].bank = random_bank();
+		}
+		break;
+	}
+}
+
+static void sync_all(struct board *board, struct page_tables *copy,
+		     int reference)
+{
+	tables = copy;
+
+	if (reference) {
+		reference_prg_sync(board);
+		reference_chr_sync(board, 0);
+		reference_chr_sync(board, 1);
+		reference_nmt_sync(board);
+	} else {
+		board_prg_sync(board);
+		board_chr_sync(board, 0);
+		board_chr_sync(board, 1);
+		board_internal_nmt_sync(board);
+	}
+}
+
+static const char *first_difference(struct page_tables *a,
+				    struct page_tables *b, int *index)
+{
+	int i, map;
+
+	for (i = 0; i < 64; i++) {
+		*index = i;
+		if (a->cpu_read[i] != b->cpu_read[i])
+			return "CPU read page";
+		if (a->cpu_write[i] != b->cpu_write[i])
+			return "CPU write page";
+	}
+
+	for (map = 0; map < 2; map++) {
+		for (i = 0; i < 16; i++) {
+			*index = map * 16 + i;
+			if (a->ppu_read[map][i] != b->ppu_read[map][i])
+				return "PPU read page";
+			if (a->ppu_write[map][i] != b->ppu_write[map][i])
+				return "PPU write page";
+		}
+	}
+
+	return NULL;
+}
+
+int main(int argc, char **argv)
+{
+	static struct page_tables reference_tables, new_tables;
+	static uint8_t fill_nmt[SIZE_1K];
+	struct board board;
+	struct emu emu;
+	int boards = 2000;
+	int steps = 100;
+	int failures = 0;
+	int i, j;
+
+	if (argc > 1)
+		boards = atoi(argv[1]);
+
+	memset(&emu, 0, sizeof(emu));
+	memset(&board, 0, sizeof(board));
+	board.emu = &emu;
+
+	for (i = 0; i < boards; i++) {
+		uint32_t board_seed;
+
+		board_seed = seed;
+
+		random_chip(&board.prg_rom, prg_sizes, ARRAY_SIZE(prg_sizes));
+		random_chip(&board.wram[0], ram_sizes, ARRAY_SIZE(ram_sizes));
+		random_chip(&board.wram[1], ram_sizes, ARRAY_SIZE(ram_sizes));
+		random_chip(&board.mapper_ram, mapper_ram_sizes,
+			    ARRAY_SIZE(mapper_ram_sizes));
+		random_chip(&board.bios, ram_sizes, ARRAY_SIZE(ram_sizes));
+		random_chip(&board.chr_rom, chr_sizes, ARRAY_SIZE(chr_sizes));
+		random_chip(&board.vram[0], vram_sizes, ARRAY_SIZE(vram_sizes));
+		random_chip(&board.vram[1], vram_sizes, ARRAY_SIZE(vram_sizes));
+		random_chip(&board.ciram, vram_sizes + 1, 1);
+		board.fill_mode_nmt = fill_nmt;
+
+		/* A freshly loaded board: nothing mapped, nothing cached */
+		board.prg_mappings_valid = 0;
+		board.chr_mappings_valid[0] = 0;
+		board.chr_mappings_valid[1] = 0;
+		board.nmt_mappings_valid = 0;
+		memset(&reference_tables, 0, sizeof(reference_tables));
+		memset(&new_tables, 0, sizeof(new_tables));
+
+		random_board(&board, &emu);
+
+		for (j = 0; j < steps; j++) {
+			const char *what;
+			int index;
+
+			if (j)
+				random_change(&board);
+
+			sync_all(&board, &reference_tables, 1);
+			sync_all(&board, &new_tables, 0);
+
+			what = first_difference(&new_tables, &reference_tables,
+						&index);
+			if (!what)
+				continue;
+
+			if (failures < 10) {
+				printf("board seed %08x, step %d: %s %d "
+				       "differs\n", board_seed, j, what,
+				       index);
+			}
+			failures++;
+			break;
+		}
+	}
+
+	printf("%d of %d boards differed\n", failures, boards);
+
+	return failures != 0;
+}
@@ -0,0 +1,174 @@
+#! /usr/bin/perl
+
+# Differential test of the fast paths against the accurate ones.
+#
+# Each ROM is run twice for the same number of frames: once with the
+# scanline renderer and the fast A12 IRQ prediction, and once with the
+# cycle renderer and the cycle-by-cycle A12 timer.  The per-frame logs
+# written by --frame-hash-log (framebuffer hash, CPU registers and IRQ
+# timestamp hash) are compared and the first divergence is reported.
+#
+# Usage: diff_renderers.pl [--frames=N] [--jobs=N] [rom lists...]
+#
+# ROM lists use the same format as test_harness.pl; if none are given
+# every .nes file under nes_test_roms is tested.
+
+use strict;
+use Getopt::Long;
+use File::Find;
+use File::Temp qw(tempdir);
+use POSIX qw(:sys_wait_h);
+
+my $emu_bin = '../cxnes';
+my $emu_options = '-o blargg_test_rom_hack_enabled=true -o default_overclock_mode=disabled -o scanline_renderer_auto=false -o apu_synthesis_enabled=false --regression-test';
+my $romdir = 'nes_test_roms';
+my $frames = 600;
+my $jobs = 0;
+
+my %modes = (
+	fast => '-o scanline_renderer_enabled=true -o a12_timer_fast_irq=true',
+	accurate => '-o scanline_renderer_enabled=false -o a12_timer_fast_irq=false',
+);
+
+my @fields = ('frame', 'framebuffer', 'PC', 'A', 'X', 'Y', 'S', 'P', 'IRQ');
+
+GetOptions('frames=i' => \$frames,
+	   'jobs=i' => \$jobs,
+	   'emu=s' => \$emu_bin) or
+  die "usage: $0 [--frames=N] [--jobs=N] [--emu=path] [rom lists...]\n";
+
+if ($jobs <= 0) {
+	$jobs = `nproc 2>/dev/null`;
+	chomp $jobs;
+	$jobs = 1 unless ($jobs =~ /^\d+$/ && $jobs > 0);
+}
+
+my @roms;
+
+if (@ARGV) {
+	while (<>) {
+		chomp;
+		next if (/^\s*$/);
+		push @roms, (split /\s+/, $_)[0];
+	}
+} else {
+	find({ no_chdir => 1, wanted => sub {
+		return unless (/\.nes$/i && -f $_);
+		my $rom = $File::Find::name;
+		$rom =~ s/^\Q$romdir\E\///;
+		push @roms, $rom;
+	} }, $romdir);
+	@roms = sort @roms;
+}
+
+my $tmpdir = tempdir('cxnes-diff-XXXXXX', TMPDIR => 1, CLEANUP => 1);
+
+sub read_log
+{
+	my ($file) = @_;
+	my @lines;
+
+	open LOG, $file or return ();
+	while (<LOG>) {
+		chomp;
+		push @lines, [split /\s+/, $_];
+	}
+	close LOG;
+
+	return @lines;
+}
+
+sub compare_rom
+{
+	my ($rom, $index) = @_;
+	my %logs;
+
+	foreach my $mode (keys %modes) {
+		my $log = "$tmpdir/$index-$mode.log";
+		$logs{$mode} = $log;
+		system("$emu_bin $emu_options $modes{$mode} " .
+		       "--frame-hash-log=$log --test-duration=$frames " .
+		       "$romdir/$rom > /dev/null 2>&1");
+		if ($? == -1 || ($? & 127)) {
+			return "$mode run failed";
+		}
+	}
+
+	my @fast = read_log($logs{fast});
+	my @accurate = read_log($logs{accurate});
+
+	if (!@fast || !@accurate) {
+		return "no frame log";
+	}
+
+	for (my $i = 0; $i < @fast && $i < @accurate; $i++) {
+		my @differ;
+
+		for (my $j = 1; $j < @fields; $j++) {
+			if ($fast[$i][$j] ne $accurate[$i][$j]) {
+				push @differ, "$fields[$j] $fast[$i][$j] != " .
+				  "$accurate[$i][$j]";
+			}
+		}
+
+		if (@differ) {
+			return "frame $fast[$i][0]: " . join(', ', @differ);
+		}
+	}
+
+	if (@fast != @accurate) {
+		return sprintf "frame counts differ (%d != %d)",
+		  scalar @fast, scalar @accurate;
+	}
+
+	return '';
+}
+
+# Run one child per ROM, at most $jobs at a time.  Each child writes
+# its result to a file so the report can be printed in ROM order.
+my %running;
+my $next = 0;
+
+while ($next < @roms || %running) {
+	while ($next < @roms && keys(%running) < $jobs) {
+		my $pid = fork();
+		die "fork failed: $!\n" unless defined $pid;
+
+		if (!$pid) {
+			my $result = compare_rom($roms[$next], $next);
+			open RESULT, ">$tmpdir/$next.result" or exit 1;
+			print RESULT $result;
+			close RESULT;
+			exit 0;
+		}
+
+		$running{$pid} = $next++;
+	}
+
+	my $pid = waitpid(-1, 0);
+	delete $running{$pid} if ($pid > 0);
+}
+
+my $failures = 0;
+
+for (my $i = 0; $i < @roms; $i++) {
+	my $result;
+
+	if (open RESULT, "$tmpdir/$i.result") {
+		local $/;
+		$result = <RESULT>;
+		close RESULT;
+	} else {
+		$result = 'no result';
+	}
+
+	if ($result eq '') {
+		print "$roms[$i]...\tMatch\n";
+	} else {
+		print "$roms[$i]...\tDiverged: $result\n";
+		$failures++;
+	}
+}
+
+printf "%d of %d ROMs diverged\n", $failures, scalar @roms;
+exit($failures ? 1 : 0);
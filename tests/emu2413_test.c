@@ -0,0 +1,544 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+/* Checks emu2413.c's precomputed tables and its loops over all slots.
+
+   The tables in boards/audio/emu2413_tables.h used to be built at run
+   time by the code kept below; they're compared against it, and
+   "--tables" prints the header from it.
+
+   The loops in calc() that step every slot at once are checked
+   against the per-slot code: two OPLLs get the same random register
+   writes, one stepping its slots the vector way and the other one slot
+   at a time, and every output sample and the whole OPLL state have to
+   match, at both quality settings.  Each slot is also copied out with
+   OPLL_get_slot() and back with OPLL_set_slot(), which the save state
+   relies on, to check that it comes back unchanged.
+
+   Build: cc -O2 -I../include -o emu2413_test emu2413_test.c -lm
+   Usage: emu2413_test [sequences per quality setting]
+          emu2413_test --tables > ../boards/audio/emu2413_tables.h
+*/
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../boards/audio/emu2413.c"
+
+/* The tables as emu2413.c used to build them */
+static uint16_t ref_fullsintable[PG_WIDTH];
+static uint16_t ref_halfsintable[PG_WIDTH];
+static int32_t ref_pmtable[PM_PG_WIDTH];
+static int32_t ref_amtable[AM_PG_WIDTH];
+static int16_t ref_DB2LIN_TABLE[(DB_MUTE + DB_MUTE) * 2];
+static uint16_t ref_AR_ADJUST_TABLE[1 << EG_BITS];
+static uint32_t ref_tllTable[16][8][1 << TL_BITS][4];
+static int32_t ref_rksTable[2][8][2];
+
+static int32_t Min(int32_t i, int32_t j)
+{
+	if (i < j)
+		return i;
+	else
+		return j;
+}
+
+/* Table for AR to LogCurve. */
+static void makeAdjustTable(void)
+{
+	int32_t i;
+
+	ref_AR_ADJUST_TABLE[0] = (1 << EG_BITS) - 1;
+	for (i = 1; i < (1 << EG_BITS); i++)
+		ref_AR_ADJUST_TABLE[i] =
+		    (uint16_t) ((double)(1 << EG_BITS) - 1 -
+				((1 << EG_BITS) - 1) * log(i) / log(127));
+}
+
+/* Table for dB(0 -- (1<<DB_BITS)-1) to Liner(0 -- DB2LIN_AMP_WIDTH) */
+static void makeDB2LinTable(void)
+{
+	int32_t i;
+
+	for (i = 0; i < DB_MUTE + DB_MUTE; i++) {
+		ref_DB2LIN_TABLE[i] =
+		    (int16_t) ((double)((1 << DB2LIN_AMP_BITS) - 1) *
+			       pow(10, -(double)i * DB_STEP / 20));
+		if (i >= DB_MUTE)
+			ref_DB2LIN_TABLE[i] = 0;
+		ref_DB2LIN_TABLE[i + DB_MUTE + DB_MUTE] =
+		    (int16_t) (-ref_DB2LIN_TABLE[i]);
+	}
+}
+
+/* Liner(+0.0 - +1.0) to dB((1<<DB_BITS) - 1 -- 0) */
+static int32_t lin2db(double d)
+{
+	if (d == 0)
+		return (DB_MUTE - 1);
+	else
+		return Min(-(int32_t) (20.0 * log10(d) / DB_STEP), DB_MUTE - 1);	/* 0 -- 127 */
+}
+
+/* Sin Table */
+static void makeSinTable(void)
+{
+	int32_t i;
+
+	for (i = 0; i < PG_WIDTH / 4; i++) {
+		ref_fullsintable[i] =
+		    (uint32_t) lin2db(sin(2.0 * PI * i / PG_WIDTH));
+	}
+
+	for (i = 0; i < PG_WIDTH / 4; i++) {
+		ref_fullsintable[PG_WIDTH / 2 - 1 - i] = ref_fullsintable[i];
+	}
+
+	for (i = 0; i < PG_WIDTH / 2; i++) {
+		ref_fullsintable[PG_WIDTH / 2 + i] =
+		    (uint32_t) (DB_MUTE + DB_MUTE + ref_fullsintable[i]);
+	}
+
+	for (i = 0; i < PG_WIDTH / 2; i++)
+		ref_halfsintable[i] = ref_fullsintable[i];
+	for (i = PG_WIDTH / 2; i < PG_WIDTH; i++)
+		ref_halfsintable[i] = ref_fullsintable[0];
+}
+
+static double saw(double phase)
+{
+	if (phase <= PI / 2)
+		return phase * 2 / PI;
+	else if (phase <= PI * 3 / 2)
+		return 2.0 - (phase * 2 / PI);
+	else
+		return -4.0 + phase * 2 / PI;
+}
+
+/* Table for Pitch Modulator */
+static void makePmTable(void)
+{
+	int32_t i;
+
+	for (i = 0; i < PM_PG_WIDTH; i++) {
+		ref_pmtable[i] =
+		    (int32_t) ((double)PM_AMP *
+			       pow(2,
+				   (double)PM_DEPTH * saw(2.0 * PI * i /
+							  PM_PG_WIDTH) / 1200));
+	}
+}
+
+/* Table for Amp Modulator */
+static void makeAmTable(void)
+{
+	int32_t i;
+
+	for (i = 0; i < AM_PG_WIDTH; i++) {
+		ref_amtable[i] =
+		    (int32_t) ((double)AM_DEPTH / 2 / DB_STEP *
+			       (1.0 + saw(2.0 * PI * i / PM_PG_WIDTH)));
+	}
+}
+
+static void makeTllTable(void)
+{
+#define dB2(x) ((x)*2)
+
+	static double kltable[16] = {
+		dB2(0.000), dB2(9.000), dB2(12.000), dB2(13.875), dB2(15.000),
+		dB2(16.125), dB2(16.875), dB2(17.625), dB2(18.000), dB2(18.750),
+		dB2(19.125), dB2(19.500), dB2(19.875), dB2(20.250), dB2(20.625),
+		dB2(21.000)
+	};
+
+	int32_t tmp;
+	int32_t fnum, block, TL, KL;
+
+	for (fnum = 0; fnum < 16; fnum++)
+		for (block = 0; block < 8; block++)
+			for (TL = 0; TL < 64; TL++)
+				for (KL = 0; KL < 4; KL++) {
+					if (KL == 0) {
+						ref_tllTable[fnum][block][TL][KL] =
+						    TL2EG(TL);
+					} else {
+						tmp =
+						    (int32_t) (kltable[fnum] -
+							       dB2(3.000) * (7 -
+									     block));
+						if (tmp <= 0)
+							ref_tllTable[fnum][block]
+							    [TL][KL] =
+							    TL2EG(TL);
+						else
+							ref_tllTable[fnum][block]
+							    [TL][KL] =
+							    (uint32_t) ((tmp >>
+									 (3 -
+									  KL)) /
+									EG_STEP)
+							    + TL2EG(TL);
+					}
+				}
+}
+
+static void makeRksTable(void)
+{
+	int32_t fnum8, block, KR;
+
+	for (fnum8 = 0; fnum8 < 2; fnum8++)
+		for (block = 0; block < 8; block++)
+			for (KR = 0; KR < 2; KR++) {
+				if (KR != 0)
+					ref_rksTable[fnum8][block][KR] =
+					    (block << 1) + fnum8;
+				else
+					ref_rksTable[fnum8][block][KR] =
+					    block >> 1;
+			}
+}
+
+/* Prints one table, nesting braces for each dimension.  Values go
+   eight to a line, or when the last dimension is short, four of its
+   arrays go on each line. */
+static void print_values(const int *dims, int ndims,
+			 long long (*value)(int), int *index)
+{
+	int i, j;
+
+	if (ndims == 1) {
+		for (i = 0; i < dims[0]; i++) {
+			if (i % 8 == 0)
+				printf("\t");
+			printf("%lld,", value((*index)++));
+			printf((i % 8 == 7 || i == dims[0] - 1) ? "\n" : " ");
+		}
+		return;
+	}
+
+	if (ndims == 2 && dims[1] <= 4) {
+		for (i = 0; i < dims[0]; i++) {
+			if (i % 4 == 0)
+				printf("\t");
+			printf("{");
+			for (j = 0; j < dims[1]; j++) {
+				printf("%lld%s", value((*index)++),
+				       j < dims[1] - 1 ? ", " : "");
+			}
+			printf("},");
+			printf((i % 4 == 3 || i == dims[0] - 1) ? "\n" : " ");
+		}
+		return;
+	}
+
+	for (i = 0; i < dims[0]; i++) {
+		printf("{\n");
+		print_values(dims + 1, ndims - 1, value, index);
+		printf("},\n");
+	}
+}
+
+static void print_table(const char *type, const char *name,
+			const char *size, const int *dims, int ndims,
+			long long (*value)(int))
+{
+	int index = 0;
+
+	printf("static const %s %s%s = {\n", type, name, size);
+	print_values(dims, ndims, value, &index);
+	printf("};\n");
+}
+
+static long long fullsin_value(int i)
+{
+	return ref_fullsintable[i];
+}
+
+static long long halfsin_value(int i)
+{
+	return ref_halfsintable[i];
+}
+
+static long long pm_value(int i)
+{
+	return ref_pmtable[i];
+}
+
+static long long am_value(int i)
+{
+	return ref_amtable[i];
+}
+
+static long long db2lin_value(int i)
+{
+	return ref_DB2LIN_TABLE[i];
+}
+
+static long long ar_adjust_value(int i)
+{
+	return ref_AR_ADJUST_TABLE[i];
+}
+
+static long long tll_value(int i)
+{
+	return ((uint32_t *)ref_tllTable)[i];
+}
+
+static long long rks_value(int i)
+{
+	return ((int32_t *)ref_rksTable)[i];
+}
+
+static void print_tables(void)
+{
+	static const int sin_dims[] = { PG_WIDTH };
+	static const int pm_dims[] = { PM_PG_WIDTH };
+	static const int am_dims[] = { AM_PG_WIDTH };
+	static const int db2lin_dims[] = { (DB_MUTE + DB_MUTE) * 2 };
+	static const int ar_adjust_dims[] = { 1 << EG_BITS };
+	static const int tll_dims[] = { 16, 8, 1 << TL_BITS, 4 };
+	static const int rks_dims[] = { 2, 8, 2 };
+
+	printf("/* emu2413 lookup tables, generated by "
+	       "\"tests/emu2413_test --tables\"\n"
+	       "   from the code that used to build them at run time; "
+	       "don't edit. */\n");
+
+	printf("\n/* WaveTable for each envelope amp */\n");
+	print_table("uint16_t", "fullsintable", "[PG_WIDTH]",
+		    sin_dims, 1, fullsin_value);
+	printf("\n");
+	print_table("uint16_t", "halfsintable", "[PG_WIDTH]",
+		    sin_dims, 1, halfsin_value);
+
+	printf("\n/* LFO Table */\n");
+	print_table("int32_t", "pmtable", "[PM_PG_WIDTH]",
+		    pm_dims, 1, pm_value);
+	printf("\n");
+	print_table("int32_t", "amtable", "[AM_PG_WIDTH]",
+		    am_dims, 1, am_value);
+
+	printf("\n/* dB to Liner table */\n");
+	print_table("int16_t", "DB2LIN_TABLE", "[(DB_MUTE + DB_MUTE) * 2]",
+		    db2lin_dims, 1, db2lin_value);
+
+	printf("\n/* Liner to Log curve conversion table "
+	       "(for Attack rate). */\n");
+	print_table("uint16_t", "AR_ADJUST_TABLE", "[1 << EG_BITS]",
+		    ar_adjust_dims, 1, ar_adjust_value);
+
+	printf("\n/* KSL + TL Table */\n");
+	print_table("uint32_t", "tllTable", "[16][8][1 << TL_BITS][4]",
+		    tll_dims, 4, tll_value);
+	printf("\n");
+	print_table("int32_t", "rksTable", "[2][8][2]",
+		    rks_dims, 3, rks_value);
+}
+
+static int check_tables(void)
+{
+	int failures = 0;
+
+#define CHECK_TABLE(name) \
+	if (sizeof(name) != sizeof(ref_##name) || \
+	    memcmp(name, ref_##name, sizeof(name))) { \
+		printf(#name " differs\n"); \
+		failures++; \
+	}
+
+	CHECK_TABLE(fullsintable);
+	CHECK_TABLE(halfsintable);
+	CHECK_TABLE(pmtable);
+	CHECK_TABLE(amtable);
+	CHECK_TABLE(DB2LIN_TABLE);
+	CHECK_TABLE(AR_ADJUST_TABLE);
+	CHECK_TABLE(tllTable);
+	CHECK_TABLE(rksTable);
+
+	return failures;
+}
+
+static uint32_t seed = 12345;
+
+static int random_int(int limit)
+{
+	seed = seed * 1103515245 + 12345;
+
+	return (seed >> 8) % limit;
+}
+
+/* A random register write, biased towards the instrument, volume and
+   key-on registers so that envelopes go through all of their states */
+static void random_write(OPLL *opll)
+{
+	int reg, value;
+	int ch;
+
+	ch = random_int(6);
+	value = random_int(256);
+
+	switch (random_int(8)) {
+	case 0:
+		reg = random_int(8);
+		break;
+	case 1:
+		reg = 0x10 + ch;
+		break;
+	case 2:
+	case 3:
+	case 4:
+		/* Mostly keep the key bit; hold it a while */
+		reg = 0x20 + ch;
+		if (random_int(4))
+			value = (value & ~0x10) | (opll->HiFreq[ch] & 0x10);
+		break;
+	default:
+		reg = 0x30 + ch;
+		break;
+	}
+
+	OPLL_writeReg(opll, reg, value);
+}
+
+/* Every field of every slot has to survive the trip through the
+   save state's layout */
+static int slots_round_trip(OPLL *opll)
+{
+	OPLL copy;
+	OPLL_SLOT slot;
+	int i;
+
+	memset(&copy, 0xff, sizeof(copy));
+	memcpy(&copy, opll, offsetof(OPLL, slots));
+	memcpy(&copy.patch, opll->patch,
+	       sizeof(*opll) - offsetof(OPLL, patch));
+
+	for (i = 0; i < OPLL_SLOT_NUM; i++) {
+		OPLL_get_slot(opll, i, &slot);
+		OPLL_set_slot(&copy, i, &slot);
+	}
+
+	return !memcmp(&copy, opll, sizeof(copy));
+}
+
+int main(int argc, char **argv)
+{
+	OPLL *reference, *opll;
+	int sequences = 200;
+	int quality, i, write;
+	int failures;
+
+	makeAdjustTable();
+	makeDB2LinTable();
+	makeSinTable();
+	makePmTable();
+	makeAmTable();
+	makeTllTable();
+	makeRksTable();
+
+	if ((argc > 1) && !strcmp(argv[1], "--tables")) {
+		print_tables();
+		return 0;
+	}
+
+	if (argc > 1)
+		sequences = atoi(argv[1]);
+
+	failures = check_tables();
+
+	reference = OPLL_new(3579545, 48000);
+	opll = OPLL_new(3579545, 48000);
+	if (!reference || !opll) {
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+
+	for (quality = 0; quality < 2; quality++) {
+		OPLL_set_quality(reference, quality);
+		OPLL_set_rate(reference, 49716);
+		OPLL_set_quality(opll, quality);
+		OPLL_set_rate(opll, 49716);
+
+		for (i = 0; i < sequences; i++) {
+			uint32_t sequence_seed;
+			int samples, differed;
+
+			sequence_seed = seed;
+			OPLL_reset(reference);
+			OPLL_reset(opll);
+
+			differed = 0;
+			samples = 0;
+			for (write = 0; write < 64 && !differed; write++) {
+				uint32_t write_seed;
+				int count;
+
+				write_seed = seed;
+				random_write(reference);
+				seed = write_seed;
+				random_write(opll);
+
+				count = random_int(4) ? random_int(64) :
+					random_int(8192);
+
+				while (count--) {
+					int16_t expected, output;
+
+					opll_slot_vectors = 0;
+					expected = OPLL_calc(reference);
+					opll_slot_vectors = 1;
+					output = OPLL_calc(opll);
+					samples++;
+
+					if (output != expected) {
+						differed = 1;
+						break;
+					}
+				}
+
+				if (memcmp(reference, opll, sizeof(*opll)))
+					differed = 1;
+			}
+
+			if (!slots_round_trip(opll))
+				differed = 1;
+
+			if (differed) {
+				if (failures < 10) {
+					printf("quality %d, seed %08x: "
+					       "differed after %d writes, "
+					       "%d samples\n", quality,
+					       sequence_seed, write, samples);
+				}
+				failures++;
+			}
+
+			seed = sequence_seed + 1;
+		}
+	}
+
+	printf("%d of %d sequences differed\n", failures, 2 * sequences);
+
+	OPLL_delete(reference);
+	OPLL_delete(opll);
+
+	return failures != 0;
+}
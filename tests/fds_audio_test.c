@@ -0,0 +1,368 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+/* Checks that skipping inaudible wave and modulator clocks in
+   fds_audio.c gives exactly the same output deltas, envelope gains and
+   unit state as stepping them one clock at a time.  Random sequences
+   of register writes and updates are run in three sets, each weighted
+   towards one of the skipped cases: zero gain (with the volume
+   envelope sometimes bringing it back up), writable wave RAM, and a
+   halted wave with the modulator running.  Builds fds_audio.c directly
+   so it can switch between the two.
+
+   Build: cc -O2 -I../include -ffunction-sections -fdata-sections \
+          -Wl,--gc-sections -o fds_audio_test fds_audio_test.c
+   Usage: fds_audio_test [sequences per case]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../boards/audio/fds_audio.c"
+
+enum test_case {
+	CASE_ZERO_GAIN,
+	CASE_WRITABLE,
+	CASE_HALTED,
+	CASE_COUNT,
+};
+
+static const char *case_names[CASE_COUNT] = {
+	"zero gain", "writable wave", "halted wave",
+};
+
+struct delta {
+	uint32_t timestamp;
+	int delta;
+};
+
+/* Output deltas from the run in progress */
+static struct delta *deltas;
+static int delta_count;
+static int delta_size;
+
+/* Just enough of the expansion audio interface for fds_audio.c */
+void exp_audio_add_delta(struct emu *emu, int chip, uint32_t cycles,
+			 int delta)
+{
+	if (delta_count == delta_size) {
+		delta_size = delta_size ? delta_size * 2 : 4096;
+		deltas = realloc(deltas, delta_size * sizeof(*deltas));
+		if (!deltas) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+	}
+
+	deltas[delta_count].timestamp = cycles;
+	deltas[delta_count].delta = delta;
+	delta_count++;
+}
+
+void exp_audio_set_stem(struct emu *emu, int stem, uint32_t cycles,
+			int amplitude)
+{
+}
+
+int exp_audio_overclocking(struct emu *emu)
+{
+	return 0;
+}
+
+static uint32_t seed = 12345;
+
+static int random_int(int limit)
+{
+	seed = seed * 1103515245 + 12345;
+
+	return (seed >> 8) % limit;
+}
+
+static int compare_deltas(const void *a, const void *b)
+{
+	const struct delta *x = a;
+	const struct delta *y = b;
+
+	if (x->timestamp != y->timestamp)
+		return x->timestamp < y->timestamp ? -1 : 1;
+
+	return 0;
+}
+
+/* Sorts the deltas by time and sums those at the same time, so that
+   the comparison doesn't depend on the order they were added in;
+   returns the number left. */
+static int normalize_deltas(struct delta *list, int count)
+{
+	int i, out;
+
+	qsort(list, count, sizeof(*list), compare_deltas);
+
+	out = 0;
+	for (i = 0; i < count; i++) {
+		if (out && list[out - 1].timestamp == list[i].timestamp) {
+			list[out - 1].delta += list[i].delta;
+			if (!list[out - 1].delta)
+				out--;
+		} else if (list[i].delta) {
+			list[out++] = list[i];
+		}
+	}
+
+	return out;
+}
+
+/* Envelope control ($4080 and $4084): mostly running envelopes, and
+   for the zero gain case mostly a direct gain of zero or an envelope
+   starting from it. */
+static int random_envelope(enum test_case test_case)
+{
+	if (test_case == CASE_ZERO_GAIN && random_int(4)) {
+		if (random_int(2))
+			return 0x80;
+
+		return random_int(0x80);
+	}
+
+	if (random_int(4))
+		return random_int(0x80);
+
+	return 0x80 | random_int(0x40);
+}
+
+static void random_write(struct fds_audio_state *audio,
+			 enum test_case test_case, uint32_t cycles)
+{
+	int value;
+
+	switch (random_int(20)) {
+	case 0: case 1: case 2:
+		fds_audio_write(audio, 0x4040 + random_int(64),
+				random_int(0x40), cycles);
+		break;
+	case 3:
+		/* Restart the volume envelope from zero, so the skipping
+		   has to stop where it first raises the gain */
+		if (test_case == CASE_ZERO_GAIN && random_int(2)) {
+			fds_audio_write(audio, 0x4080, 0x80, cycles);
+			fds_audio_write(audio, 0x4080, 0x40 | random_int(4),
+					cycles);
+			break;
+		}
+		fds_audio_write(audio, 0x4080, random_envelope(test_case),
+				cycles);
+		break;
+	case 4:
+		fds_audio_write(audio, 0x4082, random_int(0x100), cycles);
+		break;
+	case 5:
+		/* The halted case mostly keeps the wave halted, the zero
+		   gain case mostly keeps it running quickly with the
+		   envelopes on */
+		value = random_int(0x100);
+		if (test_case == CASE_HALTED && random_int(4))
+			value |= 0x80;
+		else if (test_case == CASE_ZERO_GAIN && random_int(4))
+			value = 0x08 | (value & 0x07);
+		else if (random_int(2))
+			value &= 0x7f;
+		fds_audio_write(audio, 0x4083, value, cycles);
+		break;
+	case 6:
+		fds_audio_write(audio, 0x4084, random_envelope(test_case),
+				cycles);
+		break;
+	case 7:
+		fds_audio_write(audio, 0x4085, random_int(0x80), cycles);
+		break;
+	case 8:
+		fds_audio_write(audio, 0x4086, random_int(0x100), cycles);
+		break;
+	case 9:
+		/* Briefly halt the modulator to reload its table */
+		fds_audio_write(audio, 0x4087, 0x80, cycles);
+		for (value = random_int(8); value >= 0; value--) {
+			fds_audio_write(audio, 0x4088, random_int(8),
+					cycles);
+		}
+		fds_audio_write(audio, 0x4087, random_int(0x10), cycles);
+		break;
+	case 10:
+		value = random_int(0x100);
+		if (test_case == CASE_WRITABLE && random_int(4))
+			value |= 0x80;
+		else if (random_int(2))
+			value &= 0x7f;
+		fds_audio_write(audio, 0x4089, value, cycles);
+		break;
+	case 11:
+		/* Short envelope periods so they clock during a run */
+		fds_audio_write(audio, 0x408a, random_int(4) ?
+				1 + random_int(8) : 0xe8, cycles);
+		break;
+	default:
+		fds_audio_update(audio, cycles);
+		break;
+	}
+}
+
+/* Sets up a random state through the registers, so the derived state
+   (the wave pitch) is consistent */
+static void random_state(struct fds_audio_state *audio,
+			 enum test_case test_case)
+{
+	int i;
+
+	audio->enabled = 1;
+
+	fds_audio_write(audio, 0x4089, 0x80, 0);
+	for (i = 0; i < 64; i++)
+		fds_audio_write(audio, 0x4040 + i, random_int(0x40), 0);
+	fds_audio_write(audio, 0x4089, 0x00, 0);
+
+	fds_audio_write(audio, 0x408a, 1 + random_int(8), 0);
+	fds_audio_write(audio, 0x4087, 0x80, 0);
+	for (i = 0; i < 32; i++)
+		fds_audio_write(audio, 0x4088, random_int(8), 0);
+
+	for (i = 0; i < 32; i++)
+		random_write(audio, test_case, 0);
+}
+
+/* Runs the same sequence of writes and updates with or without the
+   skipping, leaving the normalized output in 'deltas'.  The envelope
+   gains, as read from $4090 and $4092, are hashed after each step. */
+static uint32_t run_sequence(struct fds_audio_state *audio, int skip,
+			     enum test_case test_case,
+			     uint32_t sequence_seed)
+{
+	uint32_t hash = 2166136261u;
+	uint32_t cycles = 0;
+	int i;
+
+	fds_audio_skip_inaudible = skip;
+	seed = sequence_seed;
+	delta_count = 0;
+
+	for (i = 0; i < 64; i++) {
+		int span;
+
+		if (random_int(2))
+			span = random_int(200);
+		else
+			span = random_int(30000);
+
+		cycles += span * audio->emu->apu_clock_divider;
+		random_write(audio, test_case, cycles);
+
+		hash = (hash ^ audio->volume.gain) * 16777619u;
+		hash = (hash ^ audio->sweep.gain) * 16777619u;
+	}
+
+	fds_audio_update(audio, cycles + 30000 *
+			 audio->emu->apu_clock_divider);
+
+	delta_count = normalize_deltas(deltas, delta_count);
+
+	return hash;
+}
+
+int main(int argc, char **argv)
+{
+	struct fds_audio_state reference, audio;
+	struct delta *reference_deltas;
+	int reference_count;
+	struct config config;
+	struct emu emu;
+	int sequences = 2000;
+	int test_case, i;
+	int failures = 0;
+
+	if (argc > 1)
+		sequences = atoi(argv[1]);
+
+	memset(&config, 0, sizeof(config));
+
+	memset(&emu, 0, sizeof(emu));
+	emu.config = &config;
+	emu.apu_clock_divider = 12;
+
+	reference_deltas = NULL;
+
+	for (test_case = 0; test_case < CASE_COUNT; test_case++) {
+		for (i = 0; i < sequences; i++) {
+			uint32_t state_seed, sequence_seed;
+			uint32_t hash, reference_hash;
+
+			state_seed = seed;
+			memset(&reference, 0, sizeof(reference));
+			reference.emu = &emu;
+			random_state(&reference, test_case);
+			sequence_seed = seed;
+			memcpy(&audio, &reference, sizeof(audio));
+
+			reference_hash = run_sequence(&reference, 0,
+						      test_case,
+						      sequence_seed);
+			reference_count = delta_count;
+			reference_deltas = realloc(reference_deltas,
+						   (reference_count + 1) *
+						   sizeof(*deltas));
+			if (!reference_deltas) {
+				fprintf(stderr, "out of memory\n");
+				return 1;
+			}
+			memcpy(reference_deltas, deltas,
+			       reference_count * sizeof(*deltas));
+
+			hash = run_sequence(&audio, 1, test_case,
+					    sequence_seed);
+
+			if ((hash != reference_hash) ||
+			    (delta_count != reference_count) ||
+			    memcmp(deltas, reference_deltas,
+				   delta_count * sizeof(*deltas)) ||
+			    memcmp(&audio, &reference, sizeof(audio))) {
+				if (failures < 10) {
+					printf("%s, seed %08x: %d/%d deltas, "
+					       "wave step %d/%d "
+					       "modulator step %d/%d\n",
+					       case_names[test_case],
+					       state_seed, delta_count,
+					       reference_count,
+					       audio.wave.step,
+					       reference.wave.step,
+					       audio.modulator.step,
+					       reference.modulator.step);
+				}
+				failures++;
+			}
+
+			seed = sequence_seed + 1;
+		}
+	}
+
+	printf("%d of %d sequences differed\n", failures,
+	       CASE_COUNT * sequences);
+
+	free(reference_deltas);
+	free(deltas);
+
+	return failures != 0;
+}
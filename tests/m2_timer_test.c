@@ -0,0 +1,205 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+/* Checks that the closed-form prescaler math in m2_timer.c gives
+   exactly the same counter, prescaler, status flags and IRQ times as
+   stepping one prescaler underflow at a time.  Every combination of
+   timer flags is run against random timer states and cycle spans.
+   Builds m2_timer.c directly so it can switch between the two.
+
+   Build: cc -O2 -I../include -o m2_timer_test m2_timer_test.c
+   Usage: m2_timer_test [states per flag combination]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../boards/timer/m2_timer.c"
+
+/* Just enough of the CPU and save state interfaces for m2_timer.c */
+static int64_t scheduled;
+
+void cpu_interrupt_schedule(struct cpu_state *cpu, unsigned int intr,
+			    uint32_t cycles)
+{
+	scheduled = cycles;
+}
+
+void cpu_interrupt_cancel(struct cpu_state *cpu, unsigned int intr)
+{
+	scheduled = -1;
+}
+
+int cpu_interrupt_ack(struct cpu_state *cpu, unsigned int intr)
+{
+	return 0;
+}
+
+size_t pack_state(void *data, struct state_item *items, uint8_t *buf)
+{
+	return 0;
+}
+
+size_t unpack_state(void *data, struct state_item *items, uint8_t *buffer)
+{
+	return 0;
+}
+
+int save_state_add_chunk(struct save_state *state, const char *id,
+			 uint8_t *buf, size_t size)
+{
+	return 0;
+}
+
+int save_state_find_chunk(struct save_state *state, const char *id,
+			  uint8_t **bufp, size_t *sizep)
+{
+	return -1;
+}
+
+static uint32_t seed = 12345;
+
+static int random_int(int limit)
+{
+	seed = seed * 1103515245 + 12345;
+
+	return (seed >> 8) % limit;
+}
+
+static void random_timer(struct m2_timer *timer, struct emu *emu, int flags)
+{
+	memset(timer, 0, sizeof(*timer));
+	timer->emu = emu;
+	timer->flags = flags;
+
+	timer->size = 1 + random_int(16);
+	timer->mask = (1 << timer->size) - 1;
+	timer->counter = random_int(timer->mask + 1);
+	timer->reload = random_int(timer->mask + 1);
+	timer->reload_flag = random_int(4) == 0;
+	timer->force_reload_delay = random_int(3);
+
+	timer->prescaler_size = 1 + random_int(12);
+	timer->prescaler_mask = (1 << timer->prescaler_size) - 1;
+	timer->prescaler = random_int(timer->prescaler_mask + 1);
+	timer->prescaler_reload = random_int(timer->prescaler_mask + 1);
+
+	/* Mostly sensible decrements, sometimes ones larger than the
+	   prescaler period so the stepping fallback is covered too */
+	if (random_int(8))
+		timer->prescaler_decrement = 1 + random_int(4);
+	else
+		timer->prescaler_decrement = 1 + random_int(64);
+
+	timer->irq_enabled = random_int(4) != 0;
+	timer->counter_enabled = random_int(8) != 0;
+	timer->delay = random_int(3);
+}
+
+/* Runs the same sequence of spans, with an IRQ schedule after each,
+   and returns the IRQ times hashed together */
+static uint32_t run_sequence(struct m2_timer *timer, int closed_form,
+			     uint32_t sequence_seed)
+{
+	uint32_t hash = 2166136261u;
+	uint32_t cycles = 0;
+	int i;
+
+	m2_timer_closed_form = closed_form;
+	seed = sequence_seed;
+
+	for (i = 0; i < 8; i++) {
+		int span;
+
+		switch (random_int(3)) {
+		case 0:
+			span = random_int(16);
+			break;
+		case 1:
+			span = random_int(2000);
+			break;
+		default:
+			span = random_int(200000);
+			break;
+		}
+
+		cycles += span * timer->emu->cpu_clock_divider;
+		m2_timer_run(timer, cycles);
+
+		scheduled = -2;
+		m2_timer_schedule_irq(timer, cycles);
+
+		hash = (hash ^ (uint32_t)scheduled) * 16777619u;
+		hash = (hash ^ (uint32_t)(scheduled >> 32)) * 16777619u;
+	}
+
+	return hash;
+}
+
+int main(int argc, char **argv)
+{
+	struct m2_timer reference, timer;
+	struct emu emu;
+	int states = 2000;
+	int flags, i;
+	int failures = 0;
+
+	if (argc > 1)
+		states = atoi(argv[1]);
+
+	memset(&emu, 0, sizeof(emu));
+	emu.cpu_clock_divider = 12;
+
+	for (flags = 0; flags < 0x100; flags++) {
+		for (i = 0; i < states; i++) {
+			uint32_t state_seed, sequence_seed;
+			uint32_t hash, reference_hash;
+
+			state_seed = seed;
+			random_timer(&reference, &emu, flags);
+			sequence_seed = seed;
+			memcpy(&timer, &reference, sizeof(timer));
+
+			reference_hash = run_sequence(&reference, 0,
+						      sequence_seed);
+			hash = run_sequence(&timer, 1, sequence_seed);
+
+			if ((hash != reference_hash) ||
+			    memcmp(&timer, &reference, sizeof(timer))) {
+				if (failures < 10) {
+					printf("flags %02x, seed %08x: "
+					       "counter %x/%x prescaler %x/%x "
+					       "irq %d/%d\n", flags,
+					       state_seed, timer.counter,
+					       reference.counter,
+					       timer.prescaler,
+					       reference.prescaler,
+					       timer.irq, reference.irq);
+				}
+				failures++;
+			}
+
+			seed = sequence_seed + 1;
+		}
+	}
+
+	printf("%d of %d timer states differed\n", failures, 0x100 * states);
+
+	return failures != 0;
+}
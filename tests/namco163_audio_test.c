@@ -0,0 +1,358 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+/* Checks that the bulk stepping in namco163_audio.c's mixed_update()
+   gives exactly the same output deltas, channel phases and channel
+   state as clocking one channel at a time.  Random register layouts
+   get random sequences of register writes and updates, once with the
+   waves kept clear of the channel registers (so the bulk path runs)
+   and once with waves free to overlap them (so it falls back).
+   Builds namco163_audio.c directly so it can switch between the two.
+
+   Build: cc -O2 -I../include -ffunction-sections -fdata-sections \
+          -Wl,--gc-sections -o namco163_audio_test namco163_audio_test.c
+   Usage: namco163_audio_test [sequences per layout]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../boards/audio/namco163_audio.c"
+
+struct delta {
+	uint32_t timestamp;
+	int delta;
+};
+
+/* Output deltas from the run in progress */
+static struct delta *deltas;
+static int delta_count;
+static int delta_size;
+
+/* Just enough of the expansion audio interface for namco163_audio.c */
+void exp_audio_add_delta(struct emu *emu, int chip, uint32_t cycles,
+			 int delta)
+{
+	if (delta_count == delta_size) {
+		delta_size = delta_size ? delta_size * 2 : 4096;
+		deltas = realloc(deltas, delta_size * sizeof(*deltas));
+		if (!deltas) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+	}
+
+	deltas[delta_count].timestamp = cycles;
+	deltas[delta_count].delta = delta;
+	delta_count++;
+}
+
+void exp_audio_set_stem(struct emu *emu, int stem, uint32_t cycles,
+			int amplitude)
+{
+}
+
+int exp_audio_overclocking(struct emu *emu)
+{
+	return 0;
+}
+
+static uint32_t seed = 12345;
+
+static int random_int(int limit)
+{
+	seed = seed * 1103515245 + 12345;
+
+	return (seed >> 8) % limit;
+}
+
+static int compare_deltas(const void *a, const void *b)
+{
+	const struct delta *x = a;
+	const struct delta *y = b;
+
+	if (x->timestamp != y->timestamp)
+		return x->timestamp < y->timestamp ? -1 : 1;
+
+	return 0;
+}
+
+/* The two versions add the same changes in a different order, so sort
+   them by time and sum them; returns the number left. */
+static int normalize_deltas(struct delta *list, int count)
+{
+	int i, out;
+
+	qsort(list, count, sizeof(*list), compare_deltas);
+
+	out = 0;
+	for (i = 0; i < count; i++) {
+		if (out && list[out - 1].timestamp == list[i].timestamp) {
+			list[out - 1].delta += list[i].delta;
+			if (!list[out - 1].delta)
+				out--;
+		} else if (list[i].delta) {
+			list[out++] = list[i];
+		}
+	}
+
+	return out;
+}
+
+static void write_ram(struct namco163_audio_state *audio, int addr,
+		      int value, uint32_t cycles)
+{
+	namco163_audio_write(audio, 0xf800, addr, cycles);
+	namco163_audio_write(audio, 0x4800, value, cycles);
+}
+
+/* Waves are kept below 0x80 samples (RAM 0x00-0x3f) unless they may
+   overlap the registers, in which case they can be anywhere. */
+static int random_wave_address(int overlap)
+{
+	return overlap ? random_int(0x100) : random_int(0x41);
+}
+
+static int random_length_register(int overlap)
+{
+	int length;
+
+	if (overlap)
+		length = 4 * (1 + random_int(64));
+	else
+		length = 4 * (1 + random_int(16));
+
+	return ((256 - length) & 0xfc) | random_int(4);
+}
+
+static int random_frequency_byte(void)
+{
+	switch (random_int(3)) {
+	case 0:
+		return 0;
+	case 1:
+		return random_int(0x10);
+	default:
+		return random_int(0x100);
+	}
+}
+
+static void random_write(struct namco163_audio_state *audio, int overlap,
+			 uint32_t cycles)
+{
+	int channel;
+	int base;
+
+	channel = random_int(8);
+	base = 0x40 | (channel << 3);
+
+	switch (random_int(16)) {
+	case 0: case 1: case 2: case 3:
+		write_ram(audio, random_int(overlap ? 0x80 : 0x40),
+			  random_int(0x100), cycles);
+		break;
+	case 4: case 5: case 6:
+		write_ram(audio, base | (random_int(2) << 1),
+			  random_frequency_byte(), cycles);
+		break;
+	case 7:
+		write_ram(audio, base | 4, random_length_register(overlap),
+			  cycles);
+		break;
+	case 8:
+		write_ram(audio, base | 6, random_wave_address(overlap),
+			  cycles);
+		break;
+	case 9: case 10:
+		/* Channel 7's volume register also holds the channel
+		   count */
+		write_ram(audio, base | 7, random_int(0x80), cycles);
+		break;
+	case 11:
+		write_ram(audio, base | (1 + 2 * random_int(3)),
+			  random_int(0x100), cycles);
+		break;
+	case 12:
+		namco163_audio_write(audio, 0xe000,
+				     random_int(4) ? 0 : 0x40, cycles);
+		break;
+	case 13:
+		audio->emu->config->namco163_mixed_output = random_int(4) != 0;
+		break;
+	default:
+		namco163_audio_update(audio, cycles);
+		break;
+	}
+}
+
+static void random_state(struct namco163_audio_state *audio, int overlap)
+{
+	int channel;
+	int i;
+
+	for (i = 0; i < 0x40; i++)
+		audio->ram[i] = random_int(0x100);
+
+	for (channel = 0; channel < 8; channel++) {
+		int base = 0x40 | (channel << 3);
+
+		audio->ram[base] = random_frequency_byte();
+		audio->ram[base | 1] = random_int(0x100);
+		audio->ram[base | 2] = random_frequency_byte();
+		audio->ram[base | 3] = random_int(0x100);
+		audio->ram[base | 4] = random_length_register(overlap);
+		audio->ram[base | 5] = random_int(0x100);
+		audio->ram[base | 6] = random_wave_address(overlap);
+		audio->ram[base | 7] = random_int(0x80);
+	}
+
+	audio->enabled = 1;
+	audio->next_channel = 7;
+	audio->mixed = 1;
+	audio->timestamp = 0;
+}
+
+/* Runs the same sequence of writes and updates with or without bulk
+   stepping, leaving the normalized output in 'deltas' */
+static void run_sequence(struct namco163_audio_state *audio, int bulk,
+			 int overlap, uint32_t sequence_seed)
+{
+	uint32_t cycles = 0;
+	int i;
+
+	namco163_bulk_stepping = bulk;
+	audio->emu->config->namco163_mixed_output = 1;
+	seed = sequence_seed;
+	delta_count = 0;
+
+	for (i = 0; i < 64; i++) {
+		int span;
+
+		if (random_int(2))
+			span = random_int(200);
+		else
+			span = random_int(30000);
+
+		cycles += span * audio->emu->apu_clock_divider;
+		random_write(audio, overlap, cycles);
+	}
+
+	namco163_audio_update(audio, cycles + 30000 *
+			      audio->emu->apu_clock_divider);
+
+	delta_count = normalize_deltas(deltas, delta_count);
+}
+
+static int same_state(struct namco163_audio_state *a, uint8_t *ram_a,
+		      struct namco163_audio_state *b, uint8_t *ram_b)
+{
+	struct namco163_audio_state x, y;
+
+	if (memcmp(ram_a, ram_b, 0x80))
+		return 0;
+
+	x = *a;
+	y = *b;
+	x.ram = y.ram = NULL;
+
+	return !memcmp(&x, &y, sizeof(x));
+}
+
+int main(int argc, char **argv)
+{
+	struct namco163_audio_state reference, audio;
+	uint8_t reference_ram[0x80], ram[0x80];
+	struct delta *reference_deltas;
+	int reference_count;
+	struct config config;
+	struct emu emu;
+	int sequences = 2000;
+	int overlap, i, channel;
+	int failures = 0;
+
+	if (argc > 1)
+		sequences = atoi(argv[1]);
+
+	memset(&config, 0, sizeof(config));
+	for (channel = 0; channel < 8; channel++)
+		config.namco163_channel_volume[channel] = 100;
+
+	memset(&emu, 0, sizeof(emu));
+	emu.config = &config;
+	emu.apu_clock_divider = 12;
+
+	reference_deltas = NULL;
+
+	for (overlap = 0; overlap < 2; overlap++) {
+		for (i = 0; i < sequences; i++) {
+			uint32_t state_seed, sequence_seed;
+
+			state_seed = seed;
+			memset(&reference, 0, sizeof(reference));
+			reference.emu = &emu;
+			reference.ram = reference_ram;
+			random_state(&reference, overlap);
+			sequence_seed = seed;
+
+			audio = reference;
+			audio.ram = ram;
+			memcpy(ram, reference_ram, sizeof(ram));
+
+			run_sequence(&reference, 0, overlap, sequence_seed);
+			reference_count = delta_count;
+			reference_deltas = realloc(reference_deltas,
+						   (reference_count + 1) *
+						   sizeof(*deltas));
+			if (!reference_deltas) {
+				fprintf(stderr, "out of memory\n");
+				return 1;
+			}
+			memcpy(reference_deltas, deltas,
+			       reference_count * sizeof(*deltas));
+
+			run_sequence(&audio, 1, overlap, sequence_seed);
+
+			if ((delta_count != reference_count) ||
+			    memcmp(deltas, reference_deltas,
+				   delta_count * sizeof(*deltas)) ||
+			    !same_state(&audio, ram, &reference,
+					reference_ram)) {
+				if (failures < 10) {
+					printf("%s, seed %08x: %d/%d deltas, "
+					       "next channel %d/%d\n",
+					       overlap ? "overlapping" :
+					       "separate", state_seed,
+					       delta_count, reference_count,
+					       audio.next_channel,
+					       reference.next_channel);
+				}
+				failures++;
+			}
+
+			seed = sequence_seed + 1;
+		}
+	}
+
+	printf("%d of %d sequences differed\n", failures, 2 * sequences);
+
+	free(reference_deltas);
+	free(deltas);
+
+	return failures != 0;
+}
@@ -0,0 +1,318 @@
+/*
+  cxNES - NES/Famicom Emulator
+  Copyright (C) 2011-2016 Ryan Jackson
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation.; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc.,
+  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+/* Reader and checker for the shared memory region created by setting
+   state_export_name.  Takes consistent snapshots using the sequence
+   counter and checks each one against the layout described in
+   state_export.h: block sizes, alignment and ordering, a layout that
+   doesn't change between frames, and a frame counter that only goes
+   up.  Exits non-zero on the first mismatch.
+
+   Reading stops after the requested number of frames, or once the
+   emulator clears 'loaded' on exit.  If the region doesn't exist yet
+   it is waited for, so the reader can be started alongside the
+   emulator (see state_export_test.pl).
+
+   Build: cc -I../include -o state_export_reader state_export_reader.c -lrt
+   Usage: state_export_reader <name> [frames]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define STATE_EXPORT_READER
+#include "state_export.h"
+
+#define ALIGNMENT 64
+#define TIMEOUT 10
+
+#define RAM_SIZE 0x800
+#define WRAM_MAX_SIZE 0x10000
+#define OAM_SIZE 256
+#define PALETTE_SIZE 32
+#define PIXEL_SIZE (256 * 240 * sizeof(uint32_t))
+
+static uint8_t snapshot[1 << 20];
+
+static int check_block(const struct state_export_header *header,
+		       const char *name, uint32_t offset, uint32_t size,
+		       uint32_t capacity, uint32_t *end)
+{
+	if (offset % ALIGNMENT) {
+		fprintf(stderr, "%s offset %u not aligned\n", name, offset);
+		return 1;
+	}
+
+	if (offset < *end) {
+		fprintf(stderr, "%s offset %u overlaps previous block "
+			"(ends at %u)\n", name, offset, *end);
+		return 1;
+	}
+
+	if (size > capacity) {
+		fprintf(stderr, "%s size %u, expected at most %u\n",
+			name, size, capacity);
+		return 1;
+	}
+
+	if (offset + capacity > header->total_size) {
+		fprintf(stderr, "%s block %u+%u past end of region (%u)\n",
+			name, offset, capacity, header->total_size);
+		return 1;
+	}
+
+	*end = offset + capacity;
+
+	return 0;
+}
+
+static int check_size(const char *name, uint32_t size, uint32_t expected)
+{
+	if (size != expected) {
+		fprintf(stderr, "%s size %u, expected %u\n", name, size,
+			expected);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int check_layout(const struct state_export_header *header)
+{
+	uint32_t end;
+	int rc;
+
+	if (header->header_size != sizeof(*header)) {
+		fprintf(stderr, "header size %u, expected %zu\n",
+			header->header_size, sizeof(*header));
+		return 1;
+	}
+
+	rc = check_size("ram", header->ram_size, RAM_SIZE);
+	rc |= check_size("oam", header->oam_size, OAM_SIZE);
+	rc |= check_size("palette", header->palette_size, PALETTE_SIZE);
+	rc |= check_size("pixel", header->pixel_size, PIXEL_SIZE);
+	if (rc)
+		return rc;
+
+	end = header->header_size;
+	rc = check_block(header, "ram", header->ram_offset,
+			 header->ram_size, RAM_SIZE, &end);
+	rc = rc || check_block(header, "wram", header->wram_offset,
+			       header->wram_size, WRAM_MAX_SIZE, &end);
+	rc = rc || check_block(header, "oam", header->oam_offset,
+			       header->oam_size, OAM_SIZE, &end);
+	rc = rc || check_block(header, "palette", header->palette_offset,
+			       header->palette_size, PALETTE_SIZE, &end);
+	rc = rc || check_block(header, "pixel", header->pixel_offset,
+			       header->pixel_size, PIXEL_SIZE, &end);
+
+	return rc;
+}
+
+/* Everything but the frame counter, the sequence and loaded flags and
+   the WRAM size (which follows the board) must stay put. */
+static int check_layout_unchanged(const struct state_export_header *first,
+				  const struct state_export_header *header)
+{
+	struct state_export_header a, b;
+
+	a = *first;
+	b = *header;
+	a.sequence = b.sequence = 0;
+	a.loaded = b.loaded = 0;
+	a.frame = b.frame = 0;
+	a.wram_size = b.wram_size = 0;
+
+	if (memcmp(&a, &b, sizeof(a))) {
+		fprintf(stderr, "layout changed at frame %llu\n",
+			(unsigned long long)header->frame);
+		return 1;
+	}
+
+	return 0;
+}
+
+static void *map_region(const char *name, size_t *size)
+{
+	struct stat st;
+	time_t start;
+	void *base;
+	int fd;
+
+	start = time(NULL);
+	while ((fd = shm_open(name, O_RDONLY, 0)) < 0) {
+		if (time(NULL) - start > TIMEOUT) {
+			perror(name);
+			return NULL;
+		}
+		usleep(10000);
+	}
+
+	if (fstat(fd, &st) < 0) {
+		perror(name);
+		close(fd);
+		return NULL;
+	}
+
+	base = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (base == MAP_FAILED) {
+		perror("mmap");
+		return NULL;
+	}
+
+	*size = st.st_size;
+
+	return base;
+}
+
+int main(int argc, char **argv)
+{
+	struct state_export_header *header;
+	struct state_export_header first;
+	char name[256];
+	uint8_t *base;
+	size_t size;
+	uint64_t last_frame;
+	time_t last_update;
+	int frames, count, retries, seen_loaded;
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <name> [frames]\n", argv[0]);
+		return 1;
+	}
+
+	frames = (argc > 2) ? atoi(argv[2]) : 60;
+	snprintf(name, sizeof(name), "%s%s", argv[1][0] == '/' ? "" : "/",
+		 argv[1]);
+
+	base = map_region(name, &size);
+	if (!base)
+		return 1;
+
+	header = (struct state_export_header *)base;
+	if (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) !=
+	    STATE_EXPORT_MAGIC || header->version != STATE_EXPORT_VERSION ||
+	    header->total_size > size ||
+	    header->total_size > sizeof(snapshot)) {
+		fprintf(stderr, "%s: bad header\n", name);
+		return 1;
+	}
+
+	last_frame = 0;
+	last_update = time(NULL);
+	count = 0;
+	retries = 0;
+	seen_loaded = 0;
+
+	while (count < frames) {
+		struct state_export_header copy;
+		uint32_t seq;
+		uint32_t *pixels;
+		uint32_t sum;
+		int i;
+
+		if (time(NULL) - last_update > TIMEOUT) {
+			fprintf(stderr, "no new frame for %d seconds\n",
+				TIMEOUT);
+			return 1;
+		}
+
+		seq = __atomic_load_n(&header->sequence, __ATOMIC_ACQUIRE);
+		if (seq & 1) {
+			usleep(100);
+			continue;
+		}
+
+		memcpy(&copy, header, sizeof(copy));
+		memcpy(snapshot, base, header->total_size);
+
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		if (__atomic_load_n(&header->sequence,
+				    __ATOMIC_RELAXED) != seq) {
+			retries++;
+			continue;
+		}
+
+		if (!copy.loaded) {
+			/* The emulator has exited */
+			if (seen_loaded)
+				break;
+			usleep(1000);
+			continue;
+		}
+
+		if (copy.frame == last_frame) {
+			usleep(1000);
+			continue;
+		}
+
+		if (!seen_loaded) {
+			if (check_layout(&copy))
+				return 1;
+			first = copy;
+			seen_loaded = 1;
+		} else if (check_layout_unchanged(&first, &copy)) {
+			return 1;
+		}
+
+		if (copy.frame < last_frame) {
+			fprintf(stderr, "frame counter went backwards "
+				"(%llu after %llu)\n",
+				(unsigned long long)copy.frame,
+				(unsigned long long)last_frame);
+			return 1;
+		}
+
+		pixels = (uint32_t *)(snapshot + copy.pixel_offset);
+		sum = 0;
+		for (i = 0; i < copy.pixel_size / sizeof(uint32_t); i++)
+			sum = sum * 31 + pixels[i];
+
+		printf("frame %llu: ram[0..3] %02x %02x %02x %02x "
+		       "wram %u bytes, oam[0] %02x, palette[0] %02x, "
+		       "pixels %08x\n", (unsigned long long)copy.frame,
+		       snapshot[copy.ram_offset],
+		       snapshot[copy.ram_offset + 1],
+		       snapshot[copy.ram_offset + 2],
+		       snapshot[copy.ram_offset + 3], copy.wram_size,
+		       snapshot[copy.oam_offset],
+		       snapshot[copy.palette_offset], sum);
+
+		last_frame = copy.frame;
+		last_update = time(NULL);
+		count++;
+	}
+
+	if (!count) {
+		fprintf(stderr, "no frames read\n");
+		return 1;
+	}
+
+	printf("%d frames checked, %d torn reads retried\n", count, retries);
+
+	return 0;
+}
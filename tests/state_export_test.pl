@@ -0,0 +1,85 @@
+#! /usr/bin/perl
+
+# Checks the shared memory state export end to end.
+#
+# The reader in state_export_reader.c is built, then the emulator is
+# run on a ROM with state_export_name set while the reader follows
+# the exported region.  The reader checks the block layout against
+# the header and that the frame counter only goes up, and exits
+# non-zero on any mismatch.
+#
+# Usage: state_export_test.pl [--frames=N] [--emu=path] [rom]
+#
+# If no ROM is given the first .nes file under nes_test_roms is used.
+
+use strict;
+use Getopt::Long;
+use File::Find;
+use File::Temp qw(tempdir);
+
+my $emu_bin = '../cxnes';
+my $emu_options = '-o default_overclock_mode=disabled --regression-test';
+my $romdir = 'nes_test_roms';
+my $cc = $ENV{'CC'} || 'cc';
+my $frames = 300;
+
+GetOptions('frames=i' => \$frames,
+	   'emu=s' => \$emu_bin) or
+  die "usage: $0 [--frames=N] [--emu=path] [rom]\n";
+
+my $rom = shift @ARGV;
+
+if (!defined $rom) {
+	my @roms;
+
+	find({ no_chdir => 1, wanted => sub {
+		push @roms, $File::Find::name if (/\.nes$/i && -f $_);
+	} }, $romdir);
+	@roms = sort @roms;
+	die "no ROMs found under $romdir\n" unless (@roms);
+	$rom = $roms[0];
+}
+
+my $tmpdir = tempdir('cxnes-export-XXXXXX', TMPDIR => 1, CLEANUP => 1);
+my $reader = "$tmpdir/state_export_reader";
+my $name = "cxnes-export-test-$$";
+
+system("$cc -O2 -I../include -o $reader state_export_reader.c -lrt") == 0
+  or die "failed to build state_export_reader\n";
+
+my $pid = fork();
+die "fork failed: $!\n" unless defined $pid;
+
+if (!$pid) {
+	exec("$emu_bin $emu_options -o state_export_name=$name " .
+	     "--test-duration=$frames $rom > /dev/null 2>&1");
+	exit 1;
+}
+
+# The reader waits for the region to appear and stops when the
+# emulator exits, so it checks however many frames it sees.
+system("$reader $name $frames > $tmpdir/reader.log");
+my $reader_status = $?;
+
+waitpid($pid, 0);
+my $emu_status = $?;
+
+if ($emu_status) {
+	printf "$rom...\tFail (emulator exited with status %d)\n",
+	  $emu_status >> 8;
+	exit 1;
+}
+
+if ($reader_status) {
+	print "$rom...\tFail (reader exited with status ",
+	  $reader_status >> 8, ")\n";
+	exit 1;
+}
+
+open LOG, "$tmpdir/reader.log";
+my @lines = <LOG>;
+close LOG;
+chomp $lines[-1];
+
+print "$rom...\tPass ($lines[-1])\n";
+exit 0;